@@ -31,6 +31,7 @@
 #endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 #if defined(OMR_GC_MODRON_COMPACTION)
 #include "CompactScheme.hpp"
+#include "ConcurrentCompactScheme.hpp"
 #endif /* OMR_GC_MODRON_COMPACTION */
 #include "EnvironmentStandard.hpp"
 #include "ForwardedHeader.hpp"
@@ -47,6 +48,7 @@
 #include "omrExampleVM.hpp"
 #include "omrvm.h"
 #include "OMRVMInterface.hpp"
+#include "OMRVMThreadListIterator.hpp"
 #include "ParallelGlobalGC.hpp"
 #include "Scavenger.hpp"
 #include "SlotObject.hpp"
@@ -92,3 +94,32 @@ MM_CollectorLanguageInterfaceImpl::initialize(OMR_VM *omrVM)
 {
 	return true;
 }
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+void
+MM_CollectorLanguageInterfaceImpl::concurrentCompact_evacuateRoots(MM_EnvironmentBase *env, MM_ConcurrentCompactScheme *concurrentCompactScheme)
+{
+	OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+	J9HashTableState state;
+
+	RootEntry *rootEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
+	while (NULL != rootEntry) {
+		concurrentCompactScheme->fixupSlot(env, &rootEntry->rootPtr);
+		rootEntry = (RootEntry *)hashTableNextDo(&state);
+	}
+
+	/* The object table is not a root, but mutators use its entries to reach the objects it names */
+	ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(omrVM->objectTable, &state);
+	while (NULL != objectEntry) {
+		concurrentCompactScheme->fixupSlot(env, &objectEntry->objPtr);
+		objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+	}
+
+	OMR_VMThread *walkThread = NULL;
+	GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+	while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+		concurrentCompactScheme->fixupSlot(env, (omrobjectptr_t *)&walkThread->_savedObject1);
+		concurrentCompactScheme->fixupSlot(env, (omrobjectptr_t *)&walkThread->_savedObject2);
+	}
+}
+#endif /* OMR_GC_MODRON_COMPACTION */
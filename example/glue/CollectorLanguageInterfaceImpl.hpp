@@ -65,6 +65,16 @@ public:
 	static MM_CollectorLanguageInterfaceImpl *newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/**
+	 * The example mutators (GCConfigTest) load every reference, from the root table, the object table or
+	 * an object, through MM_ConcurrentCompactScheme::readBarrier() whenever an evacuation is open, so the
+	 * barrier is always available and never needs arming.
+	 */
+	virtual bool concurrentCompact_isReadBarrierSupported(MM_EnvironmentBase *env) { return true; }
+	virtual void concurrentCompact_evacuateRoots(MM_EnvironmentBase *env, MM_ConcurrentCompactScheme *concurrentCompactScheme);
+#endif /* OMR_GC_MODRON_COMPACTION */
+
 
 };
 
@@ -78,7 +78,7 @@ public:
 	verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap) { }
 
 	void
-	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme) { }
+	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme);
 
 	void
 	workerCleanupAfterGC(MM_EnvironmentBase *env) { }
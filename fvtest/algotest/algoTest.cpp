@@ -119,6 +119,12 @@ static const PoolInputData poolParams[] = {
 	{"POOL_ALWAYS_KEEP_SORTED flag",						32,		10,		sizeof(uintptr_t),		0,		POOL_ALWAYS_KEEP_SORTED},
 	{"POOL_ROUND_TO_PAGE_SIZE flag",						32,		10,		sizeof(uintptr_t),		0,		POOL_ROUND_TO_PAGE_SIZE},
 	{"POOL_NEVER_FREE_PUDDLES flag",						32,		10,		sizeof(uintptr_t),		0,		POOL_NEVER_FREE_PUDDLES},
+	{"POOL_CONCURRENT flag - small pool",					4,		10,		sizeof(uintptr_t),		0,		POOL_CONCURRENT},
+	{"POOL_CONCURRENT flag - larger pool",					16,		256,	sizeof(uintptr_t),		0,		POOL_CONCURRENT},
+	{"POOL_CONCURRENT flag - large alignment size",			16,		256,	64,						0,		POOL_CONCURRENT},
+	{"POOL_CONCURRENT flag - small struct, large number",	4,		9999,	sizeof(uintptr_t),		0,		POOL_CONCURRENT},
+	{"POOL_CONCURRENT flag - large struct, small number",	9999,	5,		sizeof(uintptr_t),		0,		POOL_CONCURRENT},
+	{"POOL_CONCURRENT and POOL_NO_ZERO flags",				32,		10,		sizeof(uintptr_t),		0,		POOL_CONCURRENT | POOL_NO_ZERO},
 };
 
 static const uintptr_t data1[] = {1, 2, 3, 4, 5, 6, 7, 17, 18, 19, 20, 21, 22, 23, 24, 25};
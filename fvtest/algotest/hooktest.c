@@ -24,6 +24,19 @@
 #include "hookable_api.h"
 #include "hooksample_internal.h"
 
+#define DISPATCH_COST_EVENTS 1000000
+#define STRESS_DISPATCH_THREADS 4
+#define STRESS_LISTENERS 8
+#define STRESS_ROUNDS 100
+#define RECLAIM_ROUNDS 10000
+#define RETIRED_LISTENERS_BOUND 256
+
+typedef struct StressDispatchData {
+	volatile uintptr_t *stop;
+	uintptr_t dispatches;
+	uintptr_t badCounts;
+} StressDispatchData;
+
 static int32_t testHookInterface(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface);
 static void testEnabled(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t expectedResult);
 static void testDisable(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t expectedResult);
@@ -33,6 +46,16 @@ static void testRegisterWithAgent(OMRPortLibrary *portLib, uintptr_t *passCount,
 static void testUnregister(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event);
 static void testUnregisterWithAgent(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t userData);
 static void testDispatch(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, uintptr_t event, uintptr_t expectedResult);
+static void testRegisterSampled(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t taggedEvent, uintptr_t samplingArg);
+static void testDispatchSampled(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, uintptr_t dispatches, uintptr_t minExpected, uintptr_t maxExpected);
+static void testDispatchCost(OMRPortLibrary *portLib, J9HookInterface **hookInterface);
+static uint64_t timeDispatches(OMRPortLibrary *portLib, uintptr_t dispatches);
+static void testConcurrentRegistration(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface);
+static void testRetiredListenersReclaimed(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface);
+static void testRetiredListenersBounded(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface);
+static uintptr_t countRetiredListeners(J9HookInterface **hookInterface);
+static int J9THREAD_PROC stressDispatchThread(void *entryArg);
+static void hookStressEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData);
 static uintptr_t testAllocateAgentID(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface);
 static void hookNormalEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData);
 static void hookOrderedEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData);
@@ -163,6 +186,25 @@ testHookInterface(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *fail
 	testRegisterWithAgent(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT3, agent2, 3, 0);
 	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT3, 5);
 
+	/* a sampled listener receives every third event */
+	testRegisterSampled(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT2 | J9HOOK_TAG_SAMPLED, 3);
+	testDispatchSampled(portLib, passCount, failCount, 9, 3, 3);
+	testUnregister(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT2);
+
+	/* a rate limited listener receives at most two events per second (the dispatches may span two seconds) */
+	testRegisterSampled(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT2 | J9HOOK_TAG_RATE_LIMITED, 2);
+	testDispatchSampled(portLib, passCount, failCount, 10, 2, 4);
+	testUnregister(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT2);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT2, 0);
+
+	testDispatchCost(portLib, hookInterface);
+
+	testConcurrentRegistration(portLib, passCount, failCount, hookInterface);
+
+	testRetiredListenersReclaimed(portLib, passCount, failCount, hookInterface);
+
+	testRetiredListenersBounded(portLib, passCount, failCount, hookInterface);
+
 	return rc;
 }
 
@@ -231,6 +273,18 @@ testRegisterWithAgent(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *
 	}
 }
 
+static void
+testRegisterSampled(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t taggedEvent, uintptr_t samplingArg)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+
+	if ((*hookInterface)->J9HookRegisterWithCallSite(hookInterface, taggedEvent, hookNormalEvent, OMR_GET_CALLSITE(), NULL, samplingArg) == 0) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("J9HookRegisterWithCallSite for 0x%zx failed. It should have succeeded.\n", taggedEvent);
+		(*failCount)++;
+	}
+}
 
 static uintptr_t
 testAllocateAgentID(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface)
@@ -290,6 +344,300 @@ testDispatch(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount
 	}
 }
 
+static void
+testDispatchSampled(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, uintptr_t dispatches, uintptr_t minExpected, uintptr_t maxExpected)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	uintptr_t count = 0;
+	uintptr_t i = 0;
+
+	for (i = 0; i < dispatches; i++) {
+		TRIGGER_TESTHOOK_EVENT2(sampleHookInterface, 1, count, -1);
+	}
+
+	if ((count >= minExpected) && (count <= maxExpected)) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("Incorrect number of sampled events for 0x%zx. Got %d, expected %d to %d\n", (uintptr_t)TESTHOOK_EVENT2, count, minExpected, maxExpected);
+		(*failCount)++;
+	}
+}
+
+/*
+ * Microbenchmark of hook dispatch. Reports the cost per event of an unhooked event, and of an
+ * event with a single listener that receives every event, every 100th event, or at most 1000
+ * events per second. Nothing is asserted about the timings.
+ */
+static void
+testDispatchCost(OMRPortLibrary *portLib, J9HookInterface **hookInterface)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	uint64_t unhookedNanos = 0;
+	uint64_t listenerNanos = 0;
+	uint64_t sampledNanos = 0;
+	uint64_t rateLimitedNanos = 0;
+
+	unhookedNanos = timeDispatches(portLib, DISPATCH_COST_EVENTS);
+
+	(*hookInterface)->J9HookRegisterWithCallSite(hookInterface, TESTHOOK_EVENT2, hookNormalEvent, OMR_GET_CALLSITE(), NULL);
+	listenerNanos = timeDispatches(portLib, DISPATCH_COST_EVENTS);
+	(*hookInterface)->J9HookUnregister(hookInterface, TESTHOOK_EVENT2, hookNormalEvent, NULL);
+
+	(*hookInterface)->J9HookRegisterWithCallSite(hookInterface, TESTHOOK_EVENT2 | J9HOOK_TAG_SAMPLED, hookNormalEvent, OMR_GET_CALLSITE(), NULL, (uintptr_t)100);
+	sampledNanos = timeDispatches(portLib, DISPATCH_COST_EVENTS);
+	(*hookInterface)->J9HookUnregister(hookInterface, TESTHOOK_EVENT2, hookNormalEvent, NULL);
+
+	(*hookInterface)->J9HookRegisterWithCallSite(hookInterface, TESTHOOK_EVENT2 | J9HOOK_TAG_RATE_LIMITED, hookNormalEvent, OMR_GET_CALLSITE(), NULL, (uintptr_t)1000);
+	rateLimitedNanos = timeDispatches(portLib, DISPATCH_COST_EVENTS);
+	(*hookInterface)->J9HookUnregister(hookInterface, TESTHOOK_EVENT2, hookNormalEvent, NULL);
+
+	omrtty_printf("Hook dispatch cost over %d events: unhooked %.2f ns, listener %.2f ns, sampled 1/100 %.2f ns, rate limited 1000/s %.2f ns\n",
+		DISPATCH_COST_EVENTS,
+		(double)unhookedNanos / DISPATCH_COST_EVENTS,
+		(double)listenerNanos / DISPATCH_COST_EVENTS,
+		(double)sampledNanos / DISPATCH_COST_EVENTS,
+		(double)rateLimitedNanos / DISPATCH_COST_EVENTS);
+}
+
+static uint64_t
+timeDispatches(OMRPortLibrary *portLib, uintptr_t dispatches)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	uintptr_t count = 0;
+	uintptr_t i = 0;
+	uint64_t start = omrtime_nano_time();
+
+	for (i = 0; i < dispatches; i++) {
+		TRIGGER_TESTHOOK_EVENT2(sampleHookInterface, 1, count, -1);
+	}
+
+	return omrtime_nano_time() - start;
+}
+
+/*
+ * Register and unregister listeners while other threads dispatch the same event. A listener which
+ * stays registered throughout must see every event, and no event may reach more listeners than
+ * could have been registered.
+ */
+static void
+testConcurrentRegistration(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	volatile uintptr_t stop = 0;
+	StressDispatchData data[STRESS_DISPATCH_THREADS];
+	omrthread_t threads[STRESS_DISPATCH_THREADS];
+	uintptr_t started = 0;
+	uintptr_t round = 0;
+	uintptr_t i = 0;
+
+	(*hookInterface)->J9HookRegisterWithCallSite(hookInterface, TESTHOOK_EVENT2, hookNormalEvent, OMR_GET_CALLSITE(), NULL);
+
+	for (i = 0; i < STRESS_DISPATCH_THREADS; i++) {
+		omrthread_attr_t attr = NULL;
+
+		data[i].stop = &stop;
+		data[i].dispatches = 0;
+		data[i].badCounts = 0;
+		if ((J9THREAD_SUCCESS == omrthread_attr_init(&attr))
+			&& (J9THREAD_SUCCESS == omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+			&& (J9THREAD_SUCCESS == omrthread_create_ex(&threads[started], &attr, 0, stressDispatchThread, &data[i]))
+		) {
+			started += 1;
+		}
+		omrthread_attr_destroy(&attr);
+	}
+
+	for (round = 0; round < STRESS_ROUNDS; round++) {
+		for (i = 1; i <= STRESS_LISTENERS; i++) {
+			(*hookInterface)->J9HookRegisterWithCallSite(hookInterface, TESTHOOK_EVENT2, hookStressEvent, OMR_GET_CALLSITE(), (void *)i);
+		}
+		for (i = 1; i <= STRESS_LISTENERS; i++) {
+			(*hookInterface)->J9HookUnregister(hookInterface, TESTHOOK_EVENT2, hookStressEvent, (void *)i);
+		}
+	}
+
+	stop = 1;
+	for (i = 0; i < started; i++) {
+		omrthread_join(threads[i]);
+	}
+	(*hookInterface)->J9HookUnregister(hookInterface, TESTHOOK_EVENT2, hookNormalEvent, NULL);
+
+	if (STRESS_DISPATCH_THREADS != started) {
+		omrtty_printf("Only %d of %d dispatching threads started\n", started, STRESS_DISPATCH_THREADS);
+		(*failCount)++;
+	} else {
+		(*passCount)++;
+	}
+	for (i = 0; i < started; i++) {
+		if (0 == data[i].badCounts) {
+			(*passCount)++;
+		} else {
+			omrtty_printf("Dispatching thread %d saw %d of %d events reach too few or too many listeners\n", i, data[i].badCounts, data[i].dispatches);
+			(*failCount)++;
+		}
+	}
+}
+
+static void
+testRetiredListenersReclaimed(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	uintptr_t maxRetired = 0;
+	uintptr_t badCounts = 0;
+	uintptr_t round = 0;
+
+	/* every registration and unregistration replaces the listener array of the event */
+	for (round = 0; round < RECLAIM_ROUNDS; round++) {
+		uintptr_t retiredCount = 0;
+		uintptr_t count = 0;
+
+		(*hookInterface)->J9HookRegisterWithCallSite(hookInterface, TESTHOOK_EVENT2, hookNormalEvent, OMR_GET_CALLSITE(), NULL);
+		TRIGGER_TESTHOOK_EVENT2(sampleHookInterface, 1, count, -1);
+		if (1 != count) {
+			badCounts += 1;
+		}
+		(*hookInterface)->J9HookUnregister(hookInterface, TESTHOOK_EVENT2, hookNormalEvent, NULL);
+
+		retiredCount = countRetiredListeners(hookInterface);
+		if (retiredCount > maxRetired) {
+			maxRetired = retiredCount;
+		}
+	}
+
+	if (0 == badCounts) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("%d of %d events reached the wrong number of listeners while listener arrays were reclaimed\n", badCounts, RECLAIM_ROUNDS);
+		(*failCount)++;
+	}
+	if (0 == maxRetired) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("%d retired listener arrays were kept after %d registrations with no dispatch in progress\n", maxRetired, RECLAIM_ROUNDS);
+		(*failCount)++;
+	}
+}
+
+/*
+ * Register and unregister a listener while other threads dispatch the event without pause, so that
+ * there is almost always a dispatch in progress. The retired listener arrays must still be freed as
+ * registration goes on, and all of them once the dispatching threads have stopped.
+ */
+static void
+testRetiredListenersBounded(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	volatile uintptr_t stop = 0;
+	StressDispatchData data[STRESS_DISPATCH_THREADS];
+	omrthread_t threads[STRESS_DISPATCH_THREADS];
+	uintptr_t maxRetired = 0;
+	uintptr_t started = 0;
+	uintptr_t round = 0;
+	uintptr_t i = 0;
+
+	(*hookInterface)->J9HookRegisterWithCallSite(hookInterface, TESTHOOK_EVENT2, hookNormalEvent, OMR_GET_CALLSITE(), NULL);
+
+	for (i = 0; i < STRESS_DISPATCH_THREADS; i++) {
+		omrthread_attr_t attr = NULL;
+
+		data[i].stop = &stop;
+		data[i].dispatches = 0;
+		data[i].badCounts = 0;
+		if ((J9THREAD_SUCCESS == omrthread_attr_init(&attr))
+			&& (J9THREAD_SUCCESS == omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+			&& (J9THREAD_SUCCESS == omrthread_create_ex(&threads[started], &attr, 0, stressDispatchThread, &data[i]))
+		) {
+			started += 1;
+		}
+		omrthread_attr_destroy(&attr);
+	}
+
+	for (round = 0; round < RECLAIM_ROUNDS; round++) {
+		uintptr_t retiredCount = 0;
+
+		(*hookInterface)->J9HookRegisterWithCallSite(hookInterface, TESTHOOK_EVENT2, hookStressEvent, OMR_GET_CALLSITE(), (void *)1);
+		(*hookInterface)->J9HookUnregister(hookInterface, TESTHOOK_EVENT2, hookStressEvent, (void *)1);
+
+		retiredCount = countRetiredListeners(hookInterface);
+		if (retiredCount > maxRetired) {
+			maxRetired = retiredCount;
+		}
+		/* let the dispatching threads run on a machine with few processors */
+		omrthread_yield();
+	}
+
+	stop = 1;
+	for (i = 0; i < started; i++) {
+		omrthread_join(threads[i]);
+	}
+	(*hookInterface)->J9HookUnregister(hookInterface, TESTHOOK_EVENT2, hookNormalEvent, NULL);
+
+	if (STRESS_DISPATCH_THREADS != started) {
+		omrtty_printf("Only %d of %d dispatching threads started\n", started, STRESS_DISPATCH_THREADS);
+		(*failCount)++;
+	} else {
+		(*passCount)++;
+	}
+	for (i = 0; i < started; i++) {
+		if (0 == data[i].badCounts) {
+			(*passCount)++;
+		} else {
+			omrtty_printf("Dispatching thread %d saw %d of %d events reach too few or too many listeners\n", i, data[i].badCounts, data[i].dispatches);
+			(*failCount)++;
+		}
+	}
+	if (maxRetired <= RETIRED_LISTENERS_BOUND) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("%d retired listener arrays were kept during %d registrations with dispatches in progress, expected at most %d\n", maxRetired, RECLAIM_ROUNDS, RETIRED_LISTENERS_BOUND);
+		(*failCount)++;
+	}
+	if (0 == countRetiredListeners(hookInterface)) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("%d retired listener arrays were kept after the dispatching threads stopped\n", countRetiredListeners(hookInterface));
+		(*failCount)++;
+	}
+}
+
+static uintptr_t
+countRetiredListeners(J9HookInterface **hookInterface)
+{
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	J9HookListenerArray *retired = NULL;
+	uintptr_t count = 0;
+
+	for (retired = commonInterface->retiredListeners; NULL != retired; retired = retired->retiredNext) {
+		count += 1;
+	}
+
+	return count;
+}
+
+static int J9THREAD_PROC
+stressDispatchThread(void *entryArg)
+{
+	StressDispatchData *data = (StressDispatchData *)entryArg;
+
+	while (0 == *data->stop) {
+		uintptr_t count = 0;
+
+		TRIGGER_TESTHOOK_EVENT2(sampleHookInterface, 1, count, -1);
+		if ((count < 1) || (count > (1 + STRESS_LISTENERS))) {
+			data->badCounts += 1;
+		}
+		data->dispatches += 1;
+	}
+
+	return 0;
+}
+
+static void
+hookStressEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData)
+{
+	((TestHookEvent2 *)voidEventData)->count += 1;
+}
+
 static void
 hookNormalEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData)
 {
@@ -20,6 +20,9 @@
  *******************************************************************************/
 
 #include "CollectorLanguageInterface.hpp"
+#if defined(OMR_GC_MODRON_COMPACTION)
+#include "ConcurrentCompactScheme.hpp"
+#endif /* OMR_GC_MODRON_COMPACTION */
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
 #include "ObjectAllocationModel.hpp"
@@ -28,7 +31,9 @@
 #include "omrgc.h"
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
+#include "VerboseBinaryFormat.hpp"
 #include "VerboseWriterChain.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
 
 //#define OMRGCTEST_PRINTFILE
 
@@ -43,16 +48,36 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_lockfree_packets_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_free_entry_cache_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_tlh_adaptive_sizing_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_background_heap_commit_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_binary_logging_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_async_logging_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_async_logging_drop_config.xml"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
 #endif
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/global_GC_concurrent_compact_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_partial_compact_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_prefetch_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_workstealing_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_numa_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_free_entry_cache_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
                         , "fvtest/gctest/configuration/gencon_GC_backout_config.xml"
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        , "fvtest/gctest/configuration/segregated_GC_free_region_refill_config.xml"
+                        , "fvtest/gctest/configuration/segregated_GC_size_class_profile_config.xml"
+                        , "fvtest/gctest/configuration/segregated_GC_lazy_sweep_config.xml"
 #endif
                         };
 
@@ -108,7 +133,7 @@ GCConfigTest::SetUp()
 	if (NULL == verboseFile) {
 		FAIL() << "Failed to allocate native memory.";
 	}
-	omrstr_printf(verboseFile, MAX_NAME_LENGTH, "%s_%d_%lld.xml", verboseFileNamePrefix, omrsysinfo_get_pid(), omrtime_current_time_millis());
+	omrstr_printf(verboseFile, MAX_NAME_LENGTH, "%s_%d_%lld.%s", verboseFileNamePrefix, omrsysinfo_get_pid(), omrtime_current_time_millis(), env->getExtensions()->binaryLogging ? "gcb" : "xml");
 	verboseManager = MM_VerboseManager::newInstance(env, exampleVM->_omrVM);
 	verboseManager->configureVerboseGC(exampleVM->_omrVM, verboseFile, numOfFiles, numOfCycles);
 	gcTestEnv->log("Verbose File: %s\n", verboseFile);
@@ -357,7 +382,7 @@ GCConfigTest::createObject(const char *namePrefix, OMRGCObjectType objType, int3
 		if (NULL != objEntry) {
 			/* Keep count of the new allocated non-garbage object size for garbage insertion. If the object exists in objectTable, its size is ignored. */
 			if ((ROOT == objType) || (NORMAL == objType)) {
-				gp.accumulatedSize += env->getExtensions()->objectModel.getSizeInBytesWithHeader(objEntry->objPtr);
+				gp.accumulatedSize += env->getExtensions()->objectModel.getSizeInBytesWithHeader(readBarrier(objEntry->objPtr));
 			}
 		} else {
 			omrmem_free_memory(objName);
@@ -397,7 +422,7 @@ GCConfigTest::createFixedSizeTree(ObjectEntry **rootEntryIndirectPtr, const char
 	/* add it to the root table */
 	RootEntry rootEntry;
 	rootEntry.name = (*rootEntryIndirectPtr)->name;
-	rootEntry.rootPtr = (*rootEntryIndirectPtr)->objPtr;
+	rootEntry.rootPtr = readBarrier((*rootEntryIndirectPtr)->objPtr);
 	if (NULL == hashTableAdd(exampleVM->rootTable, &rootEntry)) {
 		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to add new root entry %s to root table!\n", __FILE__, __LINE__, rootEntry.name);
 		goto done;
@@ -483,7 +508,7 @@ GCConfigTest::processObjNode(pugi::xml_node node, const char *namePrefixStr, OMR
 			 * the rest of the tree. Remove it from the root set after the entire garbage tree is allocated.*/
 			RootEntry rEntry;
 			rEntry.name = objectEntry->name;
-			rEntry.rootPtr = objectEntry->objPtr;
+			rEntry.rootPtr = readBarrier(objectEntry->objPtr);
 			if (NULL == hashTableAdd(exampleVM->rootTable, &rEntry)) {
 				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to add new root entry to root table!\n", __FILE__, __LINE__);
 				goto done;
@@ -605,25 +630,41 @@ done:
 	return rt;
 }
 
+omrobjectptr_t
+GCConfigTest::readBarrier(omrobjectptr_t objectPtr)
+{
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/* While an evacuation is open, references into the evacuation set are healed lazily */
+	MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
+	MM_ConcurrentCompactScheme *concurrentCompactScheme = extensions->concurrentCompactScheme;
+	if ((NULL != objectPtr) && (NULL != concurrentCompactScheme) && concurrentCompactScheme->isEvacuating()) {
+		objectPtr = concurrentCompactScheme->readBarrier(MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread), objectPtr);
+	}
+#endif /* OMR_GC_MODRON_COMPACTION */
+	return objectPtr;
+}
+
 int32_t
 GCConfigTest::attachChildEntry(ObjectEntry *parentEntry, ObjectEntry *childEntry)
 {
 	int32_t rc = 0;
 	MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
-	uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(parentEntry->objPtr);
-	fomrobject_t *firstSlot = (fomrobject_t *)parentEntry->objPtr + 1;
-	fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)parentEntry->objPtr + size);
+	omrobjectptr_t parentPtr = readBarrier(parentEntry->objPtr);
+	omrobjectptr_t childPtr = readBarrier(childEntry->objPtr);
+	uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(parentPtr);
+	fomrobject_t *firstSlot = (fomrobject_t *)parentPtr + 1;
+	fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)parentPtr + size);
 	uintptr_t slotCount = endSlot - firstSlot;
 
 	if ((uint32_t)parentEntry->numOfRef < slotCount) {
 		fomrobject_t *childSlot = firstSlot + parentEntry->numOfRef;
-		standardWriteBarrierStore(exampleVM->_omrVMThread, parentEntry->objPtr, childSlot, childEntry->objPtr);
+		standardWriteBarrierStore(exampleVM->_omrVMThread, parentPtr, childSlot, childPtr);
 		gcTestEnv->log(LEVEL_VERBOSE, "\tadd child %s(%p[0x%llx]) to parent %s(%p[0x%llx]) slot %p[%llx].\n", 
-		               childEntry->name, childEntry->objPtr, childEntry->objPtr->header.raw(), parentEntry->name, parentEntry->objPtr, parentEntry->objPtr->header.raw(), childSlot, (uintptr_t)*childSlot);
+		               childEntry->name, childPtr, childPtr->header.raw(), parentEntry->name, parentPtr, parentPtr->header.raw(), childSlot, (uintptr_t)*childSlot);
 		parentEntry->numOfRef += 1;
 	} else {
 		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: numOfFields %d defined for %s(%p[0x%llx]) is not enough to hold child reference for %s(%p[0x%llx]).\n",
-				__FILE__, __LINE__, parentEntry->numOfRef, parentEntry->name, parentEntry->objPtr, parentEntry->objPtr->header.raw(), childEntry->name, childEntry->objPtr, childEntry->objPtr->header.raw());
+				__FILE__, __LINE__, parentEntry->numOfRef, parentEntry->name, parentPtr, parentPtr->header.raw(), childEntry->name, childPtr, childPtr->header.raw());
 		rc = 1;
 	}
 	return rc;
@@ -636,15 +677,17 @@ GCConfigTest::removeObjectFromRootTable(const char *name)
 	RootEntry searchEntry;
 	searchEntry.name = name;
 	RootEntry *rootEntry = (RootEntry *)hashTableFind(exampleVM->rootTable, &searchEntry);
+	omrobjectptr_t rootPtr = NULL;
 	if (NULL == rootEntry) {
 		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to find root object %s in root table.\n", __FILE__, __LINE__, name);
 		goto done;
 	}
+	rootPtr = readBarrier(rootEntry->rootPtr);
 	if (0 != hashTableRemove(exampleVM->rootTable, rootEntry)) {
 		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to remove root object %s from root table!\n", __FILE__, __LINE__, name);
 		goto done;
 	}
-	gcTestEnv->log(LEVEL_VERBOSE, "Remove object %s(%p[0x%llx]) from root table.\n", name, rootEntry->rootPtr, rootEntry->rootPtr->header.raw());
+	gcTestEnv->log(LEVEL_VERBOSE, "Remove object %s(%p[0x%llx]) from root table.\n", name, rootPtr, rootPtr->header.raw());
 
 	rt = 0;
 done:
@@ -656,15 +699,17 @@ GCConfigTest::removeObjectFromObjectTable(const char *name)
 {
 	int32_t rt = 1;
 	ObjectEntry *foundEntry = find(name);
+	omrobjectptr_t objPtr = NULL;
 	if (NULL == foundEntry) {
 		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to find object %s in object table.\n", __FILE__, __LINE__, name);
 		goto done;
 	}
+	objPtr = readBarrier(foundEntry->objPtr);
 	if (0 != hashTableRemove(exampleVM->objectTable, foundEntry)) {
 		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to remove object %s from object table!\n", __FILE__, __LINE__, name);
 		goto done;
 	}
-	gcTestEnv->log(LEVEL_VERBOSE, "Remove object %s(%p[0x%llx]) from object table.\n", name, foundEntry->objPtr, foundEntry->objPtr->header.raw());
+	gcTestEnv->log(LEVEL_VERBOSE, "Remove object %s(%p[0x%llx]) from object table.\n", name, objPtr, objPtr->header.raw());
 
 	rt = 0;
 done:
@@ -675,9 +720,11 @@ int32_t
 GCConfigTest::removeObjectFromParentSlot(const char *name, ObjectEntry *parentEntry)
 {
 	MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
-	uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(parentEntry->objPtr);
-	fomrobject_t *currentSlot = (fomrobject_t *)parentEntry->objPtr + 1;
-	fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)parentEntry->objPtr + size);
+	omrobjectptr_t parentPtr = readBarrier(parentEntry->objPtr);
+	uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(parentPtr);
+	fomrobject_t *currentSlot = (fomrobject_t *)parentPtr + 1;
+	fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)parentPtr + size);
+	omrobjectptr_t objPtr = NULL;
 
 	int32_t rt = 1;
 	ObjectEntry *objEntry = find(name);
@@ -685,11 +732,13 @@ GCConfigTest::removeObjectFromParentSlot(const char *name, ObjectEntry *parentEn
 		gcTestEnv->log(LEVEL_ERROR, "%s:%d Could not find object %s in hash table.\n", __FILE__, __LINE__, name);
 		goto done;
 	}
+	objPtr = readBarrier(objEntry->objPtr);
 
 	while (currentSlot < endSlot) {
 		GC_SlotObject slotObject(exampleVM->_omrVM, currentSlot);
-		if (objEntry->objPtr == slotObject.readReferenceFromSlot()) {
-			gcTestEnv->log(LEVEL_VERBOSE, "Remove object %s(%p[0x%llx]) from parent %s(%p[0x%llx]) slot %p.\n", name, objEntry->objPtr, objEntry->objPtr->header.raw(), parentEntry->name, parentEntry->objPtr, parentEntry->objPtr->header.raw(), slotObject.readAddressFromSlot());
+		omrobjectptr_t slotValue = readBarrier(slotObject.readReferenceFromSlot());
+		if (objPtr == slotValue) {
+			gcTestEnv->log(LEVEL_VERBOSE, "Remove object %s(%p[0x%llx]) from parent %s(%p[0x%llx]) slot %p.\n", name, objPtr, objPtr->header.raw(), parentEntry->name, parentPtr, parentPtr->header.raw(), slotObject.readAddressFromSlot());
 			slotObject.writeReferenceToSlot(NULL);
 			rt = 0;
 			break;
@@ -906,6 +955,165 @@ done:
 	return rt;
 }
 
+int32_t
+GCConfigTest::verifyVerboseGCAsynchronous()
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	int32_t rt = 0;
+	uintptr_t seq = 1;
+	uintptr_t droppedRecords = 0;
+	uintptr_t droppedBytes = 0;
+	uintptr_t reportedRecords = 0;
+	uintptr_t reportedBytes = 0;
+
+	MM_VerboseWriter *writer = verboseManager->getWriterChain()->getFirstWriter();
+	while ((NULL != writer) && (VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS != writer->getType())) {
+		writer = writer->getNextWriter();
+	}
+	if (NULL == writer) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d No asynchronous verbose writer attached.\n", __FILE__, __LINE__);
+		return 1;
+	}
+	droppedRecords = ((MM_VerboseWriterFileLoggingAsynchronous *)writer)->getDroppedRecords();
+	droppedBytes = ((MM_VerboseWriterFileLoggingAsynchronous *)writer)->getDroppedBytes();
+	gcTestEnv->log("Asynchronous verbose writer dropped %zu records (%zu bytes)\n", droppedRecords, droppedBytes);
+
+	/* every file must be well formed, dropped output never leaves part of a record behind */
+	do {
+		char currentVerboseFile[MAX_NAME_LENGTH];
+		if (0 == numOfFiles) {
+			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s", verboseFile);
+		} else {
+			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
+		}
+		pugi::xml_document verboseDoc;
+		pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+		if ((0 != numOfFiles) && (pugi::status_file_not_found == result.status)) {
+			break;
+		}
+		if (!result) {
+			gcTestEnv->log(LEVEL_ERROR, "\t*FAILED* %s is not well formed: %s at offset %td\n", currentVerboseFile, result.description(), result.offset);
+			return 1;
+		}
+
+		pugi::xpath_node_set warnings = verboseDoc.select_nodes("/verbosegc/warning[contains(@details, 'dropped so far')]");
+		for (pugi::xpath_node_set::const_iterator it = warnings.begin(); it != warnings.end(); ++it) {
+			const char *details = it->node().attribute("details").value();
+			if (2 != sscanf(details, "asynchronous verbose log buffer full, %zu records (%zu bytes) dropped so far", &reportedRecords, &reportedBytes)) {
+				gcTestEnv->log(LEVEL_ERROR, "\t*FAILED* unrecognized warning \"%s\"\n", details);
+				return 1;
+			}
+		}
+	} while (seq <= numOfFiles);
+
+	/* the last warning must account for everything dropped, including drops at the end of the run */
+	if ((droppedRecords != reportedRecords) || (droppedBytes != reportedBytes)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "\t*FAILED* %zu records (%zu bytes) dropped, but %zu records (%zu bytes) reported\n", droppedRecords, droppedBytes, reportedRecords, reportedBytes);
+	}
+	return rt;
+}
+
+int32_t
+GCConfigTest::verifyVerboseGCBinaryFile(const char *fileName, uintptr_t *gcEndCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	int32_t rt = 0;
+	uintptr_t stringCount = 0;
+	VerboseBinaryFileHeader fileHeader;
+	VerboseBinaryRecordHeader recordHeader;
+	uint64_t fields[VERBOSE_BINARY_MAX_FIELDS];
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to open binary verbose log %s.\n", __FILE__, __LINE__, fileName);
+		return 1;
+	}
+	gcTestEnv->log("Parsing binary verbose log %s:\n", fileName);
+
+	if (((intptr_t)sizeof(fileHeader) != omrfile_read(fd, &fileHeader, sizeof(fileHeader)))
+		|| (0 != memcmp(fileHeader.magic, VERBOSE_BINARY_MAGIC, sizeof(VERBOSE_BINARY_MAGIC)))
+		|| (VERBOSE_BINARY_BYTE_ORDER_MARK != fileHeader.byteOrderMark)
+		|| (VERBOSE_BINARY_VERSION != fileHeader.version)
+		|| (sizeof(fileHeader) > fileHeader.headerSize)
+	) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "\t*FAILED* invalid file header\n");
+		goto done;
+	}
+	omrfile_seek(fd, fileHeader.headerSize, EsSeekSet);
+
+	while ((intptr_t)sizeof(recordHeader) == omrfile_read(fd, &recordHeader, sizeof(recordHeader))) {
+		intptr_t fieldBytes = recordHeader.fieldCount * sizeof(uint64_t);
+		if ((VERBOSE_BINARY_EVENT_COUNT <= recordHeader.type)
+			|| (VERBOSE_BINARY_MAX_FIELDS < recordHeader.fieldCount)
+			|| (0 != (recordHeader.size % VERBOSE_BINARY_RECORD_ALIGNMENT))
+			|| ((sizeof(recordHeader) + fieldBytes) > recordHeader.size)
+			|| (fieldBytes != omrfile_read(fd, fields, fieldBytes))
+		) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "\t*FAILED* malformed record of type %u and size %u\n", recordHeader.type, recordHeader.size);
+			goto done;
+		}
+		omrfile_seek(fd, recordHeader.size - sizeof(recordHeader) - fieldBytes, EsSeekCur);
+
+		for (uintptr_t i = 0; i < recordHeader.fieldCount; i++) {
+			if ((0 != (recordHeader.stringFieldMask & ((uint32_t)1 << i))) && (fields[i] >= stringCount)) {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "\t*FAILED* record of type %u refers to undefined string %llu\n", recordHeader.type, fields[i]);
+				goto done;
+			}
+		}
+
+		if (VERBOSE_BINARY_EVENT_STRING == recordHeader.type) {
+			if (fields[0] == stringCount) {
+				stringCount += 1;
+			}
+		} else if (VERBOSE_BINARY_EVENT_GC_END == recordHeader.type) {
+			/* id, type, contextid, durationus, userus, systemus, stallus, activethreads, free, total */
+			if ((10 > recordHeader.fieldCount) || (fields[8] > fields[9])) {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "\t*FAILED* inconsistent gc-end record id=%llu\n", fields[0]);
+				goto done;
+			}
+			*gcEndCount += 1;
+		}
+	}
+
+done:
+	omrfile_close(fd);
+	return rt;
+}
+
+int32_t
+GCConfigTest::verifyVerboseGCBinary()
+{
+	int32_t rt = 0;
+	uintptr_t gcEndCount = 0;
+
+	if (0 == numOfFiles) {
+		rt = verifyVerboseGCBinaryFile(verboseFile, &gcEndCount);
+	} else {
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+		for (uintptr_t seq = 1; (0 == rt) && (seq <= numOfFiles); seq++) {
+			char currentVerboseFile[MAX_NAME_LENGTH];
+			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq);
+			if (0 > omrfile_attr(currentVerboseFile)) {
+				break;
+			}
+			rt = verifyVerboseGCBinaryFile(currentVerboseFile, &gcEndCount);
+		}
+	}
+
+	if ((0 == rt) && (0 == gcEndCount)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "*FAILED* Could not find any gc-end record in binary verbose output.\n");
+	} else if (0 == rt) {
+		gcTestEnv->log("*PASSED* %zu gc-end records\n", gcEndCount);
+	}
+	return rt;
+}
+
 int32_t
 GCConfigTest::parseGarbagePolicy(pugi::xml_node node)
 {
@@ -973,6 +1181,14 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "verboseOutput")) {
+			int32_t count = atoi(node.attribute("count").value());
+			gcTestEnv->log("Writing %d verbose records...\n", count);
+			MM_VerboseWriterChain *writerChain = verboseManager->getWriterChain();
+			for (int32_t i = 0; i < count; i++) {
+				writerChain->formatAndOutput(env, 1, "<test-output seq=\"%d\" />", i);
+				writerChain->flush(env);
+			}
 		}
 	}
 done:
@@ -1044,7 +1260,18 @@ TEST_P(GCConfigTest, test)
 			/* select verboseGC nodes with right spec info */
 			omrstr_printf(verboseNodeSet, MAX_NAME_LENGTH, "verboseGC[not(@spec) or @spec = '%s']", STRINGFY(SPEC));
 			pugi::xpath_node_set verboseGCs = configChild.select_nodes(verboseNodeSet);
-			rt = verifyVerboseGC(verboseGCs);
+			if (env->getExtensions()->binaryLogging || env->getExtensions()->asyncLogging) {
+				/* these writers hold output back from the file; close the streams so the log is complete */
+				verboseManager->closeStreams(env);
+			}
+			if (env->getExtensions()->binaryLogging) {
+				rt = verifyVerboseGCBinary();
+			} else {
+				rt = verifyVerboseGC(verboseGCs);
+				if ((0 == rt) && env->getExtensions()->asyncLogging) {
+					rt = verifyVerboseGCAsynchronous();
+				}
+			}
 			ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
 			gcTestEnv->log("[ Verification Successful ]\n\n");
 		} else if (0 == strcmp(configChild.name(), "operation")) {
@@ -99,6 +99,12 @@ protected:
 	int32_t createFixedSizeTree(ObjectEntry **objectEntry, const char *namePrefixStr, OMRGCObjectType objType, uintptr_t totalSize, uintptr_t objSize, int32_t breadth);
 	int32_t processObjNode(pugi::xml_node node, const char *namePrefixStr, OMRGCObjectType objType, AttributeElem *numOfFieldsElem, AttributeElem *breadthElem, int32_t depth);
 	int32_t insertGarbage();
+	/**
+	 * Every reference the test loads from the root table, the object table or an object goes through this
+	 * read barrier, which concurrent compaction relies on.
+	 * @return the object to use in place of objectPtr
+	 */
+	omrobjectptr_t readBarrier(omrobjectptr_t objectPtr);
 	int32_t attachChildEntry(ObjectEntry *parentEntry, ObjectEntry *childEntry);
 	int32_t removeObjectFromRootTable(const char *name);
 	int32_t removeObjectFromObjectTable(const char *name);
@@ -108,6 +114,9 @@ protected:
 	void printFile(const char *name);
 #endif
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
+	int32_t verifyVerboseGCAsynchronous();
+	int32_t verifyVerboseGCBinaryFile(const char *fileName, uintptr_t *gcEndCount);
+	int32_t verifyVerboseGCBinary();
 	int32_t parseGarbagePolicy(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
 	int32_t iniXMLStr(const char *configStyle);
@@ -82,6 +82,72 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 					extensions->allowMergedSpaces = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "packetListLockFree")) {
+					extensions->packetListLockFree = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "forceOldResize")) {
+					extensions->fvtest_forceOldResize = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "backgroundHeapCommit")) {
+					extensions->backgroundHeapCommit = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhWasteTargetPercent")) {
+					extensions->tlhWasteTargetPercent = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "binaryLogging")) {
+					extensions->binaryLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asyncLogging")) {
+					extensions->asyncLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asyncLoggingBufferSize")) {
+					extensions->asyncLoggingBufferSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "asyncLoggingOverflow")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "block")) {
+						extensions->asyncLoggingBlockOnOverflow = true;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "drop")) {
+						extensions->asyncLoggingBlockOnOverflow = false;
+					} else {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized asyncLoggingOverflow (expected block or drop): %s\n", attr.value());
+						result = false;
+					}
+				} else if (0 == strcmp(attr.name(), "freeEntryCache")) {
+					extensions->freeEntryCache = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "freeEntryCacheBatchSize")) {
+					extensions->freeEntryCacheBatchSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "numaAwareGCThreads")) {
+					extensions->numaAwareGCThreads = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "concurrentCompact")) {
+					extensions->concurrentCompact = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentCompactLiveThreshold")) {
+					extensions->concurrentCompactLiveThreshold = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "partialCompact")) {
+					extensions->partialCompact = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "partialCompactPauseTarget")) {
+					extensions->partialCompactPauseTarget = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "forceFragmentationCompact")) {
+					extensions->fvtest_forceFragmentationCompact = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+					if (extensions->fvtest_forceFragmentationCompact) {
+						/* compaction is disabled by default */
+						extensions->noCompactOnGlobalGC = 0;
+						extensions->nocompactOnSystemGC = 0;
+					}
+#endif /* OMR_GC_MODRON_COMPACTION */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+				} else if (0 == strcmp(attr.name(), "freeRegionRefillBatchSize")) {
+					extensions->freeRegionRefillBatchSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "sizeClassProfileFile")) {
+					if (!setSizeClassProfileFile(extensions, attr.value())) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed to set sizeClassProfileFile: %s\n", attr.value());
+						result = false;
+					}
+				} else if (0 == strcmp(attr.name(), "sizeClassProfileDumpFile")) {
+					if (!setSizeClassProfileDumpFile(extensions, attr.value())) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed to set sizeClassProfileDumpFile: %s\n", attr.value());
+						result = false;
+					}
+				} else if (0 == strcmp(attr.name(), "segregatedLazySweep")) {
+					extensions->segregatedLazySweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* OMR_GC_SEGREGATED_HEAP */
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
 					/* TODO: support multi-thread GC*/
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
@@ -91,8 +157,14 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+						_useSegregatedGC = true;
+#else
+						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=segregated ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, segregated or optavgpause): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -106,6 +178,10 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerPrefetchDistance")) {
+					extensions->scavengerPrefetchDistance = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerWorkStealing")) {
+					extensions->scavengerWorkStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
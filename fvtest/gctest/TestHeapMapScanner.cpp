@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "Bits.hpp"
+#include "HeapMapScanner.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+/* Reference implementation: the word at a time loop the bulk scan replaces */
+static uintptr_t *
+findNonEmptySlotByWord(uintptr_t *slot, uintptr_t *top)
+{
+	while ((slot < top) && (0 == *slot)) {
+		slot += 1;
+	}
+	return slot;
+}
+
+TEST(gcFunctionalTestHeapMapScanner, FindNonEmptySlot)
+{
+	const uintptr_t mapSlots = 4 * OMR_GC_HEAPMAP_SCAN_STRIDE_SLOTS + 3;
+	uintptr_t map[mapSlots + 1];
+
+	/* every start offset, including unaligned ones, against every position of a single set bit */
+	for (uintptr_t marked = 0; marked <= mapSlots; marked++) {
+		memset(map, 0, sizeof(map));
+		map[marked] = (uintptr_t)1 << (marked % J9BITS_BITS_IN_SLOT);
+		for (uintptr_t start = 0; start <= mapSlots; start++) {
+			uintptr_t *expected = findNonEmptySlotByWord(map + start, map + mapSlots);
+			ASSERT_EQ(expected, MM_HeapMapScanner::findNonEmptySlot(map + start, map + mapSlots))
+				<< "marked slot " << marked << " start slot " << start;
+		}
+	}
+
+	/* a set bit at or beyond top must not be reported */
+	memset(map, 0, sizeof(map));
+	map[mapSlots] = 1;
+	ASSERT_EQ(map + mapSlots, MM_HeapMapScanner::findNonEmptySlot(map, map + mapSlots));
+	ASSERT_EQ(map + 5, MM_HeapMapScanner::findNonEmptySlot(map + 5, map + 5));
+}
+
+/*
+ * Microbenchmark, not part of the functional suite. Run with --gtest_filter=gcPerfTestHeapMapScanner*
+ * Walks every free run of a 16MB map (a 1GB heap on 64 bit) for decreasing densities of marked slots.
+ */
+TEST(gcPerfTestHeapMapScanner, FreeRunWalk)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const uintptr_t mapSlots = (16 * 1024 * 1024) / sizeof(uintptr_t);
+	const uintptr_t iterations = 8;
+	uintptr_t *map = (uintptr_t *)omrmem_allocate_memory(mapSlots * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != map);
+
+	gcTestEnv->log(LEVEL_INFO, "heap map scan implementation: %s\n", MM_HeapMapScanner::getImplementationName());
+	for (uintptr_t markedEvery = 2; markedEvery <= 65536; markedEvery *= 8) {
+		memset(map, 0, mapSlots * sizeof(uintptr_t));
+		for (uintptr_t i = 0; i < mapSlots; i += markedEvery) {
+			map[i] = 1;
+		}
+
+		uint64_t wordTicks = 0;
+		uint64_t bulkTicks = 0;
+		uintptr_t wordRuns = 0;
+		uintptr_t bulkRuns = 0;
+		for (uintptr_t iteration = 0; iteration < iterations; iteration++) {
+			uint64_t start = omrtime_hires_clock();
+			for (uintptr_t *slot = map; slot < (map + mapSlots); slot += 1) {
+				slot = findNonEmptySlotByWord(slot, map + mapSlots);
+				wordRuns += 1;
+			}
+			uint64_t middle = omrtime_hires_clock();
+			for (uintptr_t *slot = map; slot < (map + mapSlots); slot += 1) {
+				slot = MM_HeapMapScanner::findNonEmptySlot(slot, map + mapSlots);
+				bulkRuns += 1;
+			}
+			uint64_t end = omrtime_hires_clock();
+			wordTicks += middle - start;
+			bulkTicks += end - middle;
+		}
+		ASSERT_EQ(wordRuns, bulkRuns);
+
+		uint64_t wordMicros = omrtime_hires_delta(0, wordTicks, OMRPORT_TIME_DELTA_IN_MICROSECONDS) / iterations;
+		uint64_t bulkMicros = omrtime_hires_delta(0, bulkTicks, OMRPORT_TIME_DELTA_IN_MICROSECONDS) / iterations;
+		gcTestEnv->log(LEVEL_INFO, "1 marked slot in %6zu: word at a time %7llu us, bulk %7llu us\n",
+				markedEvery, (unsigned long long)wordMicros, (unsigned long long)bulkMicros);
+	}
+
+	omrmem_free_memory(map);
+}
@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrcfg.h"
+
+#include "Forge.hpp"
+#include "SizeClassProfile.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+static const uintptr_t defaultCellSizes[OMR_SIZECLASSES_NUM_SMALL+1] = SMALL_SIZECLASSES;
+static const uintptr_t regionSize = 64 * 1024;
+
+/* Reference implementation: the memory lost by a histogram to the given cell sizes, counted as the generator does */
+static double
+fragmentation(const uintptr_t *histogram, const uintptr_t *cellSizes)
+{
+	double waste = 0.0;
+	uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL;
+	for (uintptr_t granules = 0; granules < SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH; granules++) {
+		uintptr_t size = granules * SIZE_CLASS_PROFILE_GRANULE;
+		while (cellSizes[sizeClass] < size) {
+			sizeClass += 1;
+		}
+		uintptr_t cellSize = cellSizes[sizeClass];
+		double cellCost = (double)cellSize + ((double)(regionSize % cellSize) / (double)(regionSize / cellSize));
+		waste += (double)histogram[granules] * (cellCost - (double)size);
+	}
+	return waste;
+}
+
+static void
+expectValidCellSizes(const uintptr_t *cellSizes)
+{
+	EXPECT_EQ(0u, cellSizes[0]);
+	EXPECT_LE(defaultCellSizes[OMR_SIZECLASSES_MIN_SMALL], cellSizes[OMR_SIZECLASSES_MIN_SMALL]);
+	EXPECT_EQ((uintptr_t)OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES, cellSizes[OMR_SIZECLASSES_MAX_SMALL]);
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		EXPECT_EQ(0u, cellSizes[sizeClass] % SIZE_CLASS_PROFILE_GRANULE) << "size class " << sizeClass;
+		EXPECT_LT(cellSizes[sizeClass - 1], cellSizes[sizeClass]) << "size class " << sizeClass;
+	}
+}
+
+/* moving any one boundary by a granule must not lose less memory than the generated cell sizes */
+static void
+expectLocallyOptimal(const uintptr_t *histogram, const uintptr_t *cellSizes)
+{
+	double waste = fragmentation(histogram, cellSizes);
+	uintptr_t candidate[OMR_SIZECLASSES_NUM_SMALL+1];
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass < OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		for (intptr_t step = -1; step <= 1; step += 2) {
+			memcpy(candidate, cellSizes, sizeof(candidate));
+			candidate[sizeClass] += step * SIZE_CLASS_PROFILE_GRANULE;
+			if ((candidate[sizeClass] > candidate[sizeClass - 1])
+				&& (candidate[sizeClass] < candidate[sizeClass + 1])
+				&& (candidate[sizeClass] >= defaultCellSizes[OMR_SIZECLASSES_MIN_SMALL])
+			) {
+				EXPECT_LE(waste, fragmentation(histogram, candidate)) << "size class " << sizeClass << " moved by " << step;
+			}
+		}
+	}
+}
+
+TEST(gcFunctionalTestSizeClassProfile, EmptyProfile)
+{
+	OMR::GC::Forge forge;
+	ASSERT_TRUE(forge.initialize(gcTestEnv->getPortLibrary()));
+
+	uintptr_t histogram[SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH];
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL+1];
+	memset(histogram, 0, sizeof(histogram));
+	EXPECT_FALSE(MM_SizeClassProfile::generateCellSizes(&forge, regionSize, histogram, cellSizes));
+
+	forge.tearDown();
+}
+
+TEST(gcFunctionalTestSizeClassProfile, ExactSizes)
+{
+	OMR::GC::Forge forge;
+	ASSERT_TRUE(forge.initialize(gcTestEnv->getPortLibrary()));
+
+	/* power of two cells fill regions exactly, so a profile of only those sizes can be fitted without loss */
+	uintptr_t histogram[SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH];
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL+1];
+	memset(histogram, 0, sizeof(histogram));
+	for (uintptr_t size = 16; size <= OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES; size *= 2) {
+		histogram[size / SIZE_CLASS_PROFILE_GRANULE] = 4096 / size;
+	}
+	ASSERT_TRUE(MM_SizeClassProfile::generateCellSizes(&forge, regionSize, histogram, cellSizes));
+
+	expectValidCellSizes(cellSizes);
+	EXPECT_EQ(0.0, fragmentation(histogram, cellSizes));
+	for (uintptr_t size = 16; size <= OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES; size *= 2) {
+		bool found = false;
+		for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+			found |= (size == cellSizes[sizeClass]);
+		}
+		EXPECT_TRUE(found) << "no size class for " << size;
+	}
+
+	forge.tearDown();
+}
+
+TEST(gcFunctionalTestSizeClassProfile, SkewedProfile)
+{
+	OMR::GC::Forge forge;
+	ASSERT_TRUE(forge.initialize(gcTestEnv->getPortLibrary()));
+
+	/* mostly small objects of a few hot sizes over a tail of every size, in object header sized steps */
+	uintptr_t histogram[SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH];
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL+1];
+	memset(histogram, 0, sizeof(histogram));
+	uint32_t seed = 12345;
+	for (uintptr_t granules = 1; granules < SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH; granules++) {
+		seed = (seed * 1103515245) + 12345;
+		histogram[granules] = (seed >> 16) % (4000 / granules + 1);
+	}
+	histogram[24 / SIZE_CLASS_PROFILE_GRANULE] += 50000;
+	histogram[40 / SIZE_CLASS_PROFILE_GRANULE] += 20000;
+	histogram[136 / SIZE_CLASS_PROFILE_GRANULE] += 8000;
+	histogram[1024 / SIZE_CLASS_PROFILE_GRANULE] += 2000;
+	ASSERT_TRUE(MM_SizeClassProfile::generateCellSizes(&forge, regionSize, histogram, cellSizes));
+
+	expectValidCellSizes(cellSizes);
+	EXPECT_GE(fragmentation(histogram, defaultCellSizes), fragmentation(histogram, cellSizes));
+	expectLocallyOptimal(histogram, cellSizes);
+	const uintptr_t hotSizes[] = {24, 40, 136, 1024};
+	for (uintptr_t i = 0; i < sizeof(hotSizes) / sizeof(hotSizes[0]); i++) {
+		bool found = false;
+		for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+			found |= (hotSizes[i] == cellSizes[sizeClass]);
+		}
+		EXPECT_TRUE(found) << "no size class for hot size " << hotSizes[i];
+	}
+
+	forge.tearDown();
+}
+
+TEST(gcFunctionalTestSizeClassProfile, Merge)
+{
+	uintptr_t histogram[SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH];
+	uintptr_t threadHistogram[SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH];
+	memset(histogram, 0, sizeof(histogram));
+	memset(threadHistogram, 0, sizeof(threadHistogram));
+
+	MM_SizeClassProfile::record(histogram, 17);
+	MM_SizeClassProfile::record(threadHistogram, 17);
+	MM_SizeClassProfile::record(threadHistogram, 24);
+	MM_SizeClassProfile::record(threadHistogram, OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES);
+	MM_SizeClassProfile::merge(histogram, threadHistogram);
+
+	EXPECT_EQ(3u, histogram[3]);
+	EXPECT_EQ(1u, histogram[SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH - 1]);
+	for (uintptr_t granules = 0; granules < SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH; granules++) {
+		EXPECT_EQ(0u, threadHistogram[granules]);
+	}
+}
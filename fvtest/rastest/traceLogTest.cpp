@@ -19,6 +19,7 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <stdlib.h>
 #include <string.h>
 
 #include "omrport.h"
@@ -27,6 +28,7 @@
 #include "omrTest.h"
 #include "omrTestHelpers.h"
 #include "omrtrace.h"
+#include "omrtraceformat.h"
 #include "omrvm.h"
 #include "ut_omr_test.h"
 
@@ -40,10 +42,16 @@
  * - Filling trace buffers
  * - Wrapping tracepoints across multiple trace buffers
  * - Verifies the contents of trace records sent to subscribers
+ * - Rolling tracepoints through trace buffers in a memory mapped trace file
+ * - Publishing memory mapped trace buffers while other threads claim them
+ * - Measuring the cost of enabled and disabled tracepoints
  */
 
 #define TRACE_BUFFER_BYTES 1024
 #define NUM_CHILD_THREADS 4
+#define MAPPED_TRACE_FILE "traceLogTestMapped.trc"
+#define MAPPED_TRACEPOINT_COUNT 2000
+#define TRACEPOINT_COST_ITERATIONS 1000000
 
 /* Test data */
 typedef struct TestChildThreadData {
@@ -56,6 +64,7 @@ typedef struct TestChildThreadData {
 	int expectedLoggedCount;
 	int loggedCount;
 	int unloggedCount;
+	int modifiedRecordCount;
 	PerThreadWrapBuffer wrapBuffer;
 } TestChildThreadData;
 
@@ -69,11 +78,14 @@ static omr_error_t waitForChildThread(OMRTestVM *testVM, omrthread_t childThread
 static int J9THREAD_PROC childThreadMain(void *entryArg);
 
 static omr_error_t countTracepoints(UtSubscription *subscriptionID);
+static omr_error_t countUnchangingTracepoints(UtSubscription *subscriptionID);
 static omr_error_t countTracepointsIter(void *userData, const char *tpMod, const uint32_t tpModLength, const uint32_t tpId,
 										const UtTraceRecord *record, uint32_t firstParameterOffset, uint32_t parameterDataLength,
 										int32_t isBigEndian);
 static omr_error_t failOnSecondCall(UtSubscription *subscriptionID);
 static void failOnSecondCallAlarm(UtSubscription *subscriptionID);
+static char *getMappedTestFormatString(const char *componentName, int32_t tracepoint);
+static uint64_t timeTracepoints(OMRPortLibrary *portLibrary, OMR_VMThread *vmthread, uint32_t iterations);
 
 static const char *lowercaseAlpha = "abcdefghijklmnopqrstuvwxyz";
 static const char *uppercaseAlpha = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
@@ -244,6 +256,179 @@ TEST(TraceLogTest, stressTraceBufferManagement)
 	omrfile_unlink("traceLogTest.trc");
 }
 
+TEST(TraceLogTest, rollMappedTraceFile)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
+	OMRTestVM testVM;
+	OMR_VMThread *vmthread = NULL;
+	char text[32];
+
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMInit(&testVM, OMRPORTLIB));
+
+	/* Trace options:
+	 *
+	 * buffers=1k, mappedfile=...,16k: The file holds about a dozen trace buffers, which the tracepoints
+	 * below fill several times over, so the oldest buffers are reused.
+	 */
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initTraceEngine(&testVM.omrVM, "buffers=1k:maximal=all:maximal=!j9thr:mappedfile=" MAPPED_TRACE_FILE ",16k", NULL));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Init(&testVM.omrVM, NULL, &vmthread, "rollMappedTraceFile"));
+
+	UT_OMR_TEST_MODULE_LOADED(testVM.omrVM._trcEngine->utIntf);
+	for (int i = 0; i < MAPPED_TRACEPOINT_COUNT; i += 1) {
+		omrstr_printf(text, sizeof(text), "tp %05d", i);
+		Trc_OMR_Test_String(vmthread, text);
+	}
+	UT_OMR_TEST_MODULE_UNLOADED(testVM.omrVM._trcEngine->utIntf);
+
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_cleanupTraceEngine(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Free(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMFini(&testVM));
+
+	/* Format the mapped file. Buffers come oldest first, tracepoints within a buffer newest first. */
+	UtTraceFileIterator *fileIterator = NULL;
+	UtTracePointIterator *bufferIterator = NULL;
+	char formatted[256];
+	int formattedCount = 0;
+	int oldest = MAPPED_TRACEPOINT_COUNT;
+	int newest = -1;
+
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_getTraceFileIterator(OMRPORTLIB, (char *)MAPPED_TRACE_FILE, &fileIterator, getMappedTestFormatString));
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_getTracePointIteratorForNextBuffer(fileIterator, &bufferIterator));
+	while (NULL != bufferIterator) {
+		int bufferOldest = MAPPED_TRACEPOINT_COUNT;
+		int bufferNewest = -1;
+
+		while (NULL != omr_trc_formatNextTracePoint(bufferIterator, formatted, sizeof(formatted))) {
+			const char *tp = strstr(formatted, "String: tp ");
+			if (NULL != tp) {
+				int number = atoi(tp + strlen("String: tp "));
+				bufferOldest = OMR_MIN(bufferOldest, number);
+				bufferNewest = OMR_MAX(bufferNewest, number);
+				formattedCount += 1;
+			}
+		}
+		if (bufferNewest >= 0) {
+			ASSERT_LT(newest, bufferOldest) << "trace buffers out of order";
+			oldest = OMR_MIN(oldest, bufferOldest);
+			newest = bufferNewest;
+		}
+
+		OMRTEST_ASSERT_ERROR_NONE(omr_trc_freeTracePointIterator(bufferIterator));
+		OMRTEST_ASSERT_ERROR_NONE(omr_trc_getTracePointIteratorForNextBuffer(fileIterator, &bufferIterator));
+	}
+	OMRTEST_ASSERT_ERROR_NONE(omr_trc_freeTraceFileIterator(fileIterator));
+
+	/* The newest tracepoints survive, the oldest were overwritten */
+	ASSERT_EQ(MAPPED_TRACEPOINT_COUNT - 1, newest);
+	ASSERT_LT(0, oldest);
+	ASSERT_LT(0, formattedCount);
+
+	/* Clean up trace file */
+	omrfile_unlink(MAPPED_TRACE_FILE);
+}
+
+TEST(TraceLogTest, publishMappedTraceBuffers)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
+	OMRTestVM testVM;
+	OMR_VMThread *vmthread = NULL;
+
+	const OMR_TI *ti = omr_agent_getTI();
+
+	omrthread_t childThread[NUM_CHILD_THREADS];
+	TestChildThreadData childData[NUM_CHILD_THREADS];
+	UtSubscription *subscriptionID[NUM_CHILD_THREADS];
+
+	memset(childData, 0, sizeof(TestChildThreadData) * NUM_CHILD_THREADS);
+	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
+		childData[i].testVM = &testVM;
+		childData[i].childRc = OMR_ERROR_NONE;
+		initWrapBuffer(&childData[i].wrapBuffer);
+	}
+	childData[0].traceDataCount = 1;
+	childData[0].traceData = &lowercaseAlpha;
+	childData[1].traceDataCount = 1;
+	childData[1].traceData = &uppercaseAlpha;
+	childData[2].traceDataCount = sizeof(ibmText1) / sizeof(ibmText1[0]);
+	childData[2].traceData = ibmText1;
+	childData[3].traceDataCount = sizeof(ibmText2) / sizeof(ibmText2[0]);
+	childData[3].traceData = ibmText2;
+
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMInit(&testVM, OMRPORTLIB));
+
+	/* Trace options:
+	 *
+	 * buffers=1k, mappedfile=...,1k: The file holds the minimum of two buffers, fewer than there are child
+	 * threads, so whenever a buffer is published another thread is waiting to claim it. With subscribers
+	 * registered each full buffer is published before it is released.
+	 */
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initTraceEngine(&testVM.omrVM, "buffers=1k:maximal=all:maximal=!j9thr:mappedfile=" MAPPED_TRACE_FILE ",1k", NULL));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Init(&testVM.omrVM, NULL, &vmthread, "publishMappedTraceBuffers"));
+
+	UT_OMR_TEST_MODULE_LOADED(testVM.omrVM._trcEngine->utIntf);
+
+	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
+		ASSERT_NO_FATAL_FAILURE(startChildThread(&testVM, &childThread[i], childThreadMain, &childData[i]));
+		OMRTEST_ASSERT_ERROR_NONE(
+			ti->RegisterRecordSubscriber(vmthread, "child", countUnchangingTracepoints, NULL, (void *)&childData[i], &subscriptionID[i]));
+	}
+	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
+		ASSERT_EQ(1, omrthread_resume(childThread[i]));
+	}
+	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
+		OMRTEST_ASSERT_ERROR_NONE(waitForChildThread(&testVM, childThread[i], &childData[i]));
+	}
+
+	UT_OMR_TEST_MODULE_UNLOADED(testVM.omrVM._trcEngine->utIntf);
+
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_cleanupTraceEngine(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Free(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMFini(&testVM));
+
+	/* No buffer may be claimed again while a subscriber reads it, so every tracepoint arrives intact */
+	for (size_t i = 0; i < NUM_CHILD_THREADS; i += 1) {
+		ASSERT_EQ(0, childData[i].modifiedRecordCount);
+		ASSERT_EQ(childData[i].expectedLoggedCount, childData[i].loggedCount);
+		ASSERT_EQ(0, childData[i].unloggedCount);
+		freeWrapBuffer(&childData[i].wrapBuffer);
+	}
+
+	/* Clean up trace file */
+	omrfile_unlink(MAPPED_TRACE_FILE);
+}
+
+TEST(TraceLogTest, tracepointCost)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(rasTestEnv->getPortLibrary());
+	OMRTestVM testVM;
+	OMR_VMThread *vmthread = NULL;
+
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMInit(&testVM, OMRPORTLIB));
+
+	/* Trace options:
+	 *
+	 * No subscribers are registered, so tracepoints wrap in the thread's own buffer.
+	 */
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initTraceEngine(&testVM.omrVM, "maximal=all:maximal=!j9thr", NULL));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Init(&testVM.omrVM, NULL, &vmthread, "tracepointCost"));
+
+	/* The omr_test tracepoints are disabled until the module is loaded */
+	uint64_t disabledNanos = timeTracepoints(OMRPORTLIB, vmthread, TRACEPOINT_COST_ITERATIONS);
+
+	UT_OMR_TEST_MODULE_LOADED(testVM.omrVM._trcEngine->utIntf);
+	/* warm up, so the thread's trace buffer is allocated before timing starts */
+	timeTracepoints(OMRPORTLIB, vmthread, TRACEPOINT_COST_ITERATIONS / 10);
+	uint64_t enabledNanos = timeTracepoints(OMRPORTLIB, vmthread, TRACEPOINT_COST_ITERATIONS);
+	UT_OMR_TEST_MODULE_UNLOADED(testVM.omrVM._trcEngine->utIntf);
+
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_cleanupTraceEngine(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Free(vmthread));
+	OMRTEST_ASSERT_ERROR_NONE(omrTestVMFini(&testVM));
+
+	printf("Tracepoint cost over %u tracepoints: disabled %.2f ns, enabled %.2f ns\n", TRACEPOINT_COST_ITERATIONS,
+		(double)disabledNanos / TRACEPOINT_COST_ITERATIONS, (double)enabledNanos / TRACEPOINT_COST_ITERATIONS);
+}
+
 static void
 startChildThread(OMRTestVM *testVM, omrthread_t *childThread, omrthread_entrypoint_t entryProc, TestChildThreadData *childData)
 {
@@ -360,6 +545,31 @@ countTracepoints(UtSubscription *subscriptionID)
 	return OMR_ERROR_NONE;
 }
 
+/*
+ * Count tracepoints as countTracepoints() does, and count the records that changed while they were read.
+ */
+static omr_error_t
+countUnchangingTracepoints(UtSubscription *subscriptionID)
+{
+	TestChildThreadData *childData = (TestChildThreadData *)subscriptionID->userData;
+	const UtTraceRecord *traceRecord = (const UtTraceRecord *)subscriptionID->data;
+	const uint64_t threadSyn1 = traceRecord->threadSyn1;
+	const uint64_t wrapSequence = traceRecord->wrapSequence;
+	const int32_t nextEntry = traceRecord->nextEntry;
+
+	omr_error_t rc = countTracepoints(subscriptionID);
+
+	/* give other threads the chance to claim the buffer */
+	omrthread_yield();
+	if ((threadSyn1 != traceRecord->threadSyn1)
+		|| (wrapSequence != traceRecord->wrapSequence)
+		|| (nextEntry != traceRecord->nextEntry)
+	) {
+		childData->modifiedRecordCount += 1;
+	}
+	return rc;
+}
+
 /*
  * Fail on 2nd call
  * Count the number of calls
@@ -384,3 +594,26 @@ failOnSecondCallAlarm(UtSubscription *subscriptionID)
 
 	VM_AtomicSupport::addU32(&failData->alarmCount, 1);
 }
+
+static char *
+getMappedTestFormatString(const char *componentName, int32_t tracepoint)
+{
+	/* Only the omr_test String tracepoint is checked */
+	if ((0 == strcmp("omr_test", componentName)) && (1 == tracepoint)) {
+		return (char *)"String: %s";
+	}
+	return (char *)"UNKNOWN TRACEPOINT ID";
+}
+
+static uint64_t
+timeTracepoints(OMRPortLibrary *portLibrary, OMR_VMThread *vmthread, uint32_t iterations)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uint64_t start = omrtime_nano_time();
+
+	for (uint32_t i = 0; i < iterations; i += 1) {
+		Trc_OMR_Test_Int(vmthread, i);
+	}
+
+	return omrtime_nano_time() - start;
+}
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <stdio.h>
+
+#include "omrTest.h"
+#include "thread_api.h"
+#include "threadExtendedTestHelpers.hpp"
+
+#define BENCH_THREADS 4
+#define UNCONTENDED_ITERATIONS 1000000
+#define CONTENDED_ITERATIONS 100000
+
+typedef struct MonitorBenchmarkInfo {
+	omrthread_monitor_t monitor;
+	omrthread_monitor_t synchronization;
+	uintptr_t counter;
+	uintptr_t running;
+} MonitorBenchmarkInfo;
+
+static int J9THREAD_PROC
+contendedWorker(void *arg)
+{
+	MonitorBenchmarkInfo *info = (MonitorBenchmarkInfo *)arg;
+	uintptr_t i = 0;
+
+	for (i = 0; i < CONTENDED_ITERATIONS; i++) {
+		omrthread_monitor_enter(info->monitor);
+		info->counter += 1;
+		omrthread_monitor_exit(info->monitor);
+	}
+
+	/* Inform the main thread that we are done */
+	omrthread_monitor_enter(info->synchronization);
+	info->running -= 1;
+	if (0 == info->running) {
+		omrthread_monitor_notify_all(info->synchronization);
+	}
+	omrthread_monitor_exit(info->synchronization);
+
+	return 0;
+}
+
+/**
+ * Time uncontended and contended enter/exit on monitors created with the
+ * current thread library settings, and check that no update was lost.
+ */
+static void
+benchmarkMonitors(const char *label)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	MonitorBenchmarkInfo info;
+	uint64_t start = 0;
+	uint64_t uncontendedMicros = 0;
+	uint64_t contendedMicros = 0;
+	uintptr_t i = 0;
+
+	memset(&info, 0, sizeof(info));
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&info.monitor, 0, "monitor benchmark"));
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&info.synchronization, 0, "monitor benchmark synchronization"));
+
+	start = omrtime_hires_clock();
+	for (i = 0; i < UNCONTENDED_ITERATIONS; i++) {
+		omrthread_monitor_enter(info.monitor);
+		omrthread_monitor_exit(info.monitor);
+	}
+	uncontendedMicros = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	omrthread_monitor_enter(info.synchronization);
+	info.running = BENCH_THREADS;
+	start = omrtime_hires_clock();
+	for (i = 0; i < BENCH_THREADS; i++) {
+		omrthread_t thread = NULL;
+		ASSERT_EQ(0, omrthread_create_ex(&thread, J9THREAD_ATTR_DEFAULT, 0, contendedWorker, &info));
+	}
+	while (0 != info.running) {
+		omrthread_monitor_wait(info.synchronization);
+	}
+	contendedMicros = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	omrthread_monitor_exit(info.synchronization);
+
+	ASSERT_EQ((uintptr_t)(BENCH_THREADS * CONTENDED_ITERATIONS), info.counter);
+
+	printf("%s monitors: uncontended %llu us for %d enter/exit, %d threads contended %llu us for %d enter/exit each\n",
+		label, (unsigned long long)uncontendedMicros, UNCONTENDED_ITERATIONS,
+		BENCH_THREADS, (unsigned long long)contendedMicros, CONTENDED_ITERATIONS);
+
+	omrthread_monitor_destroy(info.synchronization);
+	omrthread_monitor_destroy(info.monitor);
+}
+
+/**
+ * Compare the default monitors with futex monitors where the build supports them.
+ * Timings are reported but not checked.
+ */
+TEST(ThreadExtendedTest, TestMonitorBenchmark)
+{
+	benchmarkMonitors("default");
+
+	if (0 == omrthread_lib_control(J9THREAD_LIB_CONTROL_USE_FUTEX_MONITORS, J9THREAD_LIB_CONTROL_USE_FUTEX_MONITORS_ENABLED)) {
+		benchmarkMonitors("futex");
+		ASSERT_EQ(0, omrthread_lib_control(J9THREAD_LIB_CONTROL_USE_FUTEX_MONITORS, J9THREAD_LIB_CONTROL_USE_FUTEX_MONITORS_DISABLED));
+	} else {
+		printf("futex monitors: not supported by this build\n");
+	}
+}
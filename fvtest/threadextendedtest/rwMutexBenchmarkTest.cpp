@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <stdio.h>
+
+#include "omrTest.h"
+#include "thread_api.h"
+#include "threadExtendedTestHelpers.hpp"
+
+#define BENCH_MAX_THREADS 128
+#define READ_ITERATIONS 20000
+
+typedef struct RWMutexBenchmarkInfo {
+	omrthread_rwmutex_t handle;
+	omrthread_monitor_t synchronization;
+	volatile uintptr_t started;
+	uintptr_t running;
+	uintptr_t readsCompleted;
+} RWMutexBenchmarkInfo;
+
+static int J9THREAD_PROC
+readWorker(void *arg)
+{
+	RWMutexBenchmarkInfo *info = (RWMutexBenchmarkInfo *)arg;
+	uintptr_t i = 0;
+
+	/* Wait for the main thread to start all workers together */
+	omrthread_monitor_enter(info->synchronization);
+	while (0 == info->started) {
+		omrthread_monitor_wait(info->synchronization);
+	}
+	omrthread_monitor_exit(info->synchronization);
+
+	for (i = 0; i < READ_ITERATIONS; i++) {
+		omrthread_rwmutex_enter_read(info->handle);
+		omrthread_rwmutex_exit_read(info->handle);
+	}
+
+	/* Inform the main thread that we are done */
+	omrthread_monitor_enter(info->synchronization);
+	info->readsCompleted += READ_ITERATIONS;
+	info->running -= 1;
+	if (0 == info->running) {
+		omrthread_monitor_notify_all(info->synchronization);
+	}
+	omrthread_monitor_exit(info->synchronization);
+
+	return 0;
+}
+
+/**
+ * Time read enter/exit on a rwmutex created with the given flags using
+ * 1 to BENCH_MAX_THREADS concurrent readers.
+ */
+static void
+benchmarkReadScaling(const char *label, uintptr_t flags)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	uintptr_t threads = 0;
+
+	for (threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2) {
+		RWMutexBenchmarkInfo info;
+		uint64_t start = 0;
+		uint64_t micros = 0;
+		uintptr_t i = 0;
+
+		memset(&info, 0, sizeof(info));
+		ASSERT_EQ(0, omrthread_rwmutex_init(&info.handle, flags, "rwmutex benchmark"));
+		ASSERT_EQ(0, omrthread_monitor_init_with_name(&info.synchronization, 0, "rwmutex benchmark synchronization"));
+
+		info.running = threads;
+		for (i = 0; i < threads; i++) {
+			omrthread_t thread = NULL;
+			ASSERT_EQ(0, omrthread_create_ex(&thread, J9THREAD_ATTR_DEFAULT, 0, readWorker, &info));
+		}
+
+		omrthread_monitor_enter(info.synchronization);
+		start = omrtime_hires_clock();
+		info.started = 1;
+		omrthread_monitor_notify_all(info.synchronization);
+		while (0 != info.running) {
+			omrthread_monitor_wait(info.synchronization);
+		}
+		micros = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		omrthread_monitor_exit(info.synchronization);
+
+		ASSERT_EQ(threads * READ_ITERATIONS, info.readsCompleted);
+		ASSERT_FALSE(omrthread_rwmutex_is_writelocked(info.handle));
+
+		/* a writer must still get in once every reader has left */
+		ASSERT_EQ(0, omrthread_rwmutex_try_enter_write(info.handle));
+		ASSERT_EQ(0, omrthread_rwmutex_exit_write(info.handle));
+
+		printf("%s rwmutex: %3d readers %8llu us for %d read enter/exit each\n",
+			label, (int)threads, (unsigned long long)micros, READ_ITERATIONS);
+
+		omrthread_monitor_destroy(info.synchronization);
+		ASSERT_EQ(0, omrthread_rwmutex_destroy(info.handle));
+	}
+}
+
+/**
+ * Compare read scaling of the default rwmutex with the reader biased one.
+ * Timings are reported but not checked.
+ */
+TEST(ThreadExtendedTest, TestRWMutexReadScaling)
+{
+	benchmarkReadScaling("default", 0);
+	benchmarkReadScaling("reader biased", J9THREAD_RWMUTEX_READER_BIASED);
+}
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <stdio.h>
+
+#include "omrTest.h"
+#include "omrutilbase.h"
+#include "thread_api.h"
+#include "threadExtendedTestHelpers.hpp"
+
+#define BENCH_MAX_WORKERS 8
+#define THROUGHPUT_TASKS 200000
+#define LATENCY_ROUND_TRIPS 10000
+
+static void
+countTask(void *arg)
+{
+	addAtomic((volatile uintptr_t *)arg, 1);
+}
+
+/**
+ * Time batches of small tasks on pools of 1 to BENCH_MAX_WORKERS workers.
+ */
+static void
+benchmarkThroughput(void)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	void **args = new void *[THROUGHPUT_TASKS];
+	volatile uintptr_t counter = 0;
+	uintptr_t workers = 0;
+	uintptr_t i = 0;
+
+	for (i = 0; i < THROUGHPUT_TASKS; i++) {
+		args[i] = (void *)&counter;
+	}
+
+	for (workers = 1; workers <= BENCH_MAX_WORKERS; workers *= 2) {
+		omrthread_pool_t pool = NULL;
+		omrthread_waitgroup_t group = NULL;
+		uint64_t start = 0;
+		uint64_t batchMicros = 0;
+		uint64_t singleMicros = 0;
+
+		counter = 0;
+		ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_create(&pool, workers, J9THREAD_PRIORITY_NORMAL, J9THREAD_POOL_NUMA_AWARE, "pool benchmark"));
+		ASSERT_EQ(J9THREAD_POOL_OK, omrthread_waitgroup_init(&group, "pool benchmark group"));
+
+		start = omrtime_hires_clock();
+		ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_submit_batch(pool, countTask, args, THROUGHPUT_TASKS, group));
+		omrthread_pool_wait(pool, group);
+		batchMicros = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+		start = omrtime_hires_clock();
+		for (i = 0; i < THROUGHPUT_TASKS; i++) {
+			omrthread_pool_submit(pool, countTask, (void *)&counter, group);
+		}
+		omrthread_pool_wait(pool, group);
+		singleMicros = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+		ASSERT_EQ((uintptr_t)(2 * THROUGHPUT_TASKS), counter);
+		printf("thread pool throughput: %d workers, %d tasks in %llu us batched, %llu us submitted singly\n",
+			(int)workers, THROUGHPUT_TASKS, (unsigned long long)batchMicros, (unsigned long long)singleMicros);
+
+		omrthread_waitgroup_destroy(group);
+		omrthread_pool_destroy(pool);
+	}
+
+	delete[] args;
+}
+
+/**
+ * Time the round trip of submitting one task to an idle pool and waiting for it,
+ * which includes unparking a worker.
+ */
+static void
+benchmarkLatency(void)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	omrthread_pool_t pool = NULL;
+	omrthread_waitgroup_t group = NULL;
+	volatile uintptr_t counter = 0;
+	uint64_t start = 0;
+	uint64_t micros = 0;
+	uintptr_t i = 0;
+
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_create(&pool, 2, J9THREAD_PRIORITY_NORMAL, 0, "pool latency benchmark"));
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_waitgroup_init(&group, "pool latency benchmark group"));
+
+	start = omrtime_hires_clock();
+	for (i = 0; i < LATENCY_ROUND_TRIPS; i++) {
+		omrthread_pool_submit(pool, countTask, (void *)&counter, group);
+		/* a plain wait, so the task always runs on a worker */
+		omrthread_waitgroup_wait(group);
+	}
+	micros = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	ASSERT_EQ((uintptr_t)LATENCY_ROUND_TRIPS, counter);
+	printf("thread pool latency: %d submit/wait round trips in %llu us\n",
+		LATENCY_ROUND_TRIPS, (unsigned long long)micros);
+
+	omrthread_waitgroup_destroy(group);
+	omrthread_pool_destroy(pool);
+}
+
+/**
+ * Report thread pool throughput and latency. Timings are reported but not checked.
+ */
+TEST(ThreadExtendedTest, TestThreadPoolBenchmark)
+{
+	benchmarkThroughput();
+	benchmarkLatency();
+}
@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrTest.h"
+#include "omrutilbase.h"
+#include "threadTestLib.hpp"
+
+#if defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_JLM_HOLD_TIMES)
+
+/*
+ * Verifies that adaptive spin tuning learns a per-monitor spin budget:
+ * blocked enters with short hold times grow the budget, long hold times
+ * switch the monitor to blocking immediately, and short hold times restore
+ * the learned budget again.
+ */
+
+#define CONTENDED_HOLD_MILLIS 50
+#define LONG_HOLD_MILLIS 100
+
+typedef struct HoldInfo {
+	omrthread_monitor_t monitor;
+	omrthread_monitor_t sync;
+	volatile uintptr_t held;
+} HoldInfo;
+
+static int J9THREAD_PROC
+holdMonitor(void *arg)
+{
+	HoldInfo *info = (HoldInfo *)arg;
+
+	omrthread_monitor_enter(info->monitor);
+
+	omrthread_monitor_enter(info->sync);
+	info->held = 1;
+	omrthread_monitor_notify_all(info->sync);
+	omrthread_monitor_exit(info->sync);
+
+	omrthread_sleep(CONTENDED_HOLD_MILLIS);
+	omrthread_monitor_exit(info->monitor);
+	return 0;
+}
+
+class AdaptiveSpinTuneTest: public ::testing::Test
+{
+protected:
+	HoldInfo info;
+	omrthread_library_t lib;
+	uintptr_t savedTuneHoldtime;
+	uintptr_t savedHoldtime;
+
+	virtual void
+	SetUp()
+	{
+		uint64_t start = 0;
+		uintptr_t ticksPerMilli = 0;
+
+		lib = omrthread_self()->library;
+		savedTuneHoldtime = lib->adaptSpinTuneHoldtime;
+		savedHoldtime = lib->adaptSpinHoldtime;
+
+		/* Hold times are in timebase ticks: spin for holds under 1ms, block for holds over 4ms */
+		start = getTimebase();
+		omrthread_sleep(10);
+		ticksPerMilli = (uintptr_t)((getTimebase() - start) / 10);
+		ASSERT_TRUE(ticksPerMilli > 0);
+		lib->adaptSpinTuneHoldtime = ticksPerMilli;
+		lib->adaptSpinHoldtime = 4 * ticksPerMilli;
+
+		*(uintptr_t *)omrthread_global((char *)"adaptSpinTuneEnable") = 1;
+		ASSERT_EQ(0, jlm_adaptive_spin_init());
+
+		info.held = 0;
+		ASSERT_EQ(0, omrthread_monitor_init_with_name(&info.monitor, 0, "adaptive spin tune monitor"));
+		ASSERT_EQ(0, omrthread_monitor_init_with_name(&info.sync, 0, "adaptive spin tune sync"));
+		ASSERT_TRUE(NULL != info.monitor->tracing);
+	}
+
+	virtual void
+	TearDown()
+	{
+		omrthread_monitor_destroy(info.sync);
+		omrthread_monitor_destroy(info.monitor);
+
+		omrthread_lib_clear_flags(J9THREAD_LIB_FLAG_ADAPT_SPIN_TUNING_ENABLED | J9THREAD_LIB_FLAG_JLM_HOLDTIME_SAMPLING_ENABLED);
+		*(uintptr_t *)omrthread_global((char *)"adaptSpinTuneEnable") = 0;
+		lib->adaptSpinTuneHoldtime = savedTuneHoldtime;
+		lib->adaptSpinHoldtime = savedHoldtime;
+	}
+
+	/*
+	 * Block on the monitor while another thread holds it, then release it
+	 * straight away. Only this thread's enter is sampled, so the tuning sees
+	 * a blocked enter followed by a short hold.
+	 */
+	void
+	contendedShortHold(void)
+	{
+		omrthread_t holder = NULL;
+
+		info.monitor->flags |= J9THREAD_MONITOR_STOP_SAMPLING;
+		info.held = 0;
+		ASSERT_EQ(0, omrthread_create_ex(&holder, J9THREAD_ATTR_DEFAULT, 0, holdMonitor, &info));
+
+		omrthread_monitor_enter(info.sync);
+		while (0 == info.held) {
+			omrthread_monitor_wait(info.sync);
+		}
+		omrthread_monitor_exit(info.sync);
+
+		info.monitor->flags &= ~J9THREAD_MONITOR_STOP_SAMPLING;
+		omrthread_monitor_enter(info.monitor);
+		omrthread_monitor_exit(info.monitor);
+	}
+};
+
+TEST_F(AdaptiveSpinTuneTest, TestLearnSpinBudget)
+{
+	J9ThreadMonitorTracing *tracing = info.monitor->tracing;
+	uintptr_t expected = info.monitor->spinCount3;
+	uintptr_t max = lib->defaultMonitorSpinCount3 * OMRTHREAD_ADAPT_SPIN_TUNE_MAX_RATIO;
+	uintptr_t i = 0;
+
+	/* Short critical sections that still block grow the budget up to the ceiling */
+	for (i = 0; i < 4; i++) {
+		contendedShortHold();
+		expected = OMR_MIN(expected * 2, max);
+		ASSERT_EQ(expected, info.monitor->spinCount3);
+		ASSERT_EQ(expected, tracing->adapt_spin_count);
+	}
+	ASSERT_TRUE(tracing->adapt_grow_count > 0);
+	ASSERT_EQ((uintptr_t)0, info.monitor->flags & J9THREAD_MONITOR_DISABLE_SPINNING);
+
+	/* Long critical sections switch the monitor to blocking immediately */
+	omrthread_monitor_enter(info.monitor);
+	omrthread_sleep(LONG_HOLD_MILLIS);
+	omrthread_monitor_exit(info.monitor);
+	ASSERT_EQ((uintptr_t)J9THREAD_MONITOR_DISABLE_SPINNING, info.monitor->flags & J9THREAD_MONITOR_DISABLE_SPINNING);
+	ASSERT_EQ((uintptr_t)1, info.monitor->spinCount3);
+	ASSERT_EQ((uintptr_t)1, tracing->adapt_park_count);
+
+	/* Once hold times are short again the learned budget is restored */
+	for (i = 0; (i < 10000) && (0 != (info.monitor->flags & J9THREAD_MONITOR_DISABLE_SPINNING)); i++) {
+		omrthread_monitor_enter(info.monitor);
+		omrthread_monitor_exit(info.monitor);
+	}
+	ASSERT_EQ((uintptr_t)0, info.monitor->flags & J9THREAD_MONITOR_DISABLE_SPINNING);
+	ASSERT_EQ(expected, info.monitor->spinCount3);
+	ASSERT_TRUE(tracing->adapt_holdtime <= lib->adaptSpinHoldtime);
+}
+
+#endif /* defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_JLM_HOLD_TIMES) */
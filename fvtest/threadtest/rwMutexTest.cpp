@@ -24,6 +24,7 @@
 #include "omrport.h"
 #include "omrTest.h"
 #include "testHelper.hpp"
+#include "omrutilbase.h"
 #include "thread_api.h"
 
 #define MILLI_TIMEOUT	1000
@@ -91,10 +92,11 @@ runRequest(SupportThreadInfo *info)
  * @param functionsToRun an array of functions pointers. Each function will be run one in sequence synchronized
  *        using the monitor within the SupporThreadInfo
  * @param numberFunctions the number of functions in the functionsToRun array
+ * @param flags the flags used to initialize the rwmutex
  * @returns a pointer to the newly created SupporThreadInfo
  */
 SupportThreadInfo *
-createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions)
+createSupportThreadInfoWithFlags(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions, uintptr_t flags)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
 	SupportThreadInfo *info = (SupportThreadInfo *)omrmem_allocate_memory(sizeof(SupportThreadInfo), OMRMEM_CATEGORY_THREADS);
@@ -103,11 +105,22 @@ createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t number
 	info->functionsToRun = functionsToRun;
 	info->numberFunctions = numberFunctions;
 	info->done = FALSE;
-	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, 0, "supportThreadInfo rwmutex");
+	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, flags, "supportThreadInfo rwmutex");
 	omrthread_monitor_init_with_name(&info->synchronization, 0, "supportThreadAInfo monitor");
 	return info;
 }
 
+/**
+ * This method is called to create a SupportThreadInfo for a test using a default rwmutex
+ *
+ * @see createSupportThreadInfoWithFlags
+ */
+SupportThreadInfo *
+createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions)
+{
+	return createSupportThreadInfoWithFlags(functionsToRun, numberFunctions, 0);
+}
+
 /**
  * This method free the internal structures and memory for a SupportThreadInfo
  * @param info the SupportThreadInfo instance to be freed
@@ -1136,3 +1149,178 @@ TEST(RWMutex, WritersExcludedByWriterNonBlockTest)
 	triggerNextStepDone(info);
 	freeSupportThreadInfo(info);
 }
+
+/**
+ * validates the following for a reader biased rwmutex
+ *
+ * readers are excluded while another thread holds the rwmutex for write
+ * once writer exits, reader can enter
+ * a writer is excluded while the reader holds the rwmutex, even when using try_enter
+ */
+TEST(RWMutex, ReaderBiasedExclusionTest)
+{
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+	info = createSupportThreadInfoWithFlags(functionsToRun, 2, J9THREAD_RWMUTEX_READER_BIASED);
+
+	/* first enter the mutex for write */
+	ASSERT_TRUE(0 == info->readCounter);
+	omrthread_rwmutex_enter_write(info->handle);
+	ASSERT_TRUE(omrthread_rwmutex_is_writelocked(info->handle));
+
+	/* start the concurrent thread that will try to enter for read and
+	 * check that it is blocked
+	 */
+	startConcurrentThread(info);
+	ASSERT_TRUE(0 == info->readCounter);
+
+	/* now release the rwmutex and validate that the thread enters it */
+	omrthread_monitor_enter(info->synchronization);
+	omrthread_rwmutex_exit_write(info->handle);
+	omrthread_monitor_wait_interruptable(info->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(info->synchronization);
+	ASSERT_TRUE(1 == info->readCounter);
+
+	/* the reader now holds the mutex, so a writer must not get in */
+	ASSERT_TRUE(J9THREAD_RWMUTEX_WOULDBLOCK == omrthread_rwmutex_try_enter_write(info->handle));
+
+	/* readers must still be admitted after the failed write attempt */
+	omrthread_rwmutex_enter_read(info->handle);
+	omrthread_rwmutex_exit_read(info->handle);
+
+	/* done now so ask thread to release and clean up */
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->readCounter);
+
+	ASSERT_TRUE(0 == omrthread_rwmutex_try_enter_write(info->handle));
+	omrthread_rwmutex_exit_write(info->handle);
+	freeSupportThreadInfo(info);
+}
+
+/**
+ * validates the following for a reader biased rwmutex
+ *
+ * writer is excluded while another thread holds the rwmutex for read
+ * once reader exits writer can enter
+ */
+TEST(RWMutex, ReaderBiasedWritersExcludedTest)
+{
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_write;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_write;
+	info = createSupportThreadInfoWithFlags(functionsToRun, 2, J9THREAD_RWMUTEX_READER_BIASED);
+
+	/* first enter the mutex for read, twice to check recursion */
+	ASSERT_TRUE(0 == info->writeCounter);
+	omrthread_rwmutex_enter_read(info->handle);
+	omrthread_rwmutex_enter_read(info->handle);
+
+	/* start the concurrent thread that will try to enter for write and
+	 * check that it is blocked
+	 */
+	startConcurrentThread(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+
+	/* a recursive read must not deadlock against the waiting writer */
+	omrthread_rwmutex_enter_read(info->handle);
+	omrthread_rwmutex_exit_read(info->handle);
+	omrthread_rwmutex_exit_read(info->handle);
+	ASSERT_TRUE(0 == info->writeCounter);
+
+	/* now release the rwmutex and validate that the thread enters it */
+	omrthread_monitor_enter(info->synchronization);
+	omrthread_rwmutex_exit_read(info->handle);
+	omrthread_monitor_wait_interruptable(info->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(info->synchronization);
+	ASSERT_TRUE(1 == info->writeCounter);
+
+	/* done now so ask thread to release and clean up */
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+	freeSupportThreadInfo(info);
+}
+
+#define BIASED_STRESS_THREADS 8
+#define BIASED_STRESS_ITERATIONS 20480
+#define BIASED_STRESS_WRITE_INTERVAL 64
+
+typedef struct BiasedStressInfo {
+	omrthread_rwmutex_t handle;
+	omrthread_monitor_t synchronization;
+	volatile uintptr_t readers;
+	volatile uintptr_t writers;
+	volatile uintptr_t violations;
+	uintptr_t writes;
+	uintptr_t running;
+} BiasedStressInfo;
+
+static int J9THREAD_PROC
+biasedStressWorker(void *arg)
+{
+	BiasedStressInfo *info = (BiasedStressInfo *)arg;
+	uintptr_t i = 0;
+
+	for (i = 0; i < BIASED_STRESS_ITERATIONS; i++) {
+		if (0 == (i % BIASED_STRESS_WRITE_INTERVAL)) {
+			omrthread_rwmutex_enter_write(info->handle);
+			info->writers += 1;
+			if ((1 != info->writers) || (0 != info->readers)) {
+				info->violations += 1;
+			}
+			info->writes += 1;
+			info->writers -= 1;
+			omrthread_rwmutex_exit_write(info->handle);
+		} else {
+			omrthread_rwmutex_enter_read(info->handle);
+			addAtomic(&info->readers, 1);
+			if (0 != info->writers) {
+				info->violations += 1;
+			}
+			subtractAtomic(&info->readers, 1);
+			omrthread_rwmutex_exit_read(info->handle);
+		}
+	}
+
+	omrthread_monitor_enter(info->synchronization);
+	info->running -= 1;
+	if (0 == info->running) {
+		omrthread_monitor_notify_all(info->synchronization);
+	}
+	omrthread_monitor_exit(info->synchronization);
+
+	return 0;
+}
+
+/**
+ * Mix readers and writers on a reader biased rwmutex and check that no reader
+ * ever overlaps a writer and that no write is lost.
+ */
+TEST(RWMutex, ReaderBiasedStressTest)
+{
+	BiasedStressInfo info;
+	uintptr_t i = 0;
+
+	memset(&info, 0, sizeof(info));
+	ASSERT_EQ(0, omrthread_rwmutex_init(&info.handle, J9THREAD_RWMUTEX_READER_BIASED, "biased stress rwmutex"));
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&info.synchronization, 0, "biased stress synchronization"));
+
+	omrthread_monitor_enter(info.synchronization);
+	info.running = BIASED_STRESS_THREADS;
+	for (i = 0; i < BIASED_STRESS_THREADS; i++) {
+		omrthread_t thread = NULL;
+		ASSERT_EQ(0, omrthread_create_ex(&thread, J9THREAD_ATTR_DEFAULT, 0, biasedStressWorker, &info));
+	}
+	while (0 != info.running) {
+		omrthread_monitor_wait(info.synchronization);
+	}
+	omrthread_monitor_exit(info.synchronization);
+
+	ASSERT_EQ((uintptr_t)0, info.violations);
+	ASSERT_EQ((uintptr_t)(BIASED_STRESS_THREADS * (BIASED_STRESS_ITERATIONS / BIASED_STRESS_WRITE_INTERVAL)), info.writes);
+
+	omrthread_monitor_destroy(info.synchronization);
+	ASSERT_EQ(0, omrthread_rwmutex_destroy(info.handle));
+}
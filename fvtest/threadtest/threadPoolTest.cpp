@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrTest.h"
+#include "omrutilbase.h"
+#include "thread_api.h"
+
+#define POOL_WORKERS 4
+#define POOL_TASKS 10000
+#define TREE_DEPTH 10
+
+typedef struct PoolTestInfo {
+	omrthread_pool_t pool;
+	volatile uintptr_t counter;
+} PoolTestInfo;
+
+typedef struct TreeTask {
+	PoolTestInfo *info;
+	uintptr_t depth;
+} TreeTask;
+
+static void
+incrementTask(void *arg)
+{
+	PoolTestInfo *info = (PoolTestInfo *)arg;
+	addAtomic(&info->counter, 1);
+}
+
+static void
+markTask(void *arg)
+{
+	uintptr_t *slot = (uintptr_t *)arg;
+	*slot += 1;
+}
+
+/**
+ * Count the leaves of a binary tree by submitting one subtask per child from the
+ * worker and waiting on them, so workers wait on tasks that they queued themselves.
+ */
+static void
+treeTask(void *arg)
+{
+	TreeTask *node = (TreeTask *)arg;
+
+	if (0 == node->depth) {
+		addAtomic(&node->info->counter, 1);
+	} else {
+		omrthread_waitgroup_t group = NULL;
+		TreeTask left = { node->info, node->depth - 1 };
+		TreeTask right = { node->info, node->depth - 1 };
+
+		if (J9THREAD_POOL_OK == omrthread_waitgroup_init(&group, "tree task group")) {
+			omrthread_pool_submit(node->info->pool, treeTask, &left, group);
+			omrthread_pool_submit(node->info->pool, treeTask, &right, group);
+			omrthread_pool_wait(node->info->pool, group);
+			omrthread_waitgroup_destroy(group);
+		}
+	}
+}
+
+TEST(ThreadPoolTest, SubmitAndWait)
+{
+	PoolTestInfo info;
+	omrthread_waitgroup_t group = NULL;
+	uintptr_t i = 0;
+
+	info.counter = 0;
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_create(&info.pool, POOL_WORKERS, J9THREAD_PRIORITY_NORMAL, 0, "pool test"));
+	ASSERT_EQ((uintptr_t)POOL_WORKERS, omrthread_pool_get_worker_count(info.pool));
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_waitgroup_init(&group, "pool test group"));
+
+	for (i = 0; i < POOL_TASKS; i++) {
+		ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_submit(info.pool, incrementTask, &info, group));
+	}
+	omrthread_pool_wait(info.pool, group);
+	ASSERT_EQ((uintptr_t)POOL_TASKS, info.counter);
+
+	/* a wait group can be reused once it has drained */
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_submit(info.pool, incrementTask, &info, group));
+	omrthread_waitgroup_wait(group);
+	ASSERT_EQ((uintptr_t)(POOL_TASKS + 1), info.counter);
+
+	omrthread_waitgroup_destroy(group);
+	omrthread_pool_destroy(info.pool);
+}
+
+TEST(ThreadPoolTest, SubmitBatch)
+{
+	omrthread_pool_t pool = NULL;
+	omrthread_waitgroup_t group = NULL;
+	uintptr_t *slots = new uintptr_t[POOL_TASKS];
+	void **args = new void *[POOL_TASKS];
+	uintptr_t i = 0;
+
+	for (i = 0; i < POOL_TASKS; i++) {
+		slots[i] = 0;
+		args[i] = &slots[i];
+	}
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_create(&pool, POOL_WORKERS, J9THREAD_PRIORITY_NORMAL, J9THREAD_POOL_NUMA_AWARE, "pool batch test"));
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_waitgroup_init(&group, "pool batch test group"));
+
+	/* the batch is larger than the initial deques so they have to grow */
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_submit_batch(pool, markTask, args, POOL_TASKS, group));
+	omrthread_pool_wait(pool, group);
+
+	for (i = 0; i < POOL_TASKS; i++) {
+		ASSERT_EQ((uintptr_t)1, slots[i]) << "task " << i;
+	}
+
+	omrthread_waitgroup_destroy(group);
+	omrthread_pool_destroy(pool);
+	delete[] args;
+	delete[] slots;
+}
+
+TEST(ThreadPoolTest, NestedWait)
+{
+	PoolTestInfo info;
+	TreeTask root;
+	omrthread_waitgroup_t group = NULL;
+
+	info.counter = 0;
+	root.info = &info;
+	root.depth = TREE_DEPTH;
+	/* fewer workers than concurrent waiters, so waiting workers must help */
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_create(&info.pool, 2, J9THREAD_PRIORITY_NORMAL, 0, "pool nested test"));
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_waitgroup_init(&group, "pool nested test group"));
+
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_submit(info.pool, treeTask, &root, group));
+	omrthread_pool_wait(info.pool, group);
+	ASSERT_EQ((uintptr_t)1 << TREE_DEPTH, info.counter);
+
+	omrthread_waitgroup_destroy(group);
+	omrthread_pool_destroy(info.pool);
+}
+
+TEST(ThreadPoolTest, DestroyRunsQueuedTasks)
+{
+	PoolTestInfo info;
+	uintptr_t i = 0;
+
+	info.counter = 0;
+	ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_create(&info.pool, 1, J9THREAD_PRIORITY_USER_MIN, 0, "pool destroy test"));
+	for (i = 0; i < POOL_TASKS; i++) {
+		ASSERT_EQ(J9THREAD_POOL_OK, omrthread_pool_submit(info.pool, incrementTask, &info, NULL));
+	}
+	omrthread_pool_destroy(info.pool);
+	ASSERT_EQ((uintptr_t)POOL_TASKS, info.counter);
+}
+
+TEST(ThreadPoolTest, CreateFails)
+{
+	omrthread_pool_t pool = NULL;
+
+	ASSERT_EQ(J9THREAD_POOL_FAIL, omrthread_pool_create(&pool, 0, J9THREAD_PRIORITY_NORMAL, 0, "pool empty test"));
+	ASSERT_TRUE(NULL == pool);
+}
@@ -0,0 +1,390 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <stdio.h>
+
+#include "hashtable_api.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "omrTest.h"
+#include "testEnvironment.hpp"
+
+extern PortEnvironment *utilTestEnv;
+
+#define CHT_TEST_THREADS 4
+#define CHT_TEST_KEYS 20000
+#define CHT_BENCH_PRELOAD 10000
+#define CHT_BENCH_OPERATIONS 200000
+
+typedef struct HashTableBenchData {
+	J9HashTable *table;
+	omrthread_monitor_t monitor;
+	J9ConcurrentHashTable *concurrentTable;
+	uintptr_t threadIndex;
+	uintptr_t failures;
+} HashTableBenchData;
+
+static uintptr_t
+keyHash(void *entry, void *userData)
+{
+	return *(uintptr_t *)entry;
+}
+
+static uintptr_t
+keyEquals(void *leftEntry, void *rightEntry, void *userData)
+{
+	return *(uintptr_t *)leftEntry == *(uintptr_t *)rightEntry;
+}
+
+static uintptr_t
+nextRandom(uintptr_t *seed)
+{
+	uintptr_t x = *seed;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	*seed = x;
+	return x;
+}
+
+/* Keys private to a thread start above the preloaded range, so adds and removes never collide */
+static uintptr_t
+privateKey(uintptr_t threadIndex, uintptr_t i)
+{
+	return CHT_BENCH_PRELOAD + 1 + (threadIndex * CHT_BENCH_OPERATIONS) + i;
+}
+
+static int J9THREAD_PROC
+concurrentUpdateThread(void *entryArg)
+{
+	HashTableBenchData *data = (HashTableBenchData *)entryArg;
+	uintptr_t i = 0;
+
+	for (i = 0; i < CHT_TEST_KEYS; i++) {
+		uintptr_t key = privateKey(data->threadIndex, i);
+		/* the section keeps the returned entry readable even if another thread removes it */
+		uintptr_t section = concurrentHashTableEnter(data->concurrentTable);
+		void *added = concurrentHashTableAdd(data->concurrentTable, &key);
+		if ((NULL == added) || (key != *(uintptr_t *)added)) {
+			data->failures += 1;
+		}
+		concurrentHashTableExit(data->concurrentTable, section);
+	}
+	for (i = 0; i < CHT_TEST_KEYS; i++) {
+		uintptr_t key = privateKey(data->threadIndex, i);
+		if (NULL == concurrentHashTableFind(data->concurrentTable, &key)) {
+			data->failures += 1;
+		}
+		if ((0 == (i % 2)) && (0 != concurrentHashTableRemove(data->concurrentTable, &key))) {
+			data->failures += 1;
+		}
+	}
+	return 0;
+}
+
+static int J9THREAD_PROC
+concurrentFindThread(void *entryArg)
+{
+	HashTableBenchData *data = (HashTableBenchData *)entryArg;
+	uintptr_t key = 0;
+
+	for (key = 1; key <= CHT_BENCH_PRELOAD; key++) {
+		if (NULL == concurrentHashTableFind(data->concurrentTable, &key)) {
+			data->failures += 1;
+		}
+	}
+	return 0;
+}
+
+/* 90% lookups of preloaded keys, 10% adds and removes of private keys */
+static int J9THREAD_PROC
+benchmarkThread(void *entryArg)
+{
+	HashTableBenchData *data = (HashTableBenchData *)entryArg;
+	uintptr_t seed = (data->threadIndex + 1) * 2654435761U;
+	uintptr_t added = 0;
+	uintptr_t removed = 0;
+	uintptr_t i = 0;
+
+	for (i = 0; i < CHT_BENCH_OPERATIONS; i++) {
+		uintptr_t choice = nextRandom(&seed) % 20;
+		uintptr_t key = 0;
+		uintptr_t failed = 0;
+
+		if (choice >= 2) {
+			key = 1 + (nextRandom(&seed) % CHT_BENCH_PRELOAD);
+			if (NULL != data->concurrentTable) {
+				failed = (NULL == concurrentHashTableFind(data->concurrentTable, &key));
+			} else {
+				omrthread_monitor_enter(data->monitor);
+				failed = (NULL == hashTableFind(data->table, &key));
+				omrthread_monitor_exit(data->monitor);
+			}
+		} else if ((0 == choice) || (removed == added)) {
+			key = privateKey(data->threadIndex, added++);
+			if (NULL != data->concurrentTable) {
+				failed = (NULL == concurrentHashTableAdd(data->concurrentTable, &key));
+			} else {
+				omrthread_monitor_enter(data->monitor);
+				failed = (NULL == hashTableAdd(data->table, &key));
+				omrthread_monitor_exit(data->monitor);
+			}
+		} else {
+			key = privateKey(data->threadIndex, removed++);
+			if (NULL != data->concurrentTable) {
+				failed = concurrentHashTableRemove(data->concurrentTable, &key);
+			} else {
+				omrthread_monitor_enter(data->monitor);
+				failed = hashTableRemove(data->table, &key);
+				omrthread_monitor_exit(data->monitor);
+			}
+		}
+		data->failures += failed;
+	}
+	return 0;
+}
+
+/**
+ * Run the thread function on CHT_TEST_THREADS threads.
+ * @return the total number of failures, or UDATA_MAX if the threads could not be started
+ */
+static uintptr_t
+runThreads(omrthread_entrypoint_t entrypoint, HashTableBenchData *prototype, uint64_t *elapsedNanos)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(utilTestEnv->getPortLibrary());
+	omrthread_t threads[CHT_TEST_THREADS];
+	HashTableBenchData data[CHT_TEST_THREADS];
+	uintptr_t started = 0;
+	uintptr_t failures = 0;
+	uintptr_t i = 0;
+	uint64_t start = omrtime_nano_time();
+
+	for (i = 0; i < CHT_TEST_THREADS; i++) {
+		omrthread_attr_t attr = NULL;
+
+		data[i] = *prototype;
+		data[i].threadIndex = i;
+		if ((J9THREAD_SUCCESS == omrthread_attr_init(&attr))
+			&& (J9THREAD_SUCCESS == omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+			&& (J9THREAD_SUCCESS == omrthread_create_ex(&threads[started], &attr, 0, entrypoint, &data[i]))
+		) {
+			started += 1;
+		}
+		omrthread_attr_destroy(&attr);
+	}
+	for (i = 0; i < started; i++) {
+		omrthread_join(threads[i]);
+		failures += data[i].failures;
+	}
+	*elapsedNanos = omrtime_nano_time() - start;
+
+	return (CHT_TEST_THREADS == started) ? failures : UDATA_MAX;
+}
+
+TEST(ConcurrentHashTableTest, addFindRemove)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(utilTestEnv->getPortLibrary());
+	J9ConcurrentHashTable *table = concurrentHashTableNew(OMRPORTLIB, "addFindRemove", 0, sizeof(uintptr_t), OMRMEM_CATEGORY_VM, keyHash, keyEquals, NULL);
+	uintptr_t *firstEntry = NULL;
+	uintptr_t key = 0;
+
+	ASSERT_TRUE(NULL != table);
+
+	/* enough entries to drive several grows from the minimum size */
+	for (key = 1; key <= CHT_TEST_KEYS; key++) {
+		uintptr_t *added = (uintptr_t *)concurrentHashTableAdd(table, &key);
+		ASSERT_TRUE(NULL != added);
+		ASSERT_EQ(key, *added);
+		/* a duplicate add answers the entry already in the table */
+		ASSERT_EQ(added, concurrentHashTableAdd(table, &key));
+		ASSERT_EQ(key, concurrentHashTableGetCount(table));
+		if (1 == key) {
+			firstEntry = added;
+		}
+	}
+	ASSERT_EQ((uintptr_t)CHT_TEST_KEYS, concurrentHashTableGetCount(table));
+
+	/* growing never moves an entry */
+	key = 1;
+	ASSERT_EQ(firstEntry, concurrentHashTableFind(table, &key));
+
+	for (key = 1; key <= CHT_TEST_KEYS; key++) {
+		ASSERT_TRUE(NULL != concurrentHashTableFind(table, &key));
+		if (0 == (key % 2)) {
+			ASSERT_EQ(0U, concurrentHashTableRemove(table, &key));
+			ASSERT_EQ(1U, concurrentHashTableRemove(table, &key));
+		}
+	}
+	ASSERT_EQ((uintptr_t)(CHT_TEST_KEYS / 2), concurrentHashTableGetCount(table));
+
+	concurrentHashTableReclaim(table);
+	for (key = 1; key <= CHT_TEST_KEYS; key++) {
+		void *found = concurrentHashTableFind(table, &key);
+		ASSERT_EQ(0 != (key % 2), NULL != found);
+	}
+	key = CHT_TEST_KEYS + 1;
+	ASSERT_TRUE(NULL == concurrentHashTableFind(table, &key));
+
+	concurrentHashTableFree(table);
+}
+
+static uintptr_t
+countRetiredNodes(J9ConcurrentHashTable *table)
+{
+	J9ConcurrentHashTableNode *node = NULL;
+	uintptr_t count = 0;
+
+	for (node = table->retiredNodes; NULL != node; node = node->retiredNext) {
+		count += 1;
+	}
+	for (node = table->limboNodes; NULL != node; node = node->retiredNext) {
+		count += 1;
+	}
+	return count;
+}
+
+TEST(ConcurrentHashTableTest, reclaimWhileReading)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(utilTestEnv->getPortLibrary());
+	J9ConcurrentHashTable *table = concurrentHashTableNew(OMRPORTLIB, "reclaimWhileReading", 0, sizeof(uintptr_t), OMRMEM_CATEGORY_VM, keyHash, keyEquals, NULL);
+	uintptr_t key = 1;
+	uintptr_t *found = NULL;
+	uintptr_t section = 0;
+
+	ASSERT_TRUE(NULL != table);
+	ASSERT_TRUE(NULL != concurrentHashTableAdd(table, &key));
+
+	/* a removed entry stays readable while a read section is open, however many updates follow */
+	section = concurrentHashTableEnter(table);
+	found = (uintptr_t *)concurrentHashTableFind(table, &key);
+	ASSERT_TRUE(NULL != found);
+	ASSERT_EQ(0U, concurrentHashTableRemove(table, &key));
+	for (key = 2; key <= CHT_TEST_KEYS; key++) {
+		ASSERT_TRUE(NULL != concurrentHashTableAdd(table, &key));
+		ASSERT_EQ(0U, concurrentHashTableRemove(table, &key));
+	}
+	ASSERT_EQ(1U, *found);
+	ASSERT_LE((uintptr_t)CHT_TEST_KEYS, countRetiredNodes(table));
+	concurrentHashTableExit(table, section);
+
+	/* once the section is left, updates reclaim as they go without the table being quiescent:
+	 * the first update moves the backlog into limbo and the second frees it
+	 */
+	for (key = 2; key <= CHT_TEST_KEYS; key++) {
+		ASSERT_TRUE(NULL != concurrentHashTableAdd(table, &key));
+		ASSERT_EQ(0U, concurrentHashTableRemove(table, &key));
+		if (key > 3) {
+			ASSERT_GE(2U, countRetiredNodes(table));
+		}
+	}
+	concurrentHashTableReclaim(table);
+	ASSERT_EQ(0U, countRetiredNodes(table));
+
+	concurrentHashTableFree(table);
+}
+
+TEST(ConcurrentHashTableTest, concurrentUpdates)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(utilTestEnv->getPortLibrary());
+	HashTableBenchData prototype = {NULL, NULL, NULL, 0, 0};
+	uint64_t elapsed = 0;
+	uintptr_t thread = 0;
+	uintptr_t i = 0;
+
+	prototype.concurrentTable = concurrentHashTableNew(OMRPORTLIB, "concurrentUpdates", 0, sizeof(uintptr_t), OMRMEM_CATEGORY_VM, keyHash, keyEquals, NULL);
+	ASSERT_TRUE(NULL != prototype.concurrentTable);
+
+	ASSERT_EQ(0U, runThreads(concurrentUpdateThread, &prototype, &elapsed));
+	ASSERT_EQ((uintptr_t)(CHT_TEST_THREADS * CHT_TEST_KEYS / 2), concurrentHashTableGetCount(prototype.concurrentTable));
+	for (thread = 0; thread < CHT_TEST_THREADS; thread++) {
+		for (i = 0; i < CHT_TEST_KEYS; i++) {
+			uintptr_t key = privateKey(thread, i);
+			ASSERT_EQ(0 != (i % 2), NULL != concurrentHashTableFind(prototype.concurrentTable, &key));
+		}
+	}
+
+	concurrentHashTableFree(prototype.concurrentTable);
+}
+
+TEST(ConcurrentHashTableTest, readersReused)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(utilTestEnv->getPortLibrary());
+	HashTableBenchData prototype = {NULL, NULL, NULL, 0, 0};
+	J9ConcurrentHashTableReader *reader = NULL;
+	uint64_t elapsed = 0;
+	uintptr_t readers = 0;
+	uintptr_t key = 0;
+
+	prototype.concurrentTable = concurrentHashTableNew(OMRPORTLIB, "readersReused", 0, sizeof(uintptr_t), OMRMEM_CATEGORY_VM, keyHash, keyEquals, NULL);
+	ASSERT_TRUE(NULL != prototype.concurrentTable);
+	for (key = 1; key <= CHT_BENCH_PRELOAD; key++) {
+		ASSERT_TRUE(NULL != concurrentHashTableAdd(prototype.concurrentTable, &key));
+	}
+
+	/* each thread reads through a reader of its own, which is handed on once the thread terminates */
+	ASSERT_EQ(0U, runThreads(concurrentFindThread, &prototype, &elapsed));
+	ASSERT_EQ(0U, runThreads(concurrentFindThread, &prototype, &elapsed));
+	for (reader = prototype.concurrentTable->readers; NULL != reader; reader = reader->next) {
+		ASSERT_EQ(0U, reader->epoch);
+		/* each reader has a cache line of its own */
+		ASSERT_EQ(0U, (uintptr_t)reader % 64);
+		readers += 1;
+	}
+	ASSERT_GE((uintptr_t)(CHT_TEST_THREADS + 1), readers);
+
+	concurrentHashTableFree(prototype.concurrentTable);
+}
+
+TEST(ConcurrentHashTableTest, throughput)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(utilTestEnv->getPortLibrary());
+	HashTableBenchData locked = {NULL, NULL, NULL, 0, 0};
+	HashTableBenchData concurrent = {NULL, NULL, NULL, 0, 0};
+	uint64_t lockedNanos = 0;
+	uint64_t concurrentNanos = 0;
+	double operations = (double)CHT_TEST_THREADS * CHT_BENCH_OPERATIONS;
+	uintptr_t key = 0;
+
+	locked.table = hashTableNew(OMRPORTLIB, "throughput", 0, sizeof(uintptr_t), 0, 0, OMRMEM_CATEGORY_VM, keyHash, keyEquals, NULL, NULL);
+	ASSERT_TRUE(NULL != locked.table);
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&locked.monitor, 0, "throughput"));
+	concurrent.concurrentTable = concurrentHashTableNew(OMRPORTLIB, "throughput", 0, sizeof(uintptr_t), OMRMEM_CATEGORY_VM, keyHash, keyEquals, NULL);
+	ASSERT_TRUE(NULL != concurrent.concurrentTable);
+
+	for (key = 1; key <= CHT_BENCH_PRELOAD; key++) {
+		ASSERT_TRUE(NULL != hashTableAdd(locked.table, &key));
+		ASSERT_TRUE(NULL != concurrentHashTableAdd(concurrent.concurrentTable, &key));
+	}
+
+	ASSERT_EQ(0U, runThreads(benchmarkThread, &locked, &lockedNanos));
+	ASSERT_EQ(0U, runThreads(benchmarkThread, &concurrent, &concurrentNanos));
+
+	printf("%d threads, %d operations each (90%% find): monitor guarded J9HashTable %.2f ops/us, J9ConcurrentHashTable %.2f ops/us\n",
+		CHT_TEST_THREADS, CHT_BENCH_OPERATIONS,
+		operations * 1000 / (double)(lockedNanos + 1), operations * 1000 / (double)(concurrentNanos + 1));
+
+	concurrentHashTableFree(concurrent.concurrentTable);
+	omrthread_monitor_destroy(locked.monitor);
+	hashTableFree(locked.table);
+}
@@ -0,0 +1,325 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <stdio.h>
+
+#include "omrport.h"
+#include "omrthread.h"
+#include "omrutil.h"
+#include "pool_api.h"
+
+#include "omrTest.h"
+#include "testEnvironment.hpp"
+
+extern PortEnvironment *utilTestEnv;
+
+#define CP_TEST_THREADS 4
+#define CP_TEST_ELEMENTS 5000
+#define CP_TEST_REUSE 1000
+#define CP_BENCH_MAX_THREADS 8
+#define CP_BENCH_BATCH 64
+#define CP_BENCH_ROUNDS 2000
+
+typedef struct PoolTestElement {
+	uintptr_t thread;
+	uintptr_t index;
+} PoolTestElement;
+
+typedef struct PoolBenchData {
+	J9Pool *pool;
+	omrthread_monitor_t monitor;
+	bool useMagazine;
+	uintptr_t threadIndex;
+	uintptr_t failures;
+} PoolBenchData;
+
+static PoolTestElement *testElements[CP_TEST_THREADS][CP_TEST_ELEMENTS];
+
+/* Allocate stamped elements, free the odd ones, then reuse some of the freed slots */
+static int J9THREAD_PROC
+concurrentAllocFreeThread(void *entryArg)
+{
+	PoolBenchData *data = (PoolBenchData *)entryArg;
+	PoolTestElement **elements = testElements[data->threadIndex];
+	J9PoolMagazine magazine = {0};
+	J9PoolMagazine *ownMagazine = data->useMagazine ? &magazine : NULL;
+	uintptr_t i = 0;
+
+	for (i = 0; i < CP_TEST_ELEMENTS; i++) {
+		elements[i] = (PoolTestElement *)pool_newElementConcurrent(data->pool, ownMagazine);
+		if (NULL == elements[i]) {
+			return 0;
+		}
+		if ((0 != elements[i]->thread) || (0 != elements[i]->index)) {
+			data->failures += 1;
+		}
+		elements[i]->thread = data->threadIndex + 1;
+		elements[i]->index = i;
+	}
+	for (i = 1; i < CP_TEST_ELEMENTS; i += 2) {
+		pool_removeElementConcurrent(data->pool, ownMagazine, elements[i]);
+	}
+	for (i = 1; i < 2 * CP_TEST_REUSE; i += 2) {
+		elements[i] = (PoolTestElement *)pool_newElementConcurrent(data->pool, ownMagazine);
+		if (NULL == elements[i]) {
+			return 0;
+		}
+		elements[i]->thread = data->threadIndex + 1;
+		elements[i]->index = i;
+	}
+	for (i = 1; i < 2 * CP_TEST_REUSE; i += 2) {
+		pool_removeElementConcurrent(data->pool, ownMagazine, elements[i]);
+	}
+	/* an element handed to two threads would have been restamped by the other one */
+	for (i = 0; i < CP_TEST_ELEMENTS; i += 2) {
+		if ((data->threadIndex + 1 != elements[i]->thread) || (i != elements[i]->index)) {
+			data->failures += 1;
+		}
+	}
+	pool_flushMagazine(data->pool, ownMagazine);
+	return 0;
+}
+
+/* Repeatedly allocate a batch of elements and free it again */
+static int J9THREAD_PROC
+benchmarkThread(void *entryArg)
+{
+	PoolBenchData *data = (PoolBenchData *)entryArg;
+	J9PoolMagazine magazine = {0};
+	J9PoolMagazine *ownMagazine = data->useMagazine ? &magazine : NULL;
+	void *batch[CP_BENCH_BATCH];
+	uintptr_t round = 0;
+	uintptr_t i = 0;
+
+	for (round = 0; round < CP_BENCH_ROUNDS; round++) {
+		for (i = 0; i < CP_BENCH_BATCH; i++) {
+			if (NULL != data->monitor) {
+				omrthread_monitor_enter(data->monitor);
+				batch[i] = pool_newElement(data->pool);
+				omrthread_monitor_exit(data->monitor);
+			} else {
+				batch[i] = pool_newElementConcurrent(data->pool, ownMagazine);
+			}
+			if (NULL == batch[i]) {
+				data->failures += 1;
+				return 0;
+			}
+		}
+		for (i = 0; i < CP_BENCH_BATCH; i++) {
+			if (NULL != data->monitor) {
+				omrthread_monitor_enter(data->monitor);
+				pool_removeElement(data->pool, batch[i]);
+				omrthread_monitor_exit(data->monitor);
+			} else {
+				pool_removeElementConcurrent(data->pool, ownMagazine, batch[i]);
+			}
+		}
+	}
+	pool_flushMagazine(data->pool, ownMagazine);
+	return 0;
+}
+
+/**
+ * Run the thread function on threadCount threads.
+ * @return the total number of failures, or UDATA_MAX if the threads could not be started
+ */
+static uintptr_t
+runThreads(omrthread_entrypoint_t entrypoint, PoolBenchData *prototype, uintptr_t threadCount, uint64_t *elapsedNanos)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(utilTestEnv->getPortLibrary());
+	omrthread_t threads[CP_BENCH_MAX_THREADS];
+	PoolBenchData data[CP_BENCH_MAX_THREADS];
+	uintptr_t started = 0;
+	uintptr_t failures = 0;
+	uintptr_t i = 0;
+	uint64_t start = omrtime_nano_time();
+
+	for (i = 0; i < threadCount; i++) {
+		omrthread_attr_t attr = NULL;
+
+		data[i] = *prototype;
+		data[i].threadIndex = i;
+		if ((J9THREAD_SUCCESS == omrthread_attr_init(&attr))
+			&& (J9THREAD_SUCCESS == omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+			&& (J9THREAD_SUCCESS == omrthread_create_ex(&threads[started], &attr, 0, entrypoint, &data[i]))
+		) {
+			started += 1;
+		}
+		omrthread_attr_destroy(&attr);
+	}
+	for (i = 0; i < started; i++) {
+		omrthread_join(threads[i]);
+		failures += data[i].failures;
+	}
+	*elapsedNanos = omrtime_nano_time() - start;
+
+	return (threadCount == started) ? failures : UDATA_MAX;
+}
+
+static uintptr_t
+countWalkedElements(J9Pool *pool)
+{
+	pool_state state;
+	uintptr_t count = 0;
+	void *element = pool_startDo(pool, &state);
+
+	while (NULL != element) {
+		count += 1;
+		element = pool_nextDo(&state);
+	}
+	return count;
+}
+
+TEST(ConcurrentPoolTest, magazines)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(utilTestEnv->getPortLibrary());
+	J9Pool *pool = pool_new(sizeof(PoolTestElement), 0, 0, POOL_CONCURRENT, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(OMRPORTLIB));
+	J9PoolMagazine magazine = {0};
+	void *elements[J9POOL_MAGAZINE_SIZE + 1];
+	uintptr_t i = 0;
+
+	ASSERT_TRUE(NULL != pool);
+	ASSERT_TRUE(0 != (pool->flags & POOL_NEVER_FREE_PUDDLES));
+
+	for (i = 0; i <= J9POOL_MAGAZINE_SIZE; i++) {
+		elements[i] = pool_newElementConcurrent(pool, &magazine);
+		ASSERT_TRUE(NULL != elements[i]);
+		ASSERT_TRUE(0 != pool_includesElement(pool, elements[i]));
+	}
+	ASSERT_EQ((uintptr_t)(J9POOL_MAGAZINE_SIZE + 1) + magazine.count, pool_numElements(pool));
+	ASSERT_EQ((uintptr_t)(J9POOL_MAGAZINE_SIZE + 1), countWalkedElements(pool));
+
+	/* cached elements are free but are handed out again only from the magazine that holds them.
+	 * They are counted until the magazine returns them to the puddles.
+	 */
+	for (i = 0; i <= J9POOL_MAGAZINE_SIZE; i++) {
+		pool_removeElementConcurrent(pool, &magazine, elements[i]);
+		ASSERT_EQ(0U, pool_includesElement(pool, elements[i]));
+	}
+	ASSERT_EQ(magazine.count, pool_numElements(pool));
+	ASSERT_EQ(0U, countWalkedElements(pool));
+	ASSERT_TRUE(magazine.count <= J9POOL_MAGAZINE_SIZE);
+	ASSERT_EQ(elements[J9POOL_MAGAZINE_SIZE], pool_newElementConcurrent(pool, &magazine));
+	ASSERT_EQ(1U, countWalkedElements(pool));
+	pool_removeElementConcurrent(pool, &magazine, elements[J9POOL_MAGAZINE_SIZE]);
+
+	/* freeing an element twice is ignored */
+	pool_removeElementConcurrent(pool, &magazine, elements[0]);
+	ASSERT_EQ(magazine.count, pool_numElements(pool));
+
+	pool_flushMagazine(pool, &magazine);
+	ASSERT_EQ(0U, magazine.count);
+	ASSERT_EQ(0U, pool_numElements(pool));
+
+	/* the plain entry points go through the concurrent path */
+	elements[0] = pool_newElement(pool);
+	ASSERT_TRUE(NULL != elements[0]);
+	ASSERT_EQ(1U, countWalkedElements(pool));
+	pool_removeElement(pool, elements[0]);
+	ASSERT_EQ(0U, pool_numElements(pool));
+
+	pool_kill(pool);
+}
+
+TEST(ConcurrentPoolTest, concurrentAllocFree)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(utilTestEnv->getPortLibrary());
+	PoolBenchData prototype = {NULL, NULL, true, 0, 0};
+	uint64_t elapsed = 0;
+	uintptr_t thread = 0;
+	uintptr_t i = 0;
+	pool_state state;
+	PoolTestElement *element = NULL;
+	uintptr_t expected = CP_TEST_THREADS * ((CP_TEST_ELEMENTS + 1) / 2);
+	int pass = 0;
+
+	/* 16 byte elements use holes; the small minimum size forces many puddles to be added concurrently */
+	for (pass = 0; pass < 2; pass++) {
+		prototype.useMagazine = (0 == pass);
+		prototype.pool = pool_new(sizeof(PoolTestElement), 16, 0, POOL_CONCURRENT, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(OMRPORTLIB));
+		ASSERT_TRUE(NULL != prototype.pool);
+
+		ASSERT_EQ(0U, runThreads(concurrentAllocFreeThread, &prototype, CP_TEST_THREADS, &elapsed));
+		ASSERT_EQ(expected, pool_numElements(prototype.pool));
+
+		element = (PoolTestElement *)pool_startDo(prototype.pool, &state);
+		for (i = 0; NULL != element; i++) {
+			ASSERT_TRUE((element->thread >= 1) && (element->thread <= CP_TEST_THREADS));
+			ASSERT_EQ(element, testElements[element->thread - 1][element->index]);
+			ASSERT_EQ(0U, element->index % 2);
+			element = (PoolTestElement *)pool_nextDo(&state);
+		}
+		ASSERT_EQ(expected, i);
+
+		for (thread = 0; thread < CP_TEST_THREADS; thread++) {
+			for (i = 0; i < CP_TEST_ELEMENTS; i += 2) {
+				pool_removeElement(prototype.pool, testElements[thread][i]);
+			}
+		}
+		ASSERT_EQ(0U, pool_numElements(prototype.pool));
+		ASSERT_EQ(0U, countWalkedElements(prototype.pool));
+
+		pool_kill(prototype.pool);
+	}
+}
+
+TEST(ConcurrentPoolTest, throughput)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(utilTestEnv->getPortLibrary());
+	uintptr_t threadCount = 0;
+
+	for (threadCount = 1; threadCount <= CP_BENCH_MAX_THREADS; threadCount *= 2) {
+		PoolBenchData locked = {NULL, NULL, false, 0, 0};
+		PoolBenchData shared = {NULL, NULL, false, 0, 0};
+		PoolBenchData magazines = {NULL, NULL, true, 0, 0};
+		uint64_t lockedNanos = 0;
+		uint64_t sharedNanos = 0;
+		uint64_t magazineNanos = 0;
+		double operations = 2.0 * threadCount * CP_BENCH_ROUNDS * CP_BENCH_BATCH;
+
+		locked.pool = pool_new(32, 0, 0, 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(OMRPORTLIB));
+		ASSERT_TRUE(NULL != locked.pool);
+		ASSERT_EQ(0, omrthread_monitor_init_with_name(&locked.monitor, 0, "throughput"));
+		shared.pool = pool_new(32, 0, 0, POOL_CONCURRENT, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(OMRPORTLIB));
+		ASSERT_TRUE(NULL != shared.pool);
+		magazines.pool = pool_new(32, 0, 0, POOL_CONCURRENT, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(OMRPORTLIB));
+		ASSERT_TRUE(NULL != magazines.pool);
+
+		ASSERT_EQ(0U, runThreads(benchmarkThread, &locked, threadCount, &lockedNanos));
+		ASSERT_EQ(0U, runThreads(benchmarkThread, &shared, threadCount, &sharedNanos));
+		ASSERT_EQ(0U, runThreads(benchmarkThread, &magazines, threadCount, &magazineNanos));
+		ASSERT_EQ(0U, pool_numElements(locked.pool));
+		ASSERT_EQ(0U, pool_numElements(shared.pool));
+		ASSERT_EQ(0U, pool_numElements(magazines.pool));
+
+		printf("%d threads, batches of %d: monitor guarded J9Pool %.2f ops/us, POOL_CONCURRENT %.2f ops/us, POOL_CONCURRENT with magazines %.2f ops/us\n",
+			(int)threadCount, CP_BENCH_BATCH,
+			operations * 1000 / (double)(lockedNanos + 1),
+			operations * 1000 / (double)(sharedNanos + 1),
+			operations * 1000 / (double)(magazineNanos + 1));
+
+		pool_kill(magazines.pool);
+		pool_kill(shared.pool);
+		omrthread_monitor_destroy(locked.monitor);
+		pool_kill(locked.pool);
+	}
+}
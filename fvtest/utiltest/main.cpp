@@ -25,13 +25,21 @@
 #include "omrutil.h"
 
 #include "omrTest.h"
+#include "testEnvironment.hpp"
+
+PortEnvironment *utilTestEnv;
 
 int
 main(int argc, char **argv, char **envp)
 {
 	::testing::InitGoogleTest(&argc, argv);
 	OMREventListener::setDefaultTestListener();
-	return RUN_ALL_TESTS();
+
+	INITIALIZE_THREADLIBRARY_AND_ATTACH();
+	utilTestEnv = (PortEnvironment *)testing::AddGlobalTestEnvironment(new PortEnvironment(argc, argv));
+	int result = RUN_ALL_TESTS();
+	DETACH_AND_DESTROY_THREADLIBRARY();
+	return result;
 }
 
 TEST(UtilTest, detectVMDirectory)
@@ -33,6 +33,7 @@
 
 class GC_ObjectScanner;
 class MM_CompactScheme;
+class MM_ConcurrentCompactScheme;
 class MM_EnvironmentStandard;
 class MM_ForwardedHeader;
 class MM_MarkMap;
@@ -58,6 +59,37 @@ public:
 
 	virtual void kill(MM_EnvironmentBase *env) = 0;
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/**
+	 * Concurrent compaction evacuates sparse regions of the heap while mutator threads run. While an evacuation
+	 * is open every load of an object reference by the language must go through MM_ConcurrentCompactScheme::readBarrier()
+	 * so that mutators only ever see the evacuated copies of objects.
+	 * @return true if the language implements this read barrier, otherwise concurrent compaction is never started
+	 */
+	virtual bool concurrentCompact_isReadBarrierSupported(MM_EnvironmentBase *env) { return false; }
+
+	/**
+	 * Called with exclusive VM access when an evacuation is opened, before any object is evacuated.
+	 * The language must arm its read barrier in all mutator threads.
+	 * @param concurrentCompactScheme the scheme the read barrier must call
+	 */
+	virtual void concurrentCompact_enableReadBarrier(MM_EnvironmentBase *env, MM_ConcurrentCompactScheme *concurrentCompactScheme) {}
+
+	/**
+	 * Called with exclusive VM access once all references to evacuated objects have been healed.
+	 * The language may disarm its read barrier.
+	 */
+	virtual void concurrentCompact_disableReadBarrier(MM_EnvironmentBase *env) {}
+
+	/**
+	 * Called with exclusive VM access right after the read barrier is armed. The language must pass every root slot
+	 * (thread stacks, global references, ...) to MM_ConcurrentCompactScheme::fixupSlot() so that no root refers to an
+	 * object in the evacuation set once mutators resume. Heap slots are healed lazily by the read barrier and by the next global mark.
+	 * @param concurrentCompactScheme the scheme owning the evacuation set
+	 */
+	virtual void concurrentCompact_evacuateRoots(MM_EnvironmentBase *env, MM_ConcurrentCompactScheme *concurrentCompactScheme) {}
+#endif /* OMR_GC_MODRON_COMPACTION */
+
 	MM_CollectorLanguageInterface()
 		: MM_BaseVirtual()
 	{
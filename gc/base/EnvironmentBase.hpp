@@ -33,6 +33,7 @@
 #include "CycleState.hpp"
 #include "CompactStats.hpp"
 #include "EnvironmentDelegate.hpp"
+#include "FreeEntryCache.hpp"
 #include "GCCode.hpp"
 #include "GCExtensionsBase.hpp"
 #include "LargeObjectAllocateStats.hpp"
@@ -78,6 +79,7 @@ class MM_EnvironmentBase : public MM_BaseVirtual
 private:
 	uintptr_t _workerID;
 	uintptr_t _environmentId;
+	uintptr_t _numaNodeIndex; /**< zero based index of the NUMA affinity leader this GC thread is bound to (0 if GC threads are not NUMA-aware) */
 
 protected:
 #if defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS)
@@ -165,6 +167,9 @@ public:
 #endif /* OMR_GC_SEGREGATED_HEAP */
 
 	volatile uint32_t _allocationColor; /**< Flag field to indicate whether premarking is enabled on the thread */
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	MM_FreeEntryCache _freeEntryCache; /**< Free entries of an address ordered pool pre-split for the allocations of this thread */
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
 
 	MM_CardCleaningStats _cardCleaningStats; /**< Per thread stats to track the performance of the card cleaning */
 #if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
@@ -365,6 +370,17 @@ public:
 	 */
 	 MMINLINE bool isMainThread() { return _workerID == 0; }
 
+	/**
+	 * Get the index of the NUMA affinity leader the thread is bound to.
+	 * @return zero based affinity leader index, 0 for threads which are not bound
+	 */
+	MMINLINE uintptr_t getNumaNodeIndex() { return _numaNodeIndex; }
+
+	/**
+	 * Set the index of the NUMA affinity leader the thread is bound to.
+	 */
+	MMINLINE void setNumaNodeIndex(uintptr_t numaNodeIndex) { _numaNodeIndex = numaNodeIndex; }
+
 	/**
 	 * Gets the threads type.
 	 * @return The type of thread.
@@ -696,6 +712,7 @@ public:
 		MM_BaseVirtual()
 		,_workerID(0)
 		,_environmentId(0)
+		,_numaNodeIndex(0)
 #if defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS)
 		, _compressObjectReferences(OMRVMTHREAD_COMPRESS_OBJECT_REFERENCES(omrVMThread))
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
@@ -754,6 +771,7 @@ public:
 		MM_BaseVirtual()
 		,_workerID(0)
 		,_environmentId(0)
+		,_numaNodeIndex(0)
 #if defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS)
 		, _compressObjectReferences(OMRVM_COMPRESS_OBJECT_REFERENCES(omrVM))
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
@@ -0,0 +1,218 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "FreeEntryCache.hpp"
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+
+#include "ModronAssertions.h"
+
+#include "AllocationStats.hpp"
+#include "EnvironmentBase.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "LargeObjectAllocateStats.hpp"
+#include "MemoryPoolAddressOrderedList.hpp"
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntryCache::takeEntry(MM_EnvironmentBase *env, uintptr_t classIndex)
+{
+	for (uintptr_t i = classIndex; i < FREE_ENTRY_CACHE_CLASS_COUNT; i++) {
+		MM_HeapLinkedFreeHeader *entry = _buckets[i];
+		if (NULL != entry) {
+			_buckets[i] = entry->getNext(env->compressObjectReferences());
+			_cachedBytes -= entry->getSize();
+			return entry;
+		}
+	}
+	return NULL;
+}
+
+void *
+MM_FreeEntryCache::allocateObject(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, uintptr_t minimumFreeEntrySize)
+{
+	MM_HeapLinkedFreeHeader *entry = takeEntry(env, getCeilingClassIndex(sizeInBytesRequired));
+	if (NULL == entry) {
+		return NULL;
+	}
+
+	uintptr_t recycleEntrySize = entry->getSize() - sizeInBytesRequired;
+	void *recycleEntry = (void *)((uintptr_t)entry + sizeInBytesRequired);
+	if (recycleEntrySize >= OMR_MAX(minimumFreeEntrySize, FREE_ENTRY_CACHE_SMALLEST_CLASS_SIZE)) {
+		addEntry(env, _memoryPool, recycleEntry, recycleEntrySize);
+	} else if (0 != recycleEntrySize) {
+		MM_HeapLinkedFreeHeader::fillWithHoles(recycleEntry, recycleEntrySize, env->compressObjectReferences());
+		_discardedBytes += recycleEntrySize;
+	}
+
+	return (void *)entry;
+}
+
+bool
+MM_FreeEntryCache::allocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, uintptr_t minimumFreeEntrySize, bool anySize, void * &addrBase, void * &addrTop)
+{
+	MM_HeapLinkedFreeHeader *entry = takeEntry(env, anySize ? 0 : getFloorClassIndex(maximumSizeInBytesRequired));
+	if (NULL == entry) {
+		return false;
+	}
+
+	uintptr_t entrySize = entry->getSize();
+	uintptr_t consumedSize = OMR_MIN(entrySize, maximumSizeInBytesRequired);
+	uintptr_t recycleEntrySize = entrySize - consumedSize;
+	/* As the pool does, hand out a leftover too small to be reused with the TLH */
+	if (recycleEntrySize < OMR_MAX(minimumFreeEntrySize, FREE_ENTRY_CACHE_SMALLEST_CLASS_SIZE)) {
+		consumedSize = entrySize;
+	} else {
+		addEntry(env, _memoryPool, (void *)((uintptr_t)entry + consumedSize), recycleEntrySize);
+	}
+
+	addrBase = (void *)entry;
+	addrTop = (void *)((uintptr_t)entry + consumedSize);
+	return true;
+}
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntryCache::sortByAddress(MM_HeapLinkedFreeHeader *entries, bool compressed)
+{
+	if ((NULL == entries) || (NULL == entries->getNext(compressed))) {
+		return entries;
+	}
+
+	/* Split the list in halves, sort them, and merge them */
+	MM_HeapLinkedFreeHeader *middle = entries;
+	MM_HeapLinkedFreeHeader *end = entries->getNext(compressed);
+	while ((NULL != end) && (NULL != end->getNext(compressed))) {
+		middle = middle->getNext(compressed);
+		end = end->getNext(compressed)->getNext(compressed);
+	}
+	MM_HeapLinkedFreeHeader *second = middle->getNext(compressed);
+	middle->setNext(NULL, compressed);
+	MM_HeapLinkedFreeHeader *first = sortByAddress(entries, compressed);
+	second = sortByAddress(second, compressed);
+
+	MM_HeapLinkedFreeHeader *head = NULL;
+	MM_HeapLinkedFreeHeader *tail = NULL;
+	while ((NULL != first) || (NULL != second)) {
+		MM_HeapLinkedFreeHeader *entry = NULL;
+		if ((NULL == second) || ((NULL != first) && (first < second))) {
+			entry = first;
+			first = first->getNext(compressed);
+		} else {
+			entry = second;
+			second = second->getNext(compressed);
+		}
+		if (NULL == tail) {
+			head = entry;
+		} else {
+			tail->setNext(entry, compressed);
+		}
+		tail = entry;
+	}
+	tail->setNext(NULL, compressed);
+
+	return head;
+}
+
+MM_HeapLinkedFreeHeader *
+MM_FreeEntryCache::takeEntries(MM_EnvironmentBase *env)
+{
+	bool const compressed = env->compressObjectReferences();
+	MM_HeapLinkedFreeHeader *entries = NULL;
+	for (uintptr_t i = 0; i < FREE_ENTRY_CACHE_CLASS_COUNT; i++) {
+		MM_HeapLinkedFreeHeader *entry = _buckets[i];
+		while (NULL != entry) {
+			MM_HeapLinkedFreeHeader *next = entry->getNext(compressed);
+			entry->setNext(entries, compressed);
+			entries = entry;
+			entry = next;
+		}
+		_buckets[i] = NULL;
+	}
+	_cachedBytes = 0;
+
+	return sortByAddress(entries, compressed);
+}
+
+void
+MM_FreeEntryCache::reportPendingAllocations(MM_LargeObjectAllocateStats *stats)
+{
+	for (uintptr_t i = 0; i < _pendingObjectCount; i++) {
+		stats->allocateObject(_pendingObjectSizes[i]);
+	}
+	for (uintptr_t i = 0; i < _pendingTLHCount; i++) {
+		stats->incrementTlhAllocSizeClassStats(_pendingTLHSizes[i]);
+	}
+	_pendingObjectCount = 0;
+	_pendingTLHCount = 0;
+}
+
+void
+MM_FreeEntryCache::addEntry(MM_EnvironmentBase *env, MM_MemoryPoolAddressOrderedList *memoryPool, void *addrBase, uintptr_t size)
+{
+	bool const compressed = env->compressObjectReferences();
+	if (size < FREE_ENTRY_CACHE_SMALLEST_CLASS_SIZE) {
+		MM_HeapLinkedFreeHeader::fillWithHoles(addrBase, size, compressed);
+		_discardedBytes += size;
+		return;
+	}
+
+	MM_HeapLinkedFreeHeader *entry = MM_HeapLinkedFreeHeader::fillWithHoles(addrBase, size, compressed);
+	uintptr_t classIndex = getFloorClassIndex(size);
+	entry->setNext(_buckets[classIndex], compressed);
+	_buckets[classIndex] = entry;
+	_cachedBytes += size;
+	_memoryPool = memoryPool;
+}
+
+void
+MM_FreeEntryCache::release(MM_EnvironmentBase *env)
+{
+	/* Give the entries back to the pool: a scavenge does not sweep the pool, so holes would stay lost until the next global GC */
+	if (NULL != _memoryPool) {
+		_memoryPool->returnFreeEntryCache(env, this);
+		_memoryPool = NULL;
+	}
+	Assert_MM_true(0 == _cachedBytes);
+	Assert_MM_false(hasPendingAllocations());
+}
+
+void
+MM_FreeEntryCache::flush(MM_EnvironmentBase *env, MM_AllocationStats *stats)
+{
+	release(env);
+	_exhaustedPool = NULL;
+	_exhaustedClassIndex = FREE_ENTRY_CACHE_CLASS_COUNT;
+
+	stats->_freeEntryCacheHits += _hits;
+	stats->_freeEntryCacheMisses += _misses;
+	stats->_freeEntryCacheRefills += _refills;
+	stats->_freeEntryCacheLockAcquisitions += _lockAcquisitions;
+	stats->_freeEntryCacheDiscardedBytes += _discardedBytes;
+	_hits = 0;
+	_misses = 0;
+	_refills = 0;
+	_lockAcquisitions = 0;
+	_discardedBytes = 0;
+}
+
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
@@ -0,0 +1,275 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(FREEENTRYCACHE_HPP_)
+#define FREEENTRYCACHE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "BaseNonVirtual.hpp"
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+
+class MM_AllocationStats;
+class MM_EnvironmentBase;
+class MM_HeapLinkedFreeHeader;
+class MM_LargeObjectAllocateStats;
+class MM_MemoryPoolAddressOrderedList;
+
+/* Size classes of the free entry cache are powers of two, starting at the smallest class size */
+#define FREE_ENTRY_CACHE_SMALLEST_CLASS_SIZE ((uintptr_t)512)
+#define FREE_ENTRY_CACHE_CLASS_COUNT 9
+/* Requests above the largest class size are never served from the cache */
+#define FREE_ENTRY_CACHE_LARGEST_CLASS_SIZE (FREE_ENTRY_CACHE_SMALLEST_CLASS_SIZE << (FREE_ENTRY_CACHE_CLASS_COUNT - 1))
+/* Number of object and of TLH allocations the cache remembers until they are recorded in the pool statistics */
+#define FREE_ENTRY_CACHE_PENDING_ALLOCATIONS 32
+
+/**
+ * Per thread cache of free entries taken from a single address ordered memory pool, bucketed by size class.
+ * The pool refills the cache with a batch of entries under one acquisition of its lock, then object and TLH
+ * allocations of the owning thread carve them without locking. Whatever is left of a carved entry goes back
+ * in the bucket of its size.
+ *
+ * Cached entries are formatted as holes and linked through their free headers, so the heap stays walkable.
+ * Like a TLH, the cache is flushed when the owning thread's allocation caches are flushed: the entries it
+ * still holds are returned to the free list of the pool, in address order under one acquisition of its lock.
+ *
+ * Allocations served by the cache are remembered, and recorded in the allocation statistics of the pool the
+ * next time its lock is taken, so the statistics see the sizes actually allocated rather than the entries.
+ * @ingroup GC_Base_Core
+ */
+class MM_FreeEntryCache : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_MemoryPoolAddressOrderedList *_memoryPool; /**< pool the cached entries were taken from */
+	MM_HeapLinkedFreeHeader *_buckets[FREE_ENTRY_CACHE_CLASS_COUNT]; /**< cached entries at least as large as the class size of the bucket */
+	uintptr_t _cachedBytes; /**< total size of the cached entries */
+	MM_MemoryPoolAddressOrderedList *_exhaustedPool; /**< pool that failed to refill the cache since the last flush */
+	uintptr_t _exhaustedClassIndex; /**< smallest class _exhaustedPool failed to refill */
+	uintptr_t _pendingObjectSizes[FREE_ENTRY_CACHE_PENDING_ALLOCATIONS]; /**< sizes of the objects allocated from the cache and not yet recorded by the pool */
+	uintptr_t _pendingObjectCount; /**< number of valid entries in _pendingObjectSizes */
+	uintptr_t _pendingTLHSizes[FREE_ENTRY_CACHE_PENDING_ALLOCATIONS]; /**< sizes of the TLHs allocated from the cache and not yet recorded by the pool */
+	uintptr_t _pendingTLHCount; /**< number of valid entries in _pendingTLHSizes */
+
+protected:
+public:
+	uintptr_t _hits; /**< allocations satisfied from the entries held by the cache */
+	uintptr_t _misses; /**< allocations the entries held by the cache could not satisfy */
+	uintptr_t _refills; /**< batches of entries taken from the pool */
+	uintptr_t _lockAcquisitions; /**< pool lock acquisitions made on behalf of allocations eligible for the cache */
+	uintptr_t _discardedBytes; /**< bytes left as holes, too small to be cached */
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Remove a cached entry from the first non-empty bucket at or above the given class.
+	 * @return the entry, or NULL if all those buckets are empty
+	 */
+	MM_HeapLinkedFreeHeader *takeEntry(MM_EnvironmentBase *env, uintptr_t classIndex);
+
+	/**
+	 * Sort a list of cached entries by address.
+	 * @return the head of the sorted list
+	 */
+	static MM_HeapLinkedFreeHeader *sortByAddress(MM_HeapLinkedFreeHeader *entries, bool compressed);
+
+protected:
+public:
+	/**
+	 * @return the smallest size of the entries held in the bucket of the given class
+	 */
+	static MMINLINE uintptr_t
+	getClassSize(uintptr_t classIndex)
+	{
+		return FREE_ENTRY_CACHE_SMALLEST_CLASS_SIZE << classIndex;
+	}
+
+	/**
+	 * @return the class of the bucket an entry of the given size is cached in
+	 */
+	static MMINLINE uintptr_t
+	getFloorClassIndex(uintptr_t size)
+	{
+		uintptr_t classIndex = 0;
+		while (((classIndex + 1) < FREE_ENTRY_CACHE_CLASS_COUNT) && (getClassSize(classIndex + 1) <= size)) {
+			classIndex += 1;
+		}
+		return classIndex;
+	}
+
+	/**
+	 * @return the smallest class whose entries all satisfy a request of the given size (at most the largest class size)
+	 */
+	static MMINLINE uintptr_t
+	getCeilingClassIndex(uintptr_t size)
+	{
+		uintptr_t classIndex = 0;
+		while (getClassSize(classIndex) < size) {
+			classIndex += 1;
+		}
+		return classIndex;
+	}
+
+	/**
+	 * @return true if allocations from the given pool may use the cache, an empty cache may serve any pool
+	 */
+	MMINLINE bool
+	canCacheFor(MM_MemoryPoolAddressOrderedList *memoryPool)
+	{
+		return (memoryPool == _memoryPool) || (0 == _cachedBytes);
+	}
+
+	/**
+	 * Until the next flush, the pool free list only shrinks: once a refill of a class failed, larger ones fail too.
+	 * @return true if a refill of the given class is worth trying
+	 */
+	MMINLINE bool
+	canRefill(MM_MemoryPoolAddressOrderedList *memoryPool, uintptr_t classIndex)
+	{
+		return (memoryPool != _exhaustedPool) || (classIndex < _exhaustedClassIndex);
+	}
+
+	/**
+	 * Record that the pool has no free entry of the given class left.
+	 */
+	MMINLINE void
+	setExhausted(MM_MemoryPoolAddressOrderedList *memoryPool, uintptr_t classIndex)
+	{
+		if (memoryPool != _exhaustedPool) {
+			_exhaustedPool = memoryPool;
+			_exhaustedClassIndex = classIndex;
+		} else {
+			_exhaustedClassIndex = OMR_MIN(_exhaustedClassIndex, classIndex);
+		}
+	}
+
+	/**
+	 * @return the pool the cached entries and the pending allocations belong to, NULL if there are none
+	 */
+	MMINLINE MM_MemoryPoolAddressOrderedList *getMemoryPool() { return _memoryPool; }
+
+	/**
+	 * @return true if allocations served by the cache are waiting to be recorded by the pool
+	 */
+	MMINLINE bool hasPendingAllocations() { return (0 != _pendingObjectCount) || (0 != _pendingTLHCount); }
+
+	/**
+	 * Remember an allocation served by the cache until the pool records it.
+	 * @return false if the pending allocations must be recorded first
+	 */
+	MMINLINE bool
+	addPendingAllocation(uintptr_t size, bool tlh)
+	{
+		if (tlh) {
+			if (FREE_ENTRY_CACHE_PENDING_ALLOCATIONS == _pendingTLHCount) {
+				return false;
+			}
+			_pendingTLHSizes[_pendingTLHCount] = size;
+			_pendingTLHCount += 1;
+		} else {
+			if (FREE_ENTRY_CACHE_PENDING_ALLOCATIONS == _pendingObjectCount) {
+				return false;
+			}
+			_pendingObjectSizes[_pendingObjectCount] = size;
+			_pendingObjectCount += 1;
+		}
+		return true;
+	}
+
+	/**
+	 * Record the pending allocations in the statistics of the pool. Called with the pool lock held.
+	 */
+	void reportPendingAllocations(MM_LargeObjectAllocateStats *stats);
+
+	/**
+	 * Remove all cached entries from the cache.
+	 * @return the entries, linked in address order
+	 */
+	MM_HeapLinkedFreeHeader *takeEntries(MM_EnvironmentBase *env);
+
+	/**
+	 * Carve an object from a cached entry.
+	 * @param minimumFreeEntrySize remainders below this size are left as holes
+	 * @return the object address, or NULL if no cached entry is large enough
+	 */
+	void *allocateObject(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, uintptr_t minimumFreeEntrySize);
+
+	/**
+	 * Carve a TLH from a cached entry.
+	 * @param anySize if false, only entries of at least the class of maximumSizeInBytesRequired are used
+	 * @return true if a TLH was carved
+	 */
+	bool allocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, uintptr_t minimumFreeEntrySize, bool anySize, void * &addrBase, void * &addrTop);
+
+	/**
+	 * Cache memory the pool allocated on behalf of the cache. The memory is formatted as a hole.
+	 */
+	void addEntry(MM_EnvironmentBase *env, MM_MemoryPoolAddressOrderedList *memoryPool, void *addrBase, uintptr_t size);
+
+	/**
+	 * Return all cached entries and pending allocations to their pool, so the cache may serve any pool.
+	 */
+	void release(MM_EnvironmentBase *env);
+
+	/**
+	 * Return all cached entries and pending allocations to their pool, and move the counters to the given statistics.
+	 */
+	void flush(MM_EnvironmentBase *env, MM_AllocationStats *stats);
+
+	/**
+	 * Create a FreeEntryCache object.
+	 */
+	MM_FreeEntryCache()
+		: MM_BaseNonVirtual()
+		, _memoryPool(NULL)
+		, _cachedBytes(0)
+		, _exhaustedPool(NULL)
+		, _exhaustedClassIndex(FREE_ENTRY_CACHE_CLASS_COUNT)
+		, _pendingObjectCount(0)
+		, _pendingTLHCount(0)
+		, _hits(0)
+		, _misses(0)
+		, _refills(0)
+		, _lockAcquisitions(0)
+		, _discardedBytes(0)
+	{
+		_typeId = __FUNCTION__;
+		for (uintptr_t i = 0; i < FREE_ENTRY_CACHE_CLASS_COUNT; i++) {
+			_buckets[i] = NULL;
+		}
+	}
+};
+
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+#endif /* FREEENTRYCACHE_HPP_ */
@@ -52,6 +52,7 @@ class MM_ClassLoaderRememberedSet;
 class MM_CollectorLanguageInterface;
 class MM_CompactGroupPersistentStats;
 class MM_CompressedCardTable;
+class MM_ConcurrentCompactScheme;
 class MM_Configuration;
 class MM_EnvironmentBase;
 class MM_FrequentObjectsStats;
@@ -105,6 +106,9 @@ class HeapRegionStateTable;
 #define DEFAULT_SCAN_CACHE_MAXIMUM_SIZE (128 * 1024)
 #define DEFAULT_SCAN_CACHE_MINIMUM_SIZE (8 * 1024)
 
+/* The maximum number of slots the Scavenger may scan ahead to prefetch referent headers. */
+#define MAXIMUM_SCAVENGER_PREFETCH_DISTANCE 16
+
 #define NO_ESTIMATE_FRAGMENTATION 			0x0
 #define LOCALGC_ESTIMATE_FRAGMENTATION 		0x1
 #define GLOBALGC_ESTIMATE_FRAGMENTATION 	0x2
@@ -348,6 +352,11 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool tlhAdaptiveSizing; /**< if true, TLH refresh sizes are derived from the allocation rate and TLH waste of each thread instead of growing by tlhIncrementSize */
+	uintptr_t tlhWasteTargetPercent; /**< with tlhAdaptiveSizing, share of the TLH bytes allocated by a thread that may be left unused at refreshes and flushes */
+	double tlhAllocationHistoryWeight; /**< with tlhAdaptiveSizing, weight of the past GC intervals when averaging the TLH usage of a thread (from 0.0 to 1.0) */
+	bool freeEntryCache; /**< if true, mutator object and TLH allocations from address ordered pools go through a per thread cache of pre-split free entries */
+	uintptr_t freeEntryCacheBatchSize; /**< number of entries taken from the pool, under a single lock acquisition, when the free entry cache is refilled */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -406,6 +415,8 @@ public:
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool packetListLockFree; /**< if true, work packets are pushed onto packet lists with compare-and-swap and only removals take the sublist locks */
+	bool numaAwareGCThreads; /**< if true, GC worker threads are bound round-robin to the NUMA affinity leaders and prefer work packets and scan caches queued by threads of their own node */
 
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
@@ -519,6 +530,8 @@ public:
 	uintptr_t scvArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in the scavenger */
 	uintptr_t scavengerScanCacheMaximumSize; /**< maximum size of scan and copy caches before rounding, zero (default) means calculate them */
 	uintptr_t scavengerScanCacheMinimumSize; /**< minimum size of scan and copy caches before rounding, zero (default) means calculate them */
+	uintptr_t scavengerPrefetchDistance; /**< number of slots scanned ahead to prefetch referent headers before they are copied/forwarded, zero (default) disables prefetching, capped to MAXIMUM_SCAVENGER_PREFETCH_DISTANCE */
+	bool scavengerWorkStealing; /**< if true, non-concurrent scavenge threads queue scan caches on private work-stealing deques, the shared scan list only takes overflow */
 	bool tiltedScavenge;
 	bool debugTiltedScavenge;
 	double survivorSpaceMinimumSizeRatio;
@@ -585,6 +598,13 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool concurrentCompact; /**< if true, compactions triggered by fragmentation are replaced by evacuating sparse sweep chunks while mutators run (requires a language read barrier) */
+	uintptr_t concurrentCompactLiveThreshold; /**< a sweep chunk is a candidate for concurrent evacuation if less than this percentage of it is live */
+	uintptr_t concurrentCompactEvacuateRate; /**< bytes a mutator evacuates for each byte it allocates while an evacuation is open */
+	MM_ConcurrentCompactScheme *concurrentCompactScheme; /**< the concurrent compaction scheme of the global collector, NULL if concurrentCompact is disabled */
+	bool fvtest_forceFragmentationCompact; /**< if true, every global GC compacts as if it had detected fragmentation */
+	bool partialCompact; /**< if true, compactions triggered by fragmentation only compact the most fragmented sub areas that fit partialCompactPauseTarget */
+	uintptr_t partialCompactPauseTarget; /**< pause time in milliseconds a partial compaction aims for, converted to a number of bytes to move using the rate measured by previous compactions */
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
 	bool payAllocationTax;
@@ -682,6 +702,10 @@ public:
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SizeClasses* defaultSizeClasses;
+	const char* sizeClassProfileFile; /**< Allocation size profile the small size classes are generated from at startup, NULL to use the default size classes */
+	const char* sizeClassProfileDumpFile; /**< File the allocation size profile of the run is written to at shutdown, NULL to not capture a profile */
+	uintptr_t* sizeClassProfileHistogram; /**< Number of small allocations per size over the run, allocated by the configuration only while sizeClassProfileDumpFile is set */
+	bool segregatedLazySweep; /**< If true, small regions are left unswept by the collection and swept on demand by allocating threads */
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
@@ -693,6 +717,7 @@ public:
 	uintptr_t traceCostToCheckYield; /**< tracing cost (in number of objects marked and pointers scanned) after we try to yield */
 	uintptr_t sweepCostToCheckYield; /**< weighted count of free chunks/marked objects before we check yield in sweep small loop */
 	uintptr_t splitAvailableListSplitAmount; /**< Number of split available lists per size class, per defragment bucket */
+	uintptr_t freeRegionRefillBatchSize; /**< Number of free regions moved at once to the split free list of an allocating thread, 0 or 1 to allocate free regions from the shared list directly */
 	uint32_t newThreadAllocationColor;
 	uintptr_t minimumFreeEntrySize;
 	uintptr_t arrayletsPerRegion;
@@ -718,6 +743,10 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool binaryLogging; /**< Enabled by -Xgc:binaryLogging.  Write verbose:gc files as a compact binary event stream instead of XML */
+	bool asyncLogging; /**< Enabled by -Xgc:asyncLogging.  Verbose:gc files are written by a dedicated low priority thread instead of the GC thread */
+	uintptr_t asyncLoggingBufferSize; /**< Size of the ring buffer feeding the asynchronous verbose:gc writer thread, -Xgc:asyncLoggingBufferSize= */
+	bool asyncLoggingBlockOnOverflow; /**< -Xgc:asyncLoggingOverflow=block waits for room in a full asynchronous log buffer, =drop (default) discards the record */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -856,6 +885,7 @@ public:
 	uintptr_t darkMatterSampleRate;/**< the weight of darkMatterSample for standard gc, default:32, if the weight = 0, disable darkMatterSampling */
 
 	bool pretouchHeapOnExpand; /**< True to pretouch memory during initial heap inflation or heap expansion */
+	bool backgroundHeapCommit; /**< True to commit the next heap expansion step ahead of time and decommit contracted memory after the pause, on a background thread */
 
 	uintptr_t decommitMinimumFree; /**< percentage of free heap to be retained as committed, default=0 for gencon, complete tenture free memory will be decommitted */
 
@@ -1561,6 +1591,11 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, tlhAdaptiveSizing(false)
+		, tlhWasteTargetPercent(1)
+		, tlhAllocationHistoryWeight(0.65)
+		, freeEntryCache(false)
+		, freeEntryCacheBatchSize(8)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
@@ -1603,6 +1638,8 @@ public:
 		, useGCStartupHints(true)
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, packetListLockFree(false)
+		, numaAwareGCThreads(false)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1699,6 +1736,8 @@ public:
 		, scvArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, scavengerScanCacheMaximumSize(DEFAULT_SCAN_CACHE_MAXIMUM_SIZE)
 		, scavengerScanCacheMinimumSize(DEFAULT_SCAN_CACHE_MINIMUM_SIZE)
+		, scavengerPrefetchDistance(0)
+		, scavengerWorkStealing(false)
 		, tiltedScavenge(true)
 		, debugTiltedScavenge(false)
 		, survivorSpaceMinimumSizeRatio(0.10)
@@ -1748,6 +1787,13 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, concurrentCompact(false)
+		, concurrentCompactLiveThreshold(30)
+		, concurrentCompactEvacuateRate(2)
+		, concurrentCompactScheme(NULL)
+		, fvtest_forceFragmentationCompact(false)
+		, partialCompact(false)
+		, partialCompactPauseTarget(20)
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1821,6 +1867,10 @@ public:
 #endif /* defined(OMR_GC_REALTIME) || defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		, defaultSizeClasses(NULL)
+		, sizeClassProfileFile(NULL)
+		, sizeClassProfileDumpFile(NULL)
+		, sizeClassProfileHistogram(NULL)
+		, segregatedLazySweep(false)
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
 		, heapRegionStateTable(NULL)
@@ -1829,6 +1879,7 @@ public:
 		, traceCostToCheckYield(500) /* weighted sum of marked objects and scanned pointers before we check yield in main tracing loop */
 		, sweepCostToCheckYield(500) /* weighted count of free chunks/marked objects before we check yield in sweep small loop */
 		, splitAvailableListSplitAmount(0)
+		, freeRegionRefillBatchSize(0)
 		, newThreadAllocationColor(0)
 		, minimumFreeEntrySize((uintptr_t)-1) /* -1 => user did not override default minimumFreeEntrySize */
 		, arrayletsPerRegion(0)
@@ -1848,6 +1899,10 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, binaryLogging(false)
+		, asyncLogging(false)
+		, asyncLoggingBufferSize(1024 * 1024)
+		, asyncLoggingBlockOnOverflow(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1947,6 +2002,7 @@ public:
 		, trackMutatorThreadCategory(false)
 		, darkMatterSampleRate(32)
 		, pretouchHeapOnExpand(false)
+		, backgroundHeapCommit(false)
 		, decommitMinimumFree(0)
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, gcOnIdle(false)
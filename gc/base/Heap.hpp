@@ -32,6 +32,7 @@
 #include "HeapResizeStats.hpp"
 #include "PercolateStats.hpp"
 
+class MM_HeapCommitHelper;
 class MM_HeapRegionDescriptor;
 class MM_HeapRegionManager;
 class MM_HeapStats;
@@ -129,6 +130,11 @@ public:
 	virtual bool commitMemory(void *address, uintptr_t size) = 0;
 	virtual bool decommitMemory(void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress) = 0;
 
+	/**
+	 * @return the helper committing and decommitting heap memory outside of the GC pauses, or NULL
+	 */
+	virtual MM_HeapCommitHelper *getCommitHelper() { return NULL; }
+
 	void mergeHeapStats(MM_HeapStats *heapStats, uintptr_t includeMemoryType);
 	void mergeHeapStats(MM_HeapStats *heapStats);
 	void resetHeapStatistics(bool globalCollect);
@@ -0,0 +1,421 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+#include "mmprivatehook.h"
+#include "mmprivatehook_internal.h"
+#include "omrport.h"
+#include "omrutil.h"
+
+#include "HeapCommitHelper.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MemoryManager.hpp"
+
+MM_HeapCommitHelper::MM_HeapCommitHelper(MM_EnvironmentBase *env, MM_MemoryHandle *vmemHandle, uintptr_t pageSize)
+	: MM_BaseVirtual()
+	, _extensions(env->getExtensions())
+	, _vmemHandle(vmemHandle)
+	, _pageSize(pageSize)
+	, _monitor(NULL)
+	, _state(STATE_ERROR)
+	, _workReleased(false)
+	, _precommitBase(NULL)
+	, _precommitTop(NULL)
+	, _preparedBase(NULL)
+	, _preparedTop(NULL)
+	, _decommitRangeCount(0)
+	, _activeBase(NULL)
+	, _activeTop(NULL)
+	, _activeIsPrecommit(false)
+	, _cancelActive(false)
+	, _precommittedBytes(0)
+	, _precommitUsedBytes(0)
+	, _deferredDecommitBytes(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+MM_HeapCommitHelper *
+MM_HeapCommitHelper::newInstance(MM_EnvironmentBase *env, MM_MemoryHandle *vmemHandle, uintptr_t pageSize)
+{
+	MM_HeapCommitHelper *helper = (MM_HeapCommitHelper *)env->getForge()->allocate(sizeof(MM_HeapCommitHelper), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != helper) {
+		new (helper) MM_HeapCommitHelper(env, vmemHandle, pageSize);
+		if (!helper->initialize(env)) {
+			helper->kill(env);
+			helper = NULL;
+		}
+	}
+	return helper;
+}
+
+void
+MM_HeapCommitHelper::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_HeapCommitHelper::initialize(MM_EnvironmentBase *env)
+{
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_HeapCommitHelper::_monitor")) {
+		return false;
+	}
+
+	J9HookInterface **mmPrivateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+	if (0 != (*mmPrivateHooks)->J9HookRegisterWithCallSite(mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_RELEASE, hookExclusiveAccessRelease, OMR_GET_CALLSITE(), (void *)this)) {
+		return false;
+	}
+
+	/* hold the monitor over start-up of the thread so that it cannot notify us of its start-up state before we wait */
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		helperThreadProc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _state) {
+			omrthread_monitor_wait(_monitor);
+		}
+	} else {
+		_state = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return STATE_ERROR != _state;
+}
+
+void
+MM_HeapCommitHelper::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		/* tell the helper thread to shut down and then wait for it to exit */
+		omrthread_monitor_enter(_monitor);
+		while ((STATE_ERROR != _state) && (STATE_TERMINATED != _state)) {
+			_state = STATE_TERMINATION_REQUESTED;
+			_cancelActive = true;
+			omrthread_monitor_notify_all(_monitor);
+			omrthread_monitor_wait(_monitor);
+		}
+		omrthread_monitor_exit(_monitor);
+
+		/* pending decommits are dropped, the heap memory is released as a whole */
+		J9HookInterface **mmPrivateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+		(*mmPrivateHooks)->J9HookUnregister(mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_RELEASE, hookExclusiveAccessRelease, (void *)this);
+
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+int J9THREAD_PROC
+MM_HeapCommitHelper::helperThreadProc(void *info)
+{
+	MM_HeapCommitHelper *helper = (MM_HeapCommitHelper *)info;
+	helper->helperThreadEntryPoint();
+	/* the thread exits from helperThreadEntryPoint(), releasing the monitor */
+	Assert_MM_unreachable();
+	return 0;
+}
+
+void
+MM_HeapCommitHelper::helperThreadEntryPoint()
+{
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_WAITING;
+	omrthread_monitor_notify_all(_monitor);
+
+	while (STATE_TERMINATION_REQUESTED != _state) {
+		if (_workReleased && (0 != _decommitRangeCount)) {
+			/* give memory back first, committing ahead is only an optimization */
+			decommitRange();
+		} else if (_workReleased && (NULL != _precommitTop)) {
+			precommitChunk();
+		} else {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+
+	_state = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+void
+MM_HeapCommitHelper::precommitChunk()
+{
+	MM_MemoryManager *memoryManager = _extensions->memoryManager;
+	void *base = _precommitBase;
+	void *top = (void *)OMR_MIN((uintptr_t)_precommitTop, (uintptr_t)base + HEAP_COMMIT_HELPER_CHUNK_SIZE);
+
+	_activeBase = base;
+	_activeTop = top;
+	_activeIsPrecommit = true;
+	_cancelActive = false;
+	omrthread_monitor_exit(_monitor);
+
+	bool committed = memoryManager->commitMemory(_vmemHandle, base, (uintptr_t)top - (uintptr_t)base);
+	if (committed) {
+		/* take the page faults now rather than in the pause of the expansion, the memory is still unused */
+		for (uintptr_t page = (uintptr_t)base; (page < (uintptr_t)top) && !_cancelActive; page += _pageSize) {
+			*(volatile uint8_t *)page = 0;
+		}
+	}
+
+	omrthread_monitor_enter(_monitor);
+	if (committed) {
+		/* the chunk is committed even if touching it was cancelled, the claim waiting for it trims it */
+		if (NULL == _preparedTop) {
+			_preparedBase = base;
+		}
+		Assert_MM_true(((NULL == _preparedTop) || (base == _preparedTop)));
+		_preparedTop = top;
+		_precommittedBytes += (uintptr_t)top - (uintptr_t)base;
+		Trc_MM_HeapCommitHelper_precommit((uintptr_t)top - (uintptr_t)base, base, _precommittedBytes);
+	}
+	if (committed && (top < _precommitTop)) {
+		_precommitBase = top;
+	} else {
+		/* the request is complete, or could not be satisfied */
+		_precommitBase = NULL;
+		_precommitTop = NULL;
+	}
+	_activeBase = NULL;
+	_activeTop = NULL;
+	omrthread_monitor_notify_all(_monitor);
+}
+
+void
+MM_HeapCommitHelper::decommitRange()
+{
+	MM_MemoryManager *memoryManager = _extensions->memoryManager;
+	_decommitRangeCount -= 1;
+	DecommitRange range = _decommitRanges[_decommitRangeCount];
+
+	_activeBase = range.base;
+	_activeTop = range.top;
+	_activeIsPrecommit = false;
+	omrthread_monitor_exit(_monitor);
+
+	uintptr_t size = (uintptr_t)range.top - (uintptr_t)range.base;
+	memoryManager->decommitMemory(_vmemHandle, range.base, size, range.lowValidAddress, range.highValidAddress);
+	Trc_MM_HeapCommitHelper_decommit(size, range.base);
+
+	omrthread_monitor_enter(_monitor);
+	_deferredDecommitBytes += size;
+	_activeBase = NULL;
+	_activeTop = NULL;
+	omrthread_monitor_notify_all(_monitor);
+}
+
+bool
+MM_HeapCommitHelper::queueDecommitRange(void *base, void *top, void *lowValidAddress, void *highValidAddress)
+{
+	if (HEAP_COMMIT_HELPER_MAX_DECOMMIT_RANGES == _decommitRangeCount) {
+		return false;
+	}
+	DecommitRange *range = &_decommitRanges[_decommitRangeCount];
+	range->base = base;
+	range->top = top;
+	range->lowValidAddress = lowValidAddress;
+	range->highValidAddress = highValidAddress;
+	_decommitRangeCount += 1;
+	return true;
+}
+
+void
+MM_HeapCommitHelper::waitForActiveRange(void *base, void *top)
+{
+	while ((NULL != _activeTop) && (_activeIsPrecommit || rangesShareAPage(base, top, _activeBase, _activeTop))) {
+		if (_activeIsPrecommit) {
+			_cancelActive = true;
+		}
+		omrthread_monitor_wait(_monitor);
+	}
+}
+
+void
+MM_HeapCommitHelper::abandonPrecommit()
+{
+	waitForActiveRange(NULL, NULL);
+	_precommitBase = NULL;
+	_precommitTop = NULL;
+	if (NULL != _preparedTop) {
+		/* the prepared range spans whole pages nobody else uses */
+		if (!queueDecommitRange(_preparedBase, _preparedTop, NULL, _preparedTop)) {
+			_extensions->memoryManager->decommitMemory(_vmemHandle, _preparedBase, (uintptr_t)_preparedTop - (uintptr_t)_preparedBase, NULL, _preparedTop);
+		}
+		_preparedBase = NULL;
+		_preparedTop = NULL;
+	}
+}
+
+void
+MM_HeapCommitHelper::requestPrecommit(MM_EnvironmentBase *env, void *base, uintptr_t size)
+{
+	/* only commit whole pages above base, the page holding base may be in use */
+	void *precommitBase = (void *)MM_Math::roundToCeiling(_pageSize, (uintptr_t)base);
+	void *precommitTop = (void *)MM_Math::roundToFloor(_pageSize, (uintptr_t)base + size);
+
+	omrthread_monitor_enter(_monitor);
+	_workReleased = false;
+	if ((NULL != _preparedTop) && (precommitBase == _preparedBase)) {
+		/* extend what is committed ahead already */
+		waitForActiveRange(NULL, NULL);
+		precommitBase = (void *)OMR_MAX((uintptr_t)precommitBase, (uintptr_t)_preparedTop);
+		_precommitBase = NULL;
+		_precommitTop = NULL;
+	} else {
+		abandonPrecommit();
+	}
+	if (precommitBase < precommitTop) {
+		_precommitBase = precommitBase;
+		_precommitTop = precommitTop;
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+bool
+MM_HeapCommitHelper::deferDecommit(MM_EnvironmentBase *env, void *base, uintptr_t size, void *lowValidAddress, void *highValidAddress)
+{
+	omrthread_monitor_enter(_monitor);
+	_workReleased = false;
+	abandonPrecommit();
+	bool queued = queueDecommitRange(base, (void *)((uintptr_t)base + size), lowValidAddress, highValidAddress);
+	omrthread_monitor_exit(_monitor);
+	return queued;
+}
+
+uintptr_t
+MM_HeapCommitHelper::claimRange(void *base, uintptr_t size)
+{
+	void *top = (void *)((uintptr_t)base + size);
+	void *claimBase = (void *)MM_Math::roundToFloor(_pageSize, (uintptr_t)base);
+	void *claimTop = (void *)MM_Math::roundToCeiling(_pageSize, (uintptr_t)top);
+	uintptr_t preparedBytes = 0;
+
+	omrthread_monitor_enter(_monitor);
+	_workReleased = false;
+	waitForActiveRange(base, top);
+
+	/* keep the parts of pending decommits outside the claimed range, bounded by it */
+	DecommitRange keptRanges[2 * HEAP_COMMIT_HELPER_MAX_DECOMMIT_RANGES];
+	uintptr_t keptRangeCount = 0;
+	for (uintptr_t index = 0; index < _decommitRangeCount; index++) {
+		DecommitRange *range = &_decommitRanges[index];
+		if (!rangesShareAPage(base, top, range->base, range->top)) {
+			keptRanges[keptRangeCount++] = *range;
+			continue;
+		}
+		if (range->base < base) {
+			DecommitRange *lowerRange = &keptRanges[keptRangeCount++];
+			lowerRange->base = range->base;
+			lowerRange->top = (void *)OMR_MIN((uintptr_t)range->top, (uintptr_t)base);
+			lowerRange->lowValidAddress = range->lowValidAddress;
+			lowerRange->highValidAddress = ((NULL == range->highValidAddress) || (base < range->highValidAddress)) ? base : range->highValidAddress;
+		}
+		if (top < range->top) {
+			DecommitRange *upperRange = &keptRanges[keptRangeCount++];
+			upperRange->base = (void *)OMR_MAX((uintptr_t)range->base, (uintptr_t)top);
+			upperRange->top = range->top;
+			upperRange->lowValidAddress = (top > range->lowValidAddress) ? top : range->lowValidAddress;
+			upperRange->highValidAddress = range->highValidAddress;
+		}
+	}
+	_decommitRangeCount = 0;
+	for (uintptr_t index = 0; index < keptRangeCount; index++) {
+		DecommitRange *range = &keptRanges[index];
+		if (!queueDecommitRange(range->base, range->top, range->lowValidAddress, range->highValidAddress)) {
+			/* ranges split by the claim did not all fit the queue */
+			_extensions->memoryManager->decommitMemory(_vmemHandle, range->base, (uintptr_t)range->top - (uintptr_t)range->base, range->lowValidAddress, range->highValidAddress);
+		}
+	}
+
+	if ((NULL != _precommitTop) && rangesShareAPage(base, top, _precommitBase, _precommitTop)) {
+		_precommitBase = NULL;
+		_precommitTop = NULL;
+	}
+
+	if ((NULL != _preparedTop) && (claimBase < _preparedTop) && (_preparedBase < claimTop)) {
+		void *usedBase = (void *)OMR_MAX((uintptr_t)claimBase, (uintptr_t)_preparedBase);
+		void *usedTop = (void *)OMR_MIN((uintptr_t)claimTop, (uintptr_t)_preparedTop);
+		preparedBytes = (uintptr_t)usedTop - (uintptr_t)usedBase;
+		_precommitUsedBytes += preparedBytes;
+		if (usedTop == _preparedTop) {
+			_preparedTop = usedBase;
+		} else if (usedBase == _preparedBase) {
+			_preparedBase = usedTop;
+		} else {
+			/* the claim split the prepared range, give the part above it back */
+			if (!queueDecommitRange(usedTop, _preparedTop, top, _preparedTop)) {
+				_extensions->memoryManager->decommitMemory(_vmemHandle, usedTop, (uintptr_t)_preparedTop - (uintptr_t)usedTop, top, _preparedTop);
+			}
+			_preparedTop = usedBase;
+		}
+		if (_preparedBase >= _preparedTop) {
+			_preparedBase = NULL;
+			_preparedTop = NULL;
+			_precommitBase = NULL;
+			_precommitTop = NULL;
+		} else if ((NULL != _precommitTop) && (_precommitBase != _preparedTop)) {
+			/* committing ahead only ever extends the prepared range */
+			_precommitBase = NULL;
+			_precommitTop = NULL;
+		}
+		Trc_MM_HeapCommitHelper_claimRange(size, base, preparedBytes);
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return preparedBytes;
+}
+
+void
+MM_HeapCommitHelper::hookExclusiveAccessRelease(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_HeapCommitHelper *helper = (MM_HeapCommitHelper *)userData;
+	omrthread_monitor_enter(helper->_monitor);
+	if ((0 != helper->_decommitRangeCount) || (NULL != helper->_precommitTop)) {
+		helper->_workReleased = true;
+		omrthread_monitor_notify_all(helper->_monitor);
+	}
+	omrthread_monitor_exit(helper->_monitor);
+}
+
+void
+MM_HeapCommitHelper::getStats(uintptr_t *precommittedBytes, uintptr_t *precommitUsedBytes, uintptr_t *deferredDecommitBytes)
+{
+	omrthread_monitor_enter(_monitor);
+	*precommittedBytes = _precommittedBytes;
+	*precommitUsedBytes = _precommitUsedBytes;
+	*deferredDecommitBytes = _deferredDecommitBytes;
+	omrthread_monitor_exit(_monitor);
+}
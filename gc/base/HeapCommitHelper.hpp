@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(HEAPCOMMITHELPER_HPP_)
+#define HEAPCOMMITHELPER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrthread.h"
+#include "modronbase.h"
+
+#include "BaseVirtual.hpp"
+#include "Math.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+class MM_MemoryHandle;
+struct J9HookInterface;
+
+/* Maximum number of contracted ranges waiting to be decommitted, further contractions are decommitted in the pause */
+#define HEAP_COMMIT_HELPER_MAX_DECOMMIT_RANGES 8
+/* Granule of background commit, a claim for memory being committed waits for at most one page of it */
+#define HEAP_COMMIT_HELPER_CHUNK_SIZE ((uintptr_t)1024 * 1024)
+
+/**
+ * Background thread taking the cost of heap resizing out of the GC pauses.
+ *
+ * After an expansion the physical sub arena asks the helper to commit the next expansion step ahead of time.
+ * The helper commits that memory and touches every page of it, so a later expansion into that range neither
+ * waits for the commit nor page faults. After a contraction the sub arena hands the contracted range over to
+ * the helper instead of decommitting it in the pause.
+ *
+ * Queued work only starts once the pause that queued it releases exclusive access. All commits of heap memory
+ * claim their range from the helper first: an overlapping background operation is stopped or waited for, a
+ * pending decommit of the range is dropped, and memory already committed by the helper is simply reused.
+ * @ingroup GC_Base_Core
+ */
+class MM_HeapCommitHelper : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	/* A range contracted from the heap, waiting to be decommitted */
+	struct DecommitRange {
+		void *base; /**< first byte of the range */
+		void *top; /**< first byte after the range */
+		void *lowValidAddress; /**< end of the committed memory below the range, or NULL */
+		void *highValidAddress; /**< start of the committed memory above the range, or NULL */
+	};
+
+	typedef enum {
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_WAITING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED,
+	} HelperState;
+
+	MM_GCExtensionsBase *_extensions;
+	MM_MemoryHandle *_vmemHandle; /**< virtual memory of the heap */
+	uintptr_t _pageSize; /**< page size of the heap */
+	omrthread_monitor_t _monitor; /**< protects all fields below */
+	volatile HelperState _state;
+	bool _workReleased; /**< true once the pause that queued work has ended */
+
+	void *_precommitBase; /**< next byte of the expansion step left to commit */
+	void *_precommitTop; /**< end of the expansion step to commit */
+	void *_preparedBase; /**< first byte committed and touched ahead of the expansion */
+	void *_preparedTop; /**< end of the memory committed and touched ahead of the expansion */
+	DecommitRange _decommitRanges[HEAP_COMMIT_HELPER_MAX_DECOMMIT_RANGES]; /**< contracted ranges to decommit */
+	uintptr_t _decommitRangeCount; /**< number of valid entries in _decommitRanges */
+
+	void *_activeBase; /**< first byte of the range the helper works on outside the monitor */
+	void *_activeTop; /**< end of the range the helper works on, NULL if it is not working */
+	bool _activeIsPrecommit; /**< true if the active range is being committed, false if it is being decommitted */
+	volatile bool _cancelActive; /**< set to stop touching the pages of the active range */
+
+	uintptr_t _precommittedBytes; /**< bytes committed and touched ahead of expansions */
+	uintptr_t _precommitUsedBytes; /**< part of expansions found committed by the helper */
+	uintptr_t _deferredDecommitBytes; /**< bytes of contractions decommitted after the pause */
+
+protected:
+public:
+	/*
+	 * Function members
+	 */
+private:
+	static int J9THREAD_PROC helperThreadProc(void *info);
+
+	/**
+	 * Main loop of the helper thread, returns when termination is requested.
+	 */
+	void helperThreadEntryPoint();
+
+	/**
+	 * Commit the next chunk of the requested expansion step and touch its pages. Called with the monitor held,
+	 * released while committing.
+	 */
+	void precommitChunk();
+
+	/**
+	 * Decommit the last queued range. Called with the monitor held, released while decommitting.
+	 */
+	void decommitRange();
+
+	/**
+	 * Queue a range for decommit. Called with the monitor held.
+	 * @return false if the queue is full
+	 */
+	bool queueDecommitRange(void *base, void *top, void *lowValidAddress, void *highValidAddress);
+
+	/**
+	 * Stop committing ahead, and wait for a decommit of memory sharing a page with the given range. Called with
+	 * the monitor held, which is released while waiting.
+	 */
+	void waitForActiveRange(void *base, void *top);
+
+	/**
+	 * Stop committing ahead and hand the memory already committed ahead over for decommit. Called with the monitor held.
+	 */
+	void abandonPrecommit();
+
+	/**
+	 * @return true if the two ranges share a page
+	 */
+	MMINLINE bool
+	rangesShareAPage(void *base1, void *top1, void *base2, void *top2)
+	{
+		return (MM_Math::roundToFloor(_pageSize, (uintptr_t)base1) < MM_Math::roundToCeiling(_pageSize, (uintptr_t)top2))
+			&& (MM_Math::roundToFloor(_pageSize, (uintptr_t)base2) < MM_Math::roundToCeiling(_pageSize, (uintptr_t)top1));
+	}
+
+	static void hookExclusiveAccessRelease(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_HeapCommitHelper *newInstance(MM_EnvironmentBase *env, MM_MemoryHandle *vmemHandle, uintptr_t pageSize);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Ask for the memory following an expansion to be committed in the background, replacing any previous request.
+	 * @param base the first byte of the next expansion step, the current top of the expanding sub arena
+	 * @param size the expected size of the next expansion step
+	 */
+	void requestPrecommit(MM_EnvironmentBase *env, void *base, uintptr_t size);
+
+	/**
+	 * Hand over a range contracted from the heap to be decommitted once the pause ends. Memory committed ahead
+	 * of the contracting sub arena is decommitted along with it, and no further memory is committed ahead.
+	 * @return false if the range could not be queued and must be decommitted by the caller
+	 */
+	bool deferDecommit(MM_EnvironmentBase *env, void *base, uintptr_t size, void *lowValidAddress, void *highValidAddress);
+
+	/**
+	 * Called before the given range is committed for use by the heap.
+	 * @return the number of bytes of the range already committed by the helper
+	 */
+	uintptr_t claimRange(void *base, uintptr_t size);
+
+	/**
+	 * Read the cumulative counters of the helper.
+	 * @param[out] precommittedBytes bytes committed and touched ahead of expansions
+	 * @param[out] precommitUsedBytes part of expansions found committed by the helper
+	 * @param[out] deferredDecommitBytes bytes of contractions decommitted after the pause
+	 */
+	void getStats(uintptr_t *precommittedBytes, uintptr_t *precommitUsedBytes, uintptr_t *deferredDecommitBytes);
+
+	/**
+	 * Create a HeapCommitHelper object.
+	 */
+	MM_HeapCommitHelper(MM_EnvironmentBase *env, MM_MemoryHandle *vmemHandle, uintptr_t pageSize);
+};
+
+#endif /* HEAPCOMMITHELPER_HPP_ */
@@ -24,6 +24,7 @@
 #include "Bits.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapMap.hpp"
+#include "HeapMapScanner.hpp"
 #include "Math.hpp"
 #include "ObjectModel.hpp"
 
@@ -131,6 +132,16 @@ MM_HeapMapIterator::nextObject()
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
 			_heapMapSlotValue = *_heapMapSlotCurrent;
+			if (J9MODRON_HMI_SLOT_EMPTY == _heapMapSlotValue) {
+				/* Skip a run of empty map slots in bulk, examining only the slots that map the remainder of the chunk */
+				uintptr_t heapMapSlotsRemaining = MM_Math::roundToCeiling(J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT, (uintptr_t)(_heapChunkTop - _heapSlotCurrent)) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT;
+				uintptr_t *heapMapSlotNext = MM_HeapMapScanner::findNonEmptySlot(_heapMapSlotCurrent + 1, _heapMapSlotCurrent + heapMapSlotsRemaining);
+				_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (uintptr_t)(heapMapSlotNext - _heapMapSlotCurrent);
+				_heapMapSlotCurrent = heapMapSlotNext;
+				if(_heapSlotCurrent < _heapChunkTop) {
+					_heapMapSlotValue = *_heapMapSlotCurrent;
+				}
+			}
 		}
 	}
 
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPMAPSCANNER_HPP_)
+#define HEAPMAPSCANNER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define OMR_GC_HEAPMAP_SCAN_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define OMR_GC_HEAPMAP_SCAN_SSE2
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define OMR_GC_HEAPMAP_SCAN_NEON
+#endif
+
+/* Bytes of heap map tested by each step of the bulk scan, one cache line */
+#define OMR_GC_HEAPMAP_SCAN_STRIDE_BYTES 64
+#define OMR_GC_HEAPMAP_SCAN_STRIDE_SLOTS (OMR_GC_HEAPMAP_SCAN_STRIDE_BYTES / sizeof(uintptr_t))
+
+/**
+ * Bulk scanning of heap map (mark map) slots. Runs of empty slots are skipped a cache line aligned stride
+ * at a time using the widest vector compare the compiler targets (AVX2, SSE2 or NEON), with a scalar
+ * fallback that ORs the slots of a stride. The vector path is selected at compile time.
+ * @ingroup GC_Base
+ */
+class MM_HeapMapScanner
+{
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * @return true if the OMR_GC_HEAPMAP_SCAN_STRIDE_BYTES of heap map starting at slot are all zero
+	 */
+	static MMINLINE bool
+	isStrideEmpty(const uintptr_t *slot)
+	{
+#if defined(OMR_GC_HEAPMAP_SCAN_AVX2)
+		__m256i bits = _mm256_or_si256(
+				_mm256_loadu_si256((const __m256i *)slot),
+				_mm256_loadu_si256((const __m256i *)((const uint8_t *)slot + 32)));
+		return 0 != _mm256_testz_si256(bits, bits);
+#elif defined(OMR_GC_HEAPMAP_SCAN_SSE2)
+		__m128i bits = _mm_or_si128(
+				_mm_or_si128(_mm_loadu_si128((const __m128i *)slot), _mm_loadu_si128((const __m128i *)((const uint8_t *)slot + 16))),
+				_mm_or_si128(_mm_loadu_si128((const __m128i *)((const uint8_t *)slot + 32)), _mm_loadu_si128((const __m128i *)((const uint8_t *)slot + 48))));
+		return 0xFFFF == _mm_movemask_epi8(_mm_cmpeq_epi8(bits, _mm_setzero_si128()));
+#elif defined(OMR_GC_HEAPMAP_SCAN_NEON)
+		const uint32_t *words = (const uint32_t *)slot;
+		uint32x4_t bits = vorrq_u32(
+				vorrq_u32(vld1q_u32(words), vld1q_u32(words + 4)),
+				vorrq_u32(vld1q_u32(words + 8), vld1q_u32(words + 12)));
+		return 0 == vmaxvq_u32(bits);
+#else /* scalar */
+		uintptr_t bits = 0;
+		for (uintptr_t i = 0; i < OMR_GC_HEAPMAP_SCAN_STRIDE_SLOTS; i++) {
+			bits |= slot[i];
+		}
+		return 0 == bits;
+#endif /* OMR_GC_HEAPMAP_SCAN_AVX2 */
+	}
+
+protected:
+public:
+	/**
+	 * Find the first heap map slot with any bit set.
+	 *
+	 * @param slot the first heap map slot to examine
+	 * @param top the heap map slot after the last one to examine
+	 *
+	 * @return the first non-empty slot in [slot, top), or top if they are all empty
+	 */
+	static MMINLINE uintptr_t *
+	findNonEmptySlot(uintptr_t *slot, uintptr_t *top)
+	{
+		/* short runs end before the next stride boundary, examine those slots one at a time */
+		while ((slot < top) && (0 != ((uintptr_t)slot & (OMR_GC_HEAPMAP_SCAN_STRIDE_BYTES - 1)))) {
+			if (0 != *slot) {
+				return slot;
+			}
+			slot += 1;
+		}
+		while (((uintptr_t)(top - slot) >= OMR_GC_HEAPMAP_SCAN_STRIDE_SLOTS) && isStrideEmpty(slot)) {
+			slot += OMR_GC_HEAPMAP_SCAN_STRIDE_SLOTS;
+		}
+		/* the set bit is within the next stride, or the remainder is shorter than a stride */
+		while ((slot < top) && (0 == *slot)) {
+			slot += 1;
+		}
+		return slot;
+	}
+
+	/**
+	 * @return the name of the vector extension used by the bulk scan
+	 */
+	static const char *
+	getImplementationName()
+	{
+#if defined(OMR_GC_HEAPMAP_SCAN_AVX2)
+		return "avx2";
+#elif defined(OMR_GC_HEAPMAP_SCAN_SSE2)
+		return "sse2";
+#elif defined(OMR_GC_HEAPMAP_SCAN_NEON)
+		return "neon";
+#else /* scalar */
+		return "scalar";
+#endif /* OMR_GC_HEAPMAP_SCAN_AVX2 */
+	}
+};
+
+#endif /* HEAPMAPSCANNER_HPP_ */
@@ -28,6 +28,7 @@
 #include "Forge.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
+#include "HeapCommitHelper.hpp"
 #include "HeapRegionManager.hpp"
 #include "Math.hpp"
 #include "MemoryManager.hpp"
@@ -127,6 +128,18 @@ MM_HeapVirtualMemory::initialize(MM_EnvironmentBase* env, uintptr_t size)
 	/* The memory returned might be less than we asked for -- get the actual size */
 	_maximumMemorySize = memoryManager->getMaximumSize(&_vmemHandle);
 
+	bool backgroundHeapCommit = extensions->backgroundHeapCommit;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/* split heap extents are committed through MM_HeapSplit */
+	backgroundHeapCommit = backgroundHeapCommit && !extensions->enableSplitHeap;
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	if (backgroundHeapCommit) {
+		_commitHelper = MM_HeapCommitHelper::newInstance(env, &_vmemHandle, memoryManager->getPageSize(&_vmemHandle));
+		if (NULL == _commitHelper) {
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -140,6 +153,11 @@ MM_HeapVirtualMemory::tearDown(MM_EnvironmentBase* env)
 		manager->destroyRegionTable(env);
 	}
 
+	if (NULL != _commitHelper) {
+		_commitHelper->kill(env);
+		_commitHelper = NULL;
+	}
+
 	memoryManager->destroyVirtualMemoryForHeap(env, &_vmemHandle);
 
 	MM_Heap::tearDown(env);
@@ -320,6 +338,11 @@ MM_HeapVirtualMemory::commitMemory(void* address, uintptr_t size)
 	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
 	MM_MemoryManager* memoryManager = extensions->memoryManager;
 
+	if (NULL != _commitHelper) {
+		/* stop background work on the range, memory committed ahead is simply committed again */
+		_commitHelper->claimRange(address, size);
+	}
+
 	bool resultCommitMemory = memoryManager->commitMemory(&_vmemHandle, address, size);
 
 	if (resultCommitMemory && extensions->pretouchHeapOnExpand) {
@@ -29,6 +29,7 @@
 #include "MemoryHandle.hpp"
 
 class MM_EnvironmentBase;
+class MM_HeapCommitHelper;
 class MM_HeapRegionManager;
 class MM_MemorySubSpace;
 class MM_PhysicalArena;
@@ -39,6 +40,7 @@ protected:
 	uintptr_t _heapAlignment;
 
 	MM_PhysicalArena* _physicalArena;
+	MM_HeapCommitHelper* _commitHelper; /**< commits and decommits heap memory outside of the GC pauses, NULL if disabled */
 
 private:
 protected:
@@ -69,6 +71,7 @@ public:
 
 	virtual bool commitMemory(void* address, uintptr_t size);
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+	virtual MM_HeapCommitHelper* getCommitHelper() { return _commitHelper; }
 
 	virtual uintptr_t calculateOffsetFromHeapBase(void* address);
 
@@ -84,6 +87,7 @@ public:
 		, _vmemHandle()
 		, _heapAlignment(heapAlignment)
 		, _physicalArena(NULL)
+		, _commitHelper(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
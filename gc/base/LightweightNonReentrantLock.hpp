@@ -90,6 +90,21 @@ public:
 		return true;
 	};
 
+	/**
+	 * Try to acquire the lock without waiting for it.
+	 *
+	 * @return TRUE if the lock was acquired, FALSE if it is held by another thread
+	 * @note Creates a load/store barrier on success.
+	 */
+	MMINLINE bool tryAcquire()
+	{
+#if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
+		return (0 == omrgc_spinlock_try_acquire(&_spinlock, _tracing));
+#else /* J9MODRON_USE_CUSTOM_SPINLOCKS */
+		return (0 == MUTEX_TRY_ENTER(_mutex));
+#endif /* J9MODRON_USE_CUSTOM_SPINLOCKS */
+	};
+
 	/**
 	 * Release the lock.
 	 * If the current thread is not the owner of the lock, the
@@ -31,6 +31,9 @@
 #include "ConcurrentGCStats.hpp"
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #include "Configuration.hpp"
+#if defined(OMR_GC_MODRON_COMPACTION)
+#include "ConcurrentCompactScheme.hpp"
+#endif /* OMR_GC_MODRON_COMPACTION */
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
@@ -215,6 +218,12 @@ MM_MarkingScheme::workerCleanupAfterGC(MM_EnvironmentBase *env)
 	_delegate.workerCleanupAfterGC(env);
 #if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
 	_extensions->globalGCStats.markStats.merge(&env->_markStats);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if (_extensions->numaAwareGCThreads) {
+		MM_WorkPacketStats *workPacketStats = &env->_workPacketStats;
+		workPacketStats->numaNodeStats.recordThread(env->getNumaNodeIndex(), workPacketStats->packetFetchCount, workPacketStats->packetFetchRemoteCount);
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	_extensions->globalGCStats.workPacketStats.merge(&env->_workPacketStats);
 #endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
 }
@@ -412,6 +421,15 @@ MM_MarkingScheme::createWorkPackets(MM_EnvironmentBase *env)
 
 bool
 MM_MarkingScheme::fixupForwardedSlot(omrobjectptr_t *slotPtr) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+	if (NULL != _concurrentCompactFixupScheme) {
+		omrobjectptr_t forwardPtr = _concurrentCompactFixupScheme->getForwardedObject(*slotPtr);
+		if (NULL != forwardPtr) {
+			*slotPtr = forwardPtr;
+			return true;
+		}
+	}
+#endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool const compressed = _extensions->compressObjectReferences();
 	if (_extensions->getGlobalCollector()->isStwCollectionInProgress()) {
@@ -38,6 +38,8 @@
 #include "ObjectScannerState.hpp"
 #include "WorkStack.hpp"
 
+class MM_ConcurrentCompactScheme;
+
 /**
  * @todo Provide class documentation
  */
@@ -56,6 +58,9 @@ protected:
 	MM_WorkPackets *_workPackets;
 	void *_heapBase;
 	void *_heapTop;
+#if defined(OMR_GC_MODRON_COMPACTION)
+	MM_ConcurrentCompactScheme *_concurrentCompactFixupScheme; /**< set while marking must heal references to objects evacuated by concurrent compaction */
+#endif /* OMR_GC_MODRON_COMPACTION */
 
 public:
 
@@ -286,10 +291,15 @@ public:
 	 * During Concurrent Marking, ignore forwarded objects (especially true for self-forwarded objects which are very important
 	 * during Scavenger aborted cycle to prevent duplicate copies). The fixup will be done after Scavenger Cycle is done, 
 	 * in the final phase of Concurrent GC when we scan Nursery. 
+	 * The mark of the global GC closing a concurrent compaction evacuation uses it the same way to heal references to evacuated objects.
 	 */
 
 	MMINLINE void fixupForwardedSlot(GC_SlotObject *slotObject) {
-		if (_extensions->isConcurrentScavengerEnabled() && _extensions->isScavengerBackOutFlagRaised()) {
+		if ((_extensions->isConcurrentScavengerEnabled() && _extensions->isScavengerBackOutFlagRaised())
+#if defined(OMR_GC_MODRON_COMPACTION)
+			|| (NULL != _concurrentCompactFixupScheme)
+#endif /* OMR_GC_MODRON_COMPACTION */
+		) {
 			omrobjectptr_t slot = slotObject->readReferenceFromSlot();
 			if (fixupForwardedSlot(&slot)) {
 				slotObject->writeReferenceToSlot(slot);
@@ -298,6 +308,15 @@ public:
 	}
 
 	bool fixupForwardedSlot(omrobjectptr_t *slotPtr);
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/**
+	 * Heal slots referring to objects evacuated by concurrent compaction while marking.
+	 * @param concurrentCompactScheme the scheme whose evacuation is complete, or NULL once the mark is done
+	 */
+	void setConcurrentCompactFixupScheme(MM_ConcurrentCompactScheme *concurrentCompactScheme) { _concurrentCompactFixupScheme = concurrentCompactScheme; }
+#endif /* OMR_GC_MODRON_COMPACTION */
+
 	virtual uintptr_t setupIndexableScanner(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, MM_MarkingSchemeScanReason reason, uintptr_t *sizeToDo, uintptr_t *sizeInElementsToDo, fomrobject_t **basePtr, uintptr_t *flags);
 
 	/**
@@ -312,6 +331,9 @@ public:
 		, _workPackets(NULL)
 		, _heapBase(NULL)
 		, _heapTop(NULL)
+#if defined(OMR_GC_MODRON_COMPACTION)
+		, _concurrentCompactFixupScheme(NULL)
+#endif /* OMR_GC_MODRON_COMPACTION */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -570,10 +570,206 @@ fail_allocate:
 	return NULL;
 }
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+bool
+MM_MemoryPoolAddressOrderedList::refillFreeEntryCache(MM_EnvironmentBase *env, uintptr_t entrySize, bool forTLH)
+{
+	MM_FreeEntryCache *cache = &env->_freeEntryCache;
+	uintptr_t entryCount = 0;
+
+	if ((this != cache->getMemoryPool()) && cache->hasPendingAllocations()) {
+		/* the cache is empty, but still holds allocations of the pool it served before */
+		cache->release(env);
+		cache->_lockAcquisitions += 1;
+	}
+
+	_heapLock.acquire();
+	cache->reportPendingAllocations(_largeObjectAllocateStats);
+	while (entryCount < _extensions->freeEntryCacheBatchSize) {
+		void *addrBase = NULL;
+		void *addrTop = NULL;
+		/* the allocations are recorded as the cache serves them from the entries */
+		if (forTLH) {
+			if (!internalAllocateTLH(env, entrySize, addrBase, addrTop, false, NULL)) {
+				break;
+			}
+		} else {
+			addrBase = internalAllocate(env, entrySize, false, NULL);
+			if (NULL == addrBase) {
+				break;
+			}
+			addrTop = (void *)((uintptr_t)addrBase + entrySize);
+		}
+		cache->addEntry(env, this, addrBase, (uintptr_t)addrTop - (uintptr_t)addrBase);
+		entryCount += 1;
+	}
+	_heapLock.release();
+
+	cache->_lockAcquisitions += 1;
+	if (0 != entryCount) {
+		cache->_refills += 1;
+	}
+	return 0 != entryCount;
+}
+
+void
+MM_MemoryPoolAddressOrderedList::recordFreeEntryCacheAllocation(MM_EnvironmentBase *env, uintptr_t size, bool tlh)
+{
+	MM_FreeEntryCache *cache = &env->_freeEntryCache;
+
+	/* object allocation statistics ignore objects below the threshold */
+	if (tlh || (size >= _largeObjectAllocateStats->getLargeObjectThreshold())) {
+		if (!cache->addPendingAllocation(size, tlh)) {
+			_heapLock.acquire();
+			cache->reportPendingAllocations(_largeObjectAllocateStats);
+			_heapLock.release();
+			cache->_lockAcquisitions += 1;
+			cache->addPendingAllocation(size, tlh);
+		}
+	}
+}
+
+void
+MM_MemoryPoolAddressOrderedList::returnFreeEntryCache(MM_EnvironmentBase *env, MM_FreeEntryCache *cache)
+{
+	bool const compressed = compressObjectReferences();
+	MM_HeapLinkedFreeHeader *entry = cache->takeEntries(env);
+
+	_heapLock.acquire();
+	cache->reportPendingAllocations(_largeObjectAllocateStats);
+
+	/* The entries are in address order, so a single walk of the free list finds where each of them goes */
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+	MM_HeapLinkedFreeHeader *currentFreeEntry = _heapFreeList;
+	bool returned = false;
+	while (NULL != entry) {
+		MM_HeapLinkedFreeHeader *nextEntry = entry->getNext(compressed);
+		uintptr_t entrySize = entry->getSize();
+
+		while ((NULL != currentFreeEntry) && (currentFreeEntry < entry)) {
+			previousFreeEntry = currentFreeEntry;
+			currentFreeEntry = currentFreeEntry->getNext(compressed);
+		}
+
+		MM_HeapLinkedFreeHeader *freeEntry = NULL;
+		if ((NULL != previousFreeEntry) && (previousFreeEntry->afterEnd() == entry)) {
+			_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(previousFreeEntry->getSize());
+			previousFreeEntry->expandSize(entrySize);
+			freeEntry = previousFreeEntry;
+		} else if (entrySize >= _minimumFreeEntrySize) {
+			if (NULL == previousFreeEntry) {
+				_heapFreeList = entry;
+			} else {
+				previousFreeEntry->setNext(entry, compressed);
+			}
+			entry->setNext(currentFreeEntry, compressed);
+			_freeEntryCount += 1;
+			freeEntry = entry;
+		}
+
+		if (NULL != freeEntry) {
+			if ((NULL != currentFreeEntry) && (freeEntry->afterEnd() == currentFreeEntry)) {
+				_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
+				freeEntry->expandSize(currentFreeEntry->getSize());
+				currentFreeEntry = currentFreeEntry->getNext(compressed);
+				freeEntry->setNext(currentFreeEntry, compressed);
+				_freeEntryCount -= 1;
+			}
+			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(freeEntry->getSize());
+			_freeMemorySize += entrySize;
+			previousFreeEntry = freeEntry;
+			returned = true;
+		}
+		/* otherwise the entry is too small to be a free entry and stays a hole */
+
+		entry = nextEntry;
+	}
+
+	if (returned) {
+		/* entries may have been inserted before or merged with hinted entries */
+		clearHints();
+	}
+	_heapLock.release();
+}
+
+void *
+MM_MemoryPoolAddressOrderedList::allocateFromFreeEntryCache(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired)
+{
+	MM_FreeEntryCache *cache = &env->_freeEntryCache;
+	void *addr = cache->allocateObject(env, sizeInBytesRequired, _minimumFreeEntrySize);
+
+	if (NULL != addr) {
+		cache->_hits += 1;
+		recordFreeEntryCacheAllocation(env, sizeInBytesRequired, false);
+	} else {
+		cache->_misses += 1;
+		uintptr_t classIndex = MM_FreeEntryCache::getCeilingClassIndex(sizeInBytesRequired);
+		if (cache->canRefill(this, classIndex)) {
+			if (refillFreeEntryCache(env, MM_FreeEntryCache::getClassSize(classIndex), false)) {
+				addr = cache->allocateObject(env, sizeInBytesRequired, _minimumFreeEntrySize);
+				if (NULL != addr) {
+					recordFreeEntryCacheAllocation(env, sizeInBytesRequired, false);
+				}
+			} else {
+				cache->setExhausted(this, classIndex);
+			}
+		}
+		if (NULL == addr) {
+			/* no entry of the class size is left, the caller falls back to an exact fit under the lock */
+			cache->_lockAcquisitions += 1;
+		}
+	}
+
+	return addr;
+}
+
+bool
+MM_MemoryPoolAddressOrderedList::allocateTLHFromFreeEntryCache(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
+{
+	MM_FreeEntryCache *cache = &env->_freeEntryCache;
+	bool result = cache->allocateTLH(env, maximumSizeInBytesRequired, _minimumFreeEntrySize, false, addrBase, addrTop);
+
+	if (result) {
+		cache->_hits += 1;
+		recordFreeEntryCacheAllocation(env, (uintptr_t)addrTop - (uintptr_t)addrBase, true);
+	} else {
+		cache->_misses += 1;
+		/* the pool hands out TLHs smaller than requested, so may the cache once it was refilled */
+		if (cache->canRefill(this, 0)) {
+			if (refillFreeEntryCache(env, maximumSizeInBytesRequired, true)) {
+				result = cache->allocateTLH(env, maximumSizeInBytesRequired, _minimumFreeEntrySize, true, addrBase, addrTop);
+				if (result) {
+					recordFreeEntryCacheAllocation(env, (uintptr_t)addrTop - (uintptr_t)addrBase, true);
+				}
+			} else {
+				/* a TLH fits any free entry, the free list is empty */
+				cache->setExhausted(this, 0);
+			}
+		}
+		if (!result) {
+			cache->_lockAcquisitions += 1;
+		}
+	}
+
+	return result;
+}
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+
 void *
 MM_MemoryPoolAddressOrderedList::allocateObject(MM_EnvironmentBase *env,  MM_AllocateDescription *allocDescription)
 {
-	void * addr = internalAllocate(env, allocDescription->getContiguousBytes(), true, _largeObjectAllocateStats);
+	void *addr = NULL;
+	uintptr_t sizeInBytesRequired = allocDescription->getContiguousBytes();
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	if (canUseFreeEntryCache(env, sizeInBytesRequired)) {
+		addr = allocateFromFreeEntryCache(env, sizeInBytesRequired);
+	}
+	if (NULL == addr)
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+	{
+		addr = internalAllocate(env, sizeInBytesRequired, true, _largeObjectAllocateStats);
+	}
 
 	if (addr != NULL) {
 #if defined(OMR_GC_ALLOCATION_TAX)
@@ -775,8 +971,19 @@ MM_MemoryPoolAddressOrderedList::allocateTLH(MM_EnvironmentBase *env, MM_Allocat
 											uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
 {
 	void *tlhBase = NULL;
+	bool allocated = false;
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	if (canUseFreeEntryCache(env, maximumSizeInBytesRequired)) {
+		allocated = allocateTLHFromFreeEntryCache(env, maximumSizeInBytesRequired, addrBase, addrTop);
+	}
+	if (!allocated)
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+	{
+		allocated = internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, true, _largeObjectAllocateStats);
+	}
 
-	if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, true, _largeObjectAllocateStats)) {
+	if (allocated) {
 		tlhBase = addrBase;
 	}
 
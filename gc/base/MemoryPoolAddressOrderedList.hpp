@@ -85,6 +85,35 @@ private:
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	uintptr_t getConsumedSizeForTLH(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry, uintptr_t maximumSizeInBytesRequired);
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	/**
+	 * @return true if a mutator allocation of the given size may be served by the free entry cache of the thread
+	 */
+	MMINLINE bool canUseFreeEntryCache(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired)
+	{
+		return _extensions->freeEntryCache
+			&& (sizeInBytesRequired <= FREE_ENTRY_CACHE_LARGEST_CLASS_SIZE)
+			&& !isAlignmentForParallelGCRequired()
+			&& env->_freeEntryCache.canCacheFor(this);
+	}
+
+	/**
+	 * Take a batch of entries of the given size from the free list, under a single acquisition of the pool lock,
+	 * and hand them to the free entry cache of the thread.
+	 * @param forTLH if true the entries are allocated as TLHs, and may be smaller than entrySize
+	 * @return true if at least one entry was cached
+	 */
+	bool refillFreeEntryCache(MM_EnvironmentBase *env, uintptr_t entrySize, bool forTLH);
+
+	/**
+	 * Remember an allocation served by the free entry cache of the thread, so that it is recorded in the
+	 * allocation statistics of the pool the next time the pool lock is taken for the cache.
+	 */
+	void recordFreeEntryCacheAllocation(MM_EnvironmentBase *env, uintptr_t size, bool tlh);
+	void *allocateFromFreeEntryCache(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired);
+	bool allocateTLHFromFreeEntryCache(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop);
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+
 	/* Align a TLH to meet boundary restrictions. Certain phases of some GCs may require that TLHs not span heap chunks for parallel processing. */
 	bool alignTLHForParallelGC(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry, uintptr_t *consumedSize);
 
@@ -157,6 +186,14 @@ public:
 	bool recycleHeapChunk(MM_EnvironmentBase *env, void* chunkBase, void* chunkTop);
 	bool recycleHeapChunk(void *addrBase, void *addrTop, MM_HeapLinkedFreeHeader *previousFreeEntry, MM_HeapLinkedFreeHeader *nextFreeEntry);
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	/**
+	 * Merge the entries of a free entry cache filled from this pool back into the free list, and record the
+	 * allocations the cache served, under one acquisition of the pool lock.
+	 */
+	void returnFreeEntryCache(MM_EnvironmentBase *env, MM_FreeEntryCache *cache);
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+
 	virtual void *findFreeEntryEndingAtAddr(MM_EnvironmentBase *env, void *addr);
 	virtual uintptr_t getAvailableContractionSizeForRangeEndingAt(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, void *lowAddr, void *highAddr);
 	virtual void *findFreeEntryTopStartingAtAddr(MM_EnvironmentBase *env, void *addr);
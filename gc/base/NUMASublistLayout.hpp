@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(NUMASUBLISTLAYOUT_HPP_)
+#define NUMASUBLISTLAYOUT_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+/**
+ * Maps GC threads onto the sublists of a split work list (packet lists, scan cache lists).
+ * When GC threads are NUMA-aware the sublists are grouped by NUMA affinity leader, a thread
+ * pushes to a sublist of its own node and visits the sublists of its own node before those of
+ * other nodes. Otherwise threads are hashed over all sublists by environment ID.
+ * @ingroup GC_Base_Core
+ */
+class MM_NUMASublistLayout
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t _nodeCount; /**< number of node groups the sublists are split into, 1 if GC threads are not NUMA-aware */
+	uintptr_t _sublistsPerNode; /**< number of sublists in each node group */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * Lay out the sublists of a list.
+	 *
+	 * @param env the current environment
+	 * @param sublistCount the requested number of sublists
+	 *
+	 * @return the number of sublists the list must provide, a multiple of the node count at least as large as requested
+	 */
+	MMINLINE uintptr_t
+	initialize(MM_EnvironmentBase *env, uintptr_t sublistCount)
+	{
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		uintptr_t nodeCount = extensions->_numaManager.getAffinityLeaderCount();
+
+		if (extensions->numaAwareGCThreads && (1 < nodeCount)) {
+			_nodeCount = nodeCount;
+			_sublistsPerNode = (sublistCount + nodeCount - 1) / nodeCount;
+		} else {
+			_nodeCount = 1;
+			_sublistsPerNode = sublistCount;
+		}
+
+		return _nodeCount * _sublistsPerNode;
+	}
+
+	/**
+	 * Determine the sublist a thread should visit at a given step of a search. Step 0 is the
+	 * sublist the thread pushes to; the first getSublistsPerNode() steps cover its own node.
+	 *
+	 * @param env the current environment
+	 * @param step the number of sublists already visited, less than the total sublist count
+	 *
+	 * @return an index into the sublist array
+	 */
+	MMINLINE uintptr_t
+	getSublistIndex(MM_EnvironmentBase *env, uintptr_t step)
+	{
+		uintptr_t offset = env->getEnvironmentId() + step;
+		uintptr_t node = 0;
+
+		if (1 < _nodeCount) {
+			node = env->getNumaNodeIndex();
+			if (step >= _sublistsPerNode) {
+				/* walk the other nodes in order, starting with the one after the home node */
+				node += 1 + ((step - _sublistsPerNode) / _sublistsPerNode);
+				offset -= _sublistsPerNode;
+			}
+			node %= _nodeCount;
+		}
+
+		return (node * _sublistsPerNode) + (offset % _sublistsPerNode);
+	}
+
+	/**
+	 * @param step the number of sublists already visited
+	 * @return true if the sublist visited at this step belongs to another node
+	 */
+	MMINLINE bool
+	isRemoteStep(uintptr_t step)
+	{
+		return step >= _sublistsPerNode;
+	}
+
+	/**
+	 * @return true if the sublists are grouped by NUMA node
+	 */
+	MMINLINE bool
+	isNodeLocal()
+	{
+		return 1 < _nodeCount;
+	}
+
+	/**
+	 * Create a NUMASublistLayout object.
+	 */
+	MM_NUMASublistLayout()
+		: _nodeCount(1)
+		, _sublistsPerNode(1)
+	{
+	}
+};
+
+#endif /* NUMASUBLISTLAYOUT_HPP_ */
@@ -28,13 +28,14 @@
 #include "PacketList.hpp"
 
 bool 
-MM_PacketList::initialize(MM_EnvironmentBase *env)
+MM_PacketList::initialize(MM_EnvironmentBase *env, bool removable)
 {
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 	
-	_sublistCount = extensions->packetListSplit;
-	Assert_MM_true(0 < _sublistCount);
+	_lockFree = extensions->packetListLockFree && !removable;
+	Assert_MM_true(0 < extensions->packetListSplit);
+	_sublistCount = _layout.initialize(env, extensions->packetListSplit);
 
 	_sublists = (PacketSublist *)extensions->getForge()->allocate(
 			sizeof(PacketSublist) * _sublistCount,
@@ -59,10 +60,11 @@ bool
 MM_PacketList::reinitializeForRestore(MM_EnvironmentBase *env)
 {
 	MM_GCExtensionsBase *extensions = env->getExtensions();
-	uintptr_t newSublistCount = extensions->packetListSplit;
 	bool result = true;
 
-	Assert_MM_true(0 < newSublistCount);
+	Assert_MM_true(0 < extensions->packetListSplit);
+	MM_NUMASublistLayout newLayout;
+	uintptr_t newSublistCount = newLayout.initialize(env, extensions->packetListSplit);
 
 	if (newSublistCount > _sublistCount) {
 		PacketSublist *newSublists = (PacketSublist *)extensions->getForge()->allocate(
@@ -87,6 +89,7 @@ MM_PacketList::reinitializeForRestore(MM_EnvironmentBase *env)
 				extensions->getForge()->free(_sublists);
 				_sublists = newSublists;
 				_sublistCount = newSublistCount;
+				_layout = newLayout;
 			}
 		}
 	}
@@ -109,6 +112,29 @@ MM_PacketList::tearDown(MM_EnvironmentBase *env)
 	}
 }
 
+MM_Packet *
+MM_PacketList::popLockFree(MM_EnvironmentBase *env)
+{
+	for (uintptr_t pass = 0; pass < 2; pass++) {
+		bool wait = (1 == pass);
+		for (uintptr_t i = 0; i < _sublistCount; i++) {
+			PacketSublist *list = &_sublists[getSublistIndex(env, i)];
+
+			if ((NULL != list->_head) && acquireSublist(env, list, wait)) {
+				MM_Packet *packet = popLockedLockFreeSublist(env, list);
+				list->_lock.release();
+
+				if (NULL != packet) {
+					recordFetchStep(env, i);
+					return packet;
+				}
+			}
+		}
+	}
+
+	return NULL;
+}
+
 void 
 MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
 {
@@ -116,6 +142,24 @@ MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
 	PacketSublist *list = &_sublists[0];
 	MM_Packet *current = head;
 	uintptr_t i;
+
+	if (_lockFree) {
+		for (i = 0; i < count; ++i) {
+			current->setSublistIndex(0);
+			current = current->_next;
+		}
+		incrementCount(count);
+		MM_Packet *oldHead = list->_head;
+		for (;;) {
+			tail->_next = oldHead;
+			MM_Packet *result = (MM_Packet *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&list->_head, (uintptr_t)oldHead, (uintptr_t)head);
+			if (result == oldHead) {
+				break;
+			}
+			oldHead = result;
+		}
+		return;
+	}
 	
 	list->_lock.acquire();
 	
@@ -151,29 +195,59 @@ MM_PacketList::popList(MM_Packet **head, MM_Packet **tail, uintptr_t *count)
 		list->_lock.acquire();
 	}
 
-	/* accumulate all of the packets into a single list */
-	for (uintptr_t i = 0; i < _sublistCount; i++) {
-		PacketSublist *list = &_sublists[i];
-	
-		if (NULL != list->_head) {
-			didPop = true;
+	if (_lockFree) {
+		/* the locks only exclude other removals, detach each sublist with a compare-and-swap against concurrent pushes */
+		uintptr_t detached = 0;
+		for (uintptr_t i = 0; i < _sublistCount; i++) {
+			PacketSublist *list = &_sublists[i];
+			MM_Packet *sublistHead = list->_head;
+			while ((NULL != sublistHead) && ((uintptr_t)sublistHead != MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&list->_head, (uintptr_t)sublistHead, (uintptr_t)NULL))) {
+				sublistHead = list->_head;
+			}
+			if (NULL != sublistHead) {
+				didPop = true;
+				if (NULL == *head) {
+					*head = sublistHead;
+				} else {
+					(*tail)->_next = sublistHead;
+				}
+				/* lock-free sublists do not track their tail or back links */
+				MM_Packet *previous = *tail;
+				for (MM_Packet *current = sublistHead; NULL != current; current = current->_next) {
+					current->_previous = previous;
+					previous = current;
+					detached += 1;
+				}
+				*tail = previous;
+			}
+		}
+		decrementCount(detached);
+		*count = detached;
+	} else {
+		/* accumulate all of the packets into a single list */
+		for (uintptr_t i = 0; i < _sublistCount; i++) {
+			PacketSublist *list = &_sublists[i];
+		
+			if (NULL != list->_head) {
+				didPop = true;
 
-			if (NULL == *head) {
-				*head = list->_head;
-			} else {
-				(*tail)->_next = list->_head;
+				if (NULL == *head) {
+					*head = list->_head;
+				} else {
+					(*tail)->_next = list->_head;
+				}
+				Assert_MM_true(NULL != list->_tail);
+				*tail = list->_tail;
+		
+				list->_head = NULL;
+				list->_tail = NULL;
 			}
-			Assert_MM_true(NULL != list->_tail);
-			*tail = list->_tail;
-	
-			list->_head = NULL;
-			list->_tail = NULL;
 		}
+
+		*count = _count;
+		_count = 0;
 	}
 	
-	*count = _count;
-	_count = 0;
-	
 	/* release all of our locks */
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
 		PacketSublist *list = &_sublists[i];
@@ -189,6 +263,9 @@ MM_PacketList::remove(MM_Packet *packetToRemove)
 	PacketSublist *list = &_sublists[packetToRemove->getSublistIndex()];
 	MM_Packet *previous = NULL;
 	MM_Packet *next = NULL;
+
+	/* removable lists are never lock-free (see initialize()) */
+	Assert_MM_false(_lockFree);
 	
 	list->_lock.acquire();
 	
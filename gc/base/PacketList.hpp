@@ -36,6 +36,7 @@
 #include "BaseNonVirtual.hpp"
 #include "EnvironmentBase.hpp"
 #include "LightweightNonReentrantLock.hpp"
+#include "NUMASublistLayout.hpp"
 #include "Packet.hpp"
 
 class MM_GCExtensionsBase;
@@ -46,9 +47,9 @@ class MM_PacketList: public MM_BaseNonVirtual
 /* Data Section */
 public:
 	struct PacketSublist {
-		MM_Packet *_head;  /**< Head of the list */
-		MM_Packet *_tail;  /**< Tail of the list */
-		MM_LightweightNonReentrantLock _lock;  /**< Lock for getting/putting packets */
+		MM_Packet * volatile _head;  /**< Head of the list */
+		MM_Packet *_tail;  /**< Tail of the list (not maintained by lock-free lists) */
+		MM_LightweightNonReentrantLock _lock;  /**< Lock for getting/putting packets (only serializes removal for lock-free lists) */
 
 		bool initialize(MM_EnvironmentBase *env)
 		{
@@ -71,7 +72,9 @@ private:
 	PacketSublist *_sublists;	/**< An array of PacketSublist structures which is _sublistCount elements long */
 	
 	uintptr_t _sublistCount; /**< The number of lists (split for parallelism). Must be at least 1 */
+	MM_NUMASublistLayout _layout; /**< Maps threads onto the sublists, grouping them by NUMA node when GC threads are NUMA-aware */
 	volatile uintptr_t _count;  /**< Number of items in the list */
+	bool _lockFree; /**< true if packets are pushed with compare-and-swap rather than under the sublist lock */
 	
 /* Functionality Section */
 private:
@@ -83,7 +86,7 @@ private:
 	 */
 	void incrementCount(uintptr_t value)
 	{
-		if (1 == _sublistCount) {
+		if ((1 == _sublistCount) && !_lockFree) {
 			_count += value;
 		} else {
 			/* use an atomic, as the locks have been split up */
@@ -99,7 +102,7 @@ private:
 	 */
 	void decrementCount(uintptr_t value)
 	{
-		if (1 == _sublistCount) {
+		if ((1 == _sublistCount) && !_lockFree) {
 			_count -= value;
 		} else {
 			/* use an atomic, as the locks have been split up */
@@ -112,20 +115,102 @@ private:
 	 * it should use
 	 * 
 	 * @param env the current environment
+	 * @param step the number of sublists already visited by the current search
 	 * 
 	 * @return an index into the _sublists array
 	 */
 	MMINLINE uintptr_t
-	getSublistIndex(MM_EnvironmentBase *env)
+	getSublistIndex(MM_EnvironmentBase *env, uintptr_t step = 0)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		return _layout.getSublistIndex(env, step);
 	}
-		
+
+	/**
+	 * Count a packet taken from a sublist of another NUMA node.
+	 *
+	 * @param env the current environment
+	 * @param step the search step at which the packet was found
+	 */
+	MMINLINE void
+	recordFetchStep(MM_EnvironmentBase *env, uintptr_t step)
+	{
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		if (_layout.isRemoteStep(step)) {
+			env->_workPacketStats.packetFetchRemoteCount += 1;
+		}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	}
+
+	/**
+	 * Acquire the removal lock of a sublist, counting contention in the work packet stats.
+	 *
+	 * @param env the current environment
+	 * @param list the sublist to lock
+	 * @param wait true to wait for the lock, false to give up if it is held by another thread
+	 *
+	 * @return true if the lock was acquired
+	 */
+	MMINLINE bool
+	acquireSublist(MM_EnvironmentBase *env, PacketSublist *list, bool wait)
+	{
+		if (list->_lock.tryAcquire()) {
+			return true;
+		}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.packetListContentionCount += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		if (wait) {
+			list->_lock.acquire();
+		}
+		return wait;
+	}
+
+	/**
+	 * Remove the first packet of a lock-free sublist. Pushes may run concurrently, but the caller
+	 * must hold the sublist lock so that no other removal can recycle the head (ABA) while the
+	 * compare-and-swap is pending.
+	 *
+	 * @param env the current environment
+	 * @param list the locked sublist
+	 *
+	 * @return the packet, or NULL if the sublist is empty
+	 */
+	MMINLINE MM_Packet *
+	popLockedLockFreeSublist(MM_EnvironmentBase *env, PacketSublist *list)
+	{
+		MM_Packet *packet = list->_head;
+		while (NULL != packet) {
+			MM_Packet *next = packet->_next;
+			if ((uintptr_t)packet == MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&list->_head, (uintptr_t)packet, (uintptr_t)next)) {
+				decrementCount(1);
+				break;
+			}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.packetListContentionCount += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			packet = list->_head;
+		}
+		return packet;
+	}
+
+	/**
+	 * Pop a packet off of a lock-free packetList. Sublists being emptied by other threads are
+	 * skipped on the first pass, so a thread only waits when all non-empty sublists are busy.
+	 *
+	 * @return packet The packet removed from the list, or NULL if the list is empty
+	 */
+	MM_Packet *popLockFree(MM_EnvironmentBase *env);
+
 protected:
 	
 public:
 	
-	bool initialize(MM_EnvironmentBase *env);
+	/**
+	 * @param env the current environment
+	 * @param removable true if remove() will be used on this list. Lock-free lists are singly linked and
+	 * do not support removal of arbitrary packets, so removable lists always use locking.
+	 */
+	bool initialize(MM_EnvironmentBase *env, bool removable = false);
 	void tearDown(MM_EnvironmentBase *env);
 	
 	/**
@@ -161,8 +246,28 @@ public:
 	{
 		uintptr_t index = getSublistIndex(env);
 		PacketSublist *list = &_sublists[index];
+
+		if (_lockFree) {
+			packet->_previous = NULL;
+			packet->setSublistIndex(index);
+			/* count before publishing, so the count never drops below the number of packets on the list */
+			incrementCount(1);
+			MM_Packet *head = list->_head;
+			for (;;) {
+				packet->_next = head;
+				MM_Packet *oldHead = (MM_Packet *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&list->_head, (uintptr_t)head, (uintptr_t)packet);
+				if (oldHead == head) {
+					break;
+				}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				env->_workPacketStats.packetListContentionCount += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+				head = oldHead;
+			}
+			return;
+		}
 	
-		list->_lock.acquire();
+		acquireSublist(env, list, true);
 
 		packet->_next = list->_head;
 		packet->_previous = NULL;
@@ -185,14 +290,17 @@ public:
 	 */
 	MMINLINE MM_Packet *pop(MM_EnvironmentBase *env)
 	{
-		uintptr_t index = getSublistIndex(env);
+		if (_lockFree) {
+			return popLockFree(env);
+		}
+
 		MM_Packet *packet = NULL;
 
 		for (uintptr_t i = 0; i < _sublistCount; i++) {
-			PacketSublist *list = &_sublists[index];
+			PacketSublist *list = &_sublists[getSublistIndex(env, i)];
 
 			if (NULL != list->_head) {
-				list->_lock.acquire();
+				acquireSublist(env, list, true);
 				if (NULL != list->_head) {
 					packet = list->_head;
 					list->_head = packet->_next;
@@ -206,11 +314,10 @@ public:
 				list->_lock.release();
 
 				if (NULL != packet) {
+					recordFetchStep(env, i);
 					break;
 				}
 			}
-			
-			index = (index + 1) %  _sublistCount;
 		}
 
 		return packet;
@@ -263,6 +370,7 @@ public:
 		,_sublists(NULL)
 		,_sublistCount(0)
 		,_count(0)
+		,_lockFree(false)
 	{
 		_typeId = __FUNCTION__;
 	}
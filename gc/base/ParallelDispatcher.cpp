@@ -77,6 +77,9 @@ dispatcher_thread_proc2(OMRPortLibrary* portLib, void *info)
 	env->setWorkerID(workerID);
 	/* Enviroment initialization specific for GC threads (after worker ID is set) */
 	env->initializeGCThread();
+	if (dispatcher->_extensions->numaAwareGCThreads) {
+		dispatcher->bindThreadToNumaNode(env);
+	}
 
 	/* Signal that the thread was created succesfully */
 	workerInfo->workerFlags = WORKER_INFO_FLAG_OK;
@@ -626,6 +629,23 @@ MM_ParallelDispatcher::setThreadInitializationComplete(MM_EnvironmentBase *env)
 	omrthread_monitor_exit(_dispatcherMonitor);
 }
 
+void
+MM_ParallelDispatcher::bindThreadToNumaNode(MM_EnvironmentBase *env)
+{
+	uintptr_t affinityLeaderCount = 0;
+	J9MemoryNodeDetail const *affinityLeaders = _extensions->_numaManager.getAffinityLeaders(&affinityLeaderCount);
+
+	if (0 != affinityLeaderCount) {
+		uintptr_t nodeIndex = env->getWorkerID() % affinityLeaderCount;
+		env->setNumaNodeIndex(nodeIndex);
+		if (_extensions->_numaManager.isPhysicalNUMAEnabled()) {
+			uintptr_t nodeNumber = affinityLeaders[nodeIndex].j9NodeNumber;
+			/* a thread which can not be bound still prefers the lists of its node, which keeps its queued work together */
+			env->setNumaAffinity(&nodeNumber, 1);
+		}
+	}
+}
+
 #if defined(J9VM_OPT_CRIU_SUPPORT)
 void
 MM_ParallelDispatcher::prepareForCheckpoint(MM_EnvironmentBase *env, uintptr_t newThreadCount)
@@ -161,6 +161,15 @@ protected:
 	virtual uintptr_t recomputeActiveThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t newThreadCount); 
 
 	void setThreadInitializationComplete(MM_EnvironmentBase *env);
+
+	/**
+	 * Bind a GC thread to one of the NUMA affinity leaders, chosen round-robin by worker ID, and record
+	 * the leader index in its environment so that work lists can prefer work queued on the same node.
+	 * Simulated NUMA nodes only record the index.
+	 *
+	 * @param[in] env the environment of the GC thread, its worker ID must already be set
+	 */
+	void bindThreadToNumaNode(MM_EnvironmentBase *env);
 	
 	uintptr_t adjustThreadCount(uintptr_t maxThreadCount);
 	
@@ -29,6 +29,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapCommitHelper.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "HeapRegionManager.hpp"
 #include "MemorySubSpace.hpp"
@@ -225,6 +226,23 @@ MM_PhysicalSubArenaVirtualMemoryFlat::expandNoCheck(MM_EnvironmentBase *env, uin
 		} else {
 			genericSubSpace->heapReconfigured(env, HEAP_RECONFIG_EXPAND);
 		}
+
+		MM_HeapResizeStats *resizeStats = env->getExtensions()->heap->getResizeStats();
+		uintptr_t previousExpandSize = resizeStats->getLastExpandActualSize();
+		resizeStats->setLastExpandActualSize(expandSize);
+
+		/* A heap that expanded on demand is likely to expand again, by a step growing as the last one did: have it committed ahead */
+		MM_HeapCommitHelper *commitHelper = _heap->getCommitHelper();
+		ExpandReason expandReason = resizeStats->getLastExpandReason();
+		if ((NULL != commitHelper) && (NO_EXPAND != expandReason) && (HINT_PREVIOUS_RUNS != expandReason)) {
+			uintptr_t precommitSize = expandSize + ((expandSize > previousExpandSize) ? (expandSize - previousExpandSize) : 0);
+			precommitSize = OMR_MIN(precommitSize, ((MM_PhysicalArenaVirtualMemory *)_parent)->getPhysicalMaximumExpandSizeHigh(env, _highAddress));
+			if (NULL != _highArena) {
+				precommitSize = OMR_MIN(precommitSize, ((uintptr_t)_highArena->getLowAddress()) - ((uintptr_t)_highAddress));
+			}
+			precommitSize = OMR_MIN(precommitSize, _subSpace->maxExpansionInSpace(env));
+			commitHelper->requestPrecommit(env, _highAddress, precommitSize);
+		}
 	}
 
 	Assert_MM_true(_lowAddress == _region->getLowAddress());
@@ -307,8 +325,11 @@ MM_PhysicalSubArenaVirtualMemoryFlat::contract(MM_EnvironmentBase *env, uintptr_
 	/* Remove the range from the free list (must do this before decommiting */
 	genericSubSpace->removeExistingMemory(env, this, contractSize, (void *)contractBase, (void *)contractTop);
 
-	/* Everything is ok - decommit the memory */
-	_heap->decommitMemory((void *)contractBase, contractSize, lowValidAddress, highValidAddress);
+	/* Everything is ok - decommit the memory, after the pause if a background helper takes it */
+	MM_HeapCommitHelper *commitHelper = _heap->getCommitHelper();
+	if ((NULL == commitHelper) || !commitHelper->deferDecommit(env, (void *)contractBase, contractSize, lowValidAddress, highValidAddress)) {
+		_heap->decommitMemory((void *)contractBase, contractSize, lowValidAddress, highValidAddress);
+	}
 
 	/* Success - the area has been contracted.  Update internal values */
 	_highAddress = (void *)contractBase;
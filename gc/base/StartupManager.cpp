@@ -48,8 +48,26 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCBINARY_LOGGING "-Xgc:binaryLogging"
+#define OMR_XGCBINARY_LOGGING_LENGTH 18
+#define OMR_XGCASYNC_LOGGING "-Xgc:asyncLogging"
+#define OMR_XGCASYNC_LOGGING_LENGTH 17
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE "-Xgc:asyncLoggingBufferSize="
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH 28
+#define OMR_XGCASYNC_LOGGING_OVERFLOW "-Xgc:asyncLoggingOverflow="
+#define OMR_XGCASYNC_LOGGING_OVERFLOW_LENGTH 26
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#define OMR_XGCFREE_REGION_REFILL_BATCH_SIZE "-Xgc:freeRegionRefillBatchSize="
+#define OMR_XGCFREE_REGION_REFILL_BATCH_SIZE_LENGTH 31
+#define OMR_XGCSIZE_CLASS_PROFILE_FILE "-Xgc:sizeClassProfileFile="
+#define OMR_XGCSIZE_CLASS_PROFILE_FILE_LENGTH 26
+#define OMR_XGCSIZE_CLASS_PROFILE_DUMP_FILE "-Xgc:sizeClassProfileDumpFile="
+#define OMR_XGCSIZE_CLASS_PROFILE_DUMP_FILE_LENGTH 30
+#define OMR_XGCSEGREGATED_LAZY_SWEEP "-Xgc:segregatedLazySweep"
+#define OMR_XGCSEGREGATED_LAZY_SWEEP_LENGTH 24
+#endif /* OMR_GC_SEGREGATED_HEAP */
 
 uintptr_t
 MM_StartupManager::getUDATAValue(char *option, uintptr_t *outputValue)
@@ -276,6 +294,30 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCBINARY_LOGGING, OMR_XGCBINARY_LOGGING_LENGTH)) {
+		extensions->binaryLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING_BUFFER_SIZE, OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->asyncLoggingBufferSize = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING_OVERFLOW, OMR_XGCASYNC_LOGGING_OVERFLOW_LENGTH)) {
+		char *policy = option + OMR_XGCASYNC_LOGGING_OVERFLOW_LENGTH;
+		if (0 == strcmp(policy, "block")) {
+			extensions->asyncLoggingBlockOnOverflow = true;
+		} else if (0 == strcmp(policy, "drop")) {
+			extensions->asyncLoggingBlockOnOverflow = false;
+		} else {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING, OMR_XGCASYNC_LOGGING_LENGTH)) {
+		extensions->asyncLogging = true;
+	}
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -295,7 +337,27 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 			extensions->gcThreadCount = forcedThreadCount;
 			extensions->gcThreadCountForced = true;
 		}
-	} else {
+	}
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	else if (0 == strncmp(option, OMR_XGCFREE_REGION_REFILL_BATCH_SIZE, OMR_XGCFREE_REGION_REFILL_BATCH_SIZE_LENGTH)) {
+		uintptr_t batchSize = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCFREE_REGION_REFILL_BATCH_SIZE_LENGTH, &batchSize)) {
+			result = false;
+		} else {
+			extensions->freeRegionRefillBatchSize = batchSize;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSIZE_CLASS_PROFILE_FILE, OMR_XGCSIZE_CLASS_PROFILE_FILE_LENGTH)) {
+		result = setSizeClassProfileFile(extensions, option + OMR_XGCSIZE_CLASS_PROFILE_FILE_LENGTH);
+	}
+	else if (0 == strncmp(option, OMR_XGCSIZE_CLASS_PROFILE_DUMP_FILE, OMR_XGCSIZE_CLASS_PROFILE_DUMP_FILE_LENGTH)) {
+		result = setSizeClassProfileDumpFile(extensions, option + OMR_XGCSIZE_CLASS_PROFILE_DUMP_FILE_LENGTH);
+	}
+	else if (0 == strncmp(option, OMR_XGCSEGREGATED_LAZY_SWEEP, OMR_XGCSEGREGATED_LAZY_SWEEP_LENGTH)) {
+		extensions->segregatedLazySweep = true;
+	}
+#endif /* OMR_GC_SEGREGATED_HEAP */
+	else {
 		/* unknown option */
 		result = false;
 	}
@@ -303,6 +365,46 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	return result;
 }
 
+char *
+MM_StartupManager::copyOptionValue(char *previousValue, const char *value)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+	char *copy = (char *) omrmem_allocate_memory(strlen(value)+1, OMRMEM_CATEGORY_MM);
+	if (NULL != copy) {
+		strcpy(copy, value);
+		if (NULL != previousValue) {
+			omrmem_free_memory(previousValue);
+		}
+	}
+	return copy;
+}
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+bool
+MM_StartupManager::setSizeClassProfileFile(MM_GCExtensionsBase *extensions, const char *fileName)
+{
+	char *copy = copyOptionValue(sizeClassProfileFileName, fileName);
+	if (NULL == copy) {
+		return false;
+	}
+	sizeClassProfileFileName = copy;
+	extensions->sizeClassProfileFile = sizeClassProfileFileName;
+	return true;
+}
+
+bool
+MM_StartupManager::setSizeClassProfileDumpFile(MM_GCExtensionsBase *extensions, const char *fileName)
+{
+	char *copy = copyOptionValue(sizeClassProfileDumpFileName, fileName);
+	if (NULL == copy) {
+		return false;
+	}
+	sizeClassProfileDumpFileName = copy;
+	extensions->sizeClassProfileDumpFile = sizeClassProfileDumpFileName;
+	return true;
+}
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 void
 MM_StartupManager::tearDown(void)
 {
@@ -311,6 +413,16 @@ MM_StartupManager::tearDown(void)
 		omrmem_free_memory(verboseFileName);
 		verboseFileName = NULL;
 	}
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (NULL != sizeClassProfileFileName) {
+		omrmem_free_memory(sizeClassProfileFileName);
+		sizeClassProfileFileName = NULL;
+	}
+	if (NULL != sizeClassProfileDumpFileName) {
+		omrmem_free_memory(sizeClassProfileDumpFileName);
+		sizeClassProfileDumpFileName = NULL;
+	}
+#endif /* OMR_GC_SEGREGATED_HEAP */
 }
 
 bool
@@ -43,6 +43,10 @@ class MM_StartupManager
 	 */
 private:
 	char *verboseFileName;
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	char *sizeClassProfileFileName; /**< Copy of the sizeClassProfileFile option, read while the heap is initialized */
+	char *sizeClassProfileDumpFileName; /**< Copy of the sizeClassProfileDumpFile option, copied again by the segregated configuration */
+#endif /* OMR_GC_SEGREGATED_HEAP */
 
 protected:
 	OMR_VM *omrVM;
@@ -57,6 +61,7 @@ public:
 
 private:
 	void tearDown(void);
+	char *copyOptionValue(char *previousValue, const char *value);
 
 protected:
 	/* We want to be able to use this C++ class without a custom allocator
@@ -71,6 +76,20 @@ protected:
 	virtual char * getOptions(void) { return NULL; }
 	virtual bool parseLanguageOptions(MM_GCExtensionsBase *extensions) { return true; };
 	bool parseGcOptions(MM_GCExtensionsBase *extensions);
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	/**
+	 * Set the allocation size profile the small size classes are generated from. The name is copied, it only needs
+	 * to live for the duration of the call.
+	 * @return true if the name was set, false if memory is short
+	 */
+	bool setSizeClassProfileFile(MM_GCExtensionsBase *extensions, const char *fileName);
+	/**
+	 * Set the file the allocation size profile of the run is written to at shutdown. The name is copied, it only
+	 * needs to live for the duration of the call.
+	 * @return true if the name was set, false if memory is short
+	 */
+	bool setSizeClassProfileDumpFile(MM_GCExtensionsBase *extensions, const char *fileName);
+#endif /* OMR_GC_SEGREGATED_HEAP */
 
 public:
 	virtual MM_Configuration * createConfiguration(MM_EnvironmentBase *env);
@@ -86,6 +105,10 @@ public:
 
 	MM_StartupManager(OMR_VM *omrVM, uintptr_t defaultMinHeapSize, uintptr_t defaultMaxHeapSize)
 		: verboseFileName(NULL)
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		, sizeClassProfileFileName(NULL)
+		, sizeClassProfileDumpFileName(NULL)
+#endif /* OMR_GC_SEGREGATED_HEAP */
 		, omrVM(omrVM)
 		, defaultMinHeapSize(defaultMinHeapSize)
 		, defaultMaxHeapSize(defaultMaxHeapSize)
@@ -25,6 +25,7 @@
  * @ingroup GC_Base_Core
  */
 
+#include <math.h>
 #include <string.h>
 
 #include "omrcfg.h"
@@ -96,6 +97,13 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 	setAllZeroes();
 
 	_tlh->refreshSize = extensions->tlhInitialSize;
+
+	/* The allocation history does not carry over to the new cache */
+	_intervalBytesUsed = 0;
+	_intervalRefreshCount = 0;
+	_intervalRefreshWaste = 0;
+	_averageBytesUsed = 0.0;
+	_averageRefreshWaste = 0.0;
 }
 
 void
@@ -110,7 +118,68 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	updateAllocationHistory(env);
+	if (isAdaptivelySized(extensions)) {
+		_tlh->refreshSize = calculateAdaptiveRefreshSize(env);
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
+}
+
+void
+MM_TLHAllocationSupport::updateAllocationHistory(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (0 < _intervalRefreshCount) {
+		double refreshWaste = (double)_intervalRefreshWaste / (double)_intervalRefreshCount;
+		if (0.0 < _averageBytesUsed) {
+			_averageRefreshWaste = MM_Math::weightedAverage(_averageRefreshWaste, refreshWaste, extensions->tlhAllocationHistoryWeight);
+		} else {
+			_averageRefreshWaste = refreshWaste;
+		}
+	}
+	if (0.0 < _averageBytesUsed) {
+		_averageBytesUsed = MM_Math::weightedAverage(_averageBytesUsed, (double)_intervalBytesUsed, extensions->tlhAllocationHistoryWeight);
+	} else {
+		_averageBytesUsed = (double)_intervalBytesUsed;
+	}
+
+	_intervalBytesUsed = 0;
+	_intervalRefreshCount = 0;
+	_intervalRefreshWaste = 0;
+}
+
+uintptr_t
+MM_TLHAllocationSupport::calculateAdaptiveRefreshSize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	/* A thread already past its average in this interval is allocating faster than it used to */
+	double bytesUsed = OMR_MAX(_averageBytesUsed, (double)_intervalBytesUsed);
+	double wasteBudget = (bytesUsed * (double)extensions->tlhWasteTargetPercent) / 100.0;
+
+	/* With a refresh size s, a thread allocating A bytes per interval refreshes A/s times and leaves r bytes unused
+	 * at each refresh, then on average s/2 bytes unused when the GC flushes its TLH: it wastes A*r/s + s/2 bytes.
+	 * Take the largest size, the fewest refreshes, whose waste fits the budget B (the larger root of s^2 - 2Bs + 2Ar),
+	 * or if no size does, the size that wastes the least (sqrt(2Ar)).
+	 */
+	double refreshWaste = 2.0 * bytesUsed * _averageRefreshWaste;
+	double discriminant = (wasteBudget * wasteBudget) - refreshWaste;
+	double refreshSize = 0.0;
+	if (0.0 <= discriminant) {
+		refreshSize = wasteBudget + sqrt(discriminant);
+	} else {
+		refreshSize = sqrt(refreshWaste);
+	}
+
+	if (refreshSize < (double)extensions->tlhMinimumSize) {
+		return extensions->tlhMinimumSize;
+	}
+	if (refreshSize > (double)extensions->tlhMaximumSize) {
+		return extensions->tlhMaximumSize;
+	}
+	return MM_Math::roundToCeiling(sizeof(uintptr_t), (uintptr_t)refreshSize);
 }
 
 bool
@@ -129,7 +198,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	uintptr_t abandonSize = (tlhMinimumSize > halfRefreshSize ? tlhMinimumSize : halfRefreshSize);
 	if (sizeInBytesRequired > abandonSize) {
 		/* increase thread hungriness if we did not refresh */
-		if (getRefreshSize() < tlhMaximumSize && sizeInBytesRequired < tlhMaximumSize) {
+		if (!isAdaptivelySized(extensions) && getRefreshSize() < tlhMaximumSize && sizeInBytesRequired < tlhMaximumSize) {
 			setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 		}
 		return false;
@@ -146,6 +215,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	stats->_tlhDiscardedBytes += getRemainingSize();
 	uintptr_t usedSize = getUsedSize();
 	stats->_tlhAllocatedUsed += usedSize;
+	_intervalBytesUsed += usedSize;
 
 	/* Try to cache the current TLH */
 	if ((NULL != getRealTop()) && (getRemainingSize() >= tlhMinimumSize)) {
@@ -166,6 +236,10 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		}
 		wipeTLH(env);
 	} else {
+		if (NULL != getMemoryPool()) {
+			stats->_tlhRefreshWasteBytes += getRemainingSize();
+			_intervalRefreshWaste += getRemainingSize();
+		}
 		clear(env);
 	}
 
@@ -252,11 +326,14 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		if (0 < getSize()) {
 			reportRefreshCache(env);
 			stats->_tlhRequestedBytes += getRefreshSize();
+			_intervalRefreshCount += 1;
 			/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
 			 * may not give you the size requested */
-			/* Increase thread hungriness */
-			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
+			if (isAdaptivelySized(extensions)) {
+				setRefreshSize(calculateAdaptiveRefreshSize(env));
+			} else if (getRefreshSize() < tlhMaximumSize) {
+				/* Increase thread hungriness */
+				/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 			reserveTLHTopForGC(env);
@@ -324,7 +401,19 @@ MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 		env->getExtensions()->getGlobalCollector()->preAllocCacheFlush(env, getBase(), lastTLHobj);
 	}
 
-	/* Since AllocationStats have been reset, reset the base as well*/
+	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
+	if (NULL != getMemoryPool()) {
+		stats->_tlhFlushWasteBytes += getRemainingSize();
+		_intervalBytesUsed += getUsedSize();
+	}
+	/* TLHs abandoned at refreshes and never reused are left unused too, account them as waste of those refreshes */
+	bool const compressed = env->compressObjectReferences();
+	for (MM_HeapLinkedFreeHeaderTLH *abandoned = _abandonedList; NULL != abandoned; abandoned = (MM_HeapLinkedFreeHeaderTLH *)abandoned->getNext(compressed)) {
+		stats->_tlhFlushWasteBytes += abandoned->getSize();
+		_intervalRefreshWaste += abandoned->getSize();
+	}
+
+	/* Forget the abandoned TLHs, the next sweep reclaims them */
 	_abandonedList = NULL;
 	_abandonedListSize = 0;
 	clear(env);
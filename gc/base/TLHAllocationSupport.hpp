@@ -84,9 +84,32 @@ private:
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
 	uintptr_t _reservedBytesForGC; /**< Number of bytes reserved in the TLH by collector. If set, we are guaranteed to have this remaining size available when we flush/clear TLH. */
+
+	uintptr_t _intervalBytesUsed; /**< TLH bytes allocated by the thread since the last GC */
+	uintptr_t _intervalRefreshCount; /**< TLH refreshes since the last GC */
+	uintptr_t _intervalRefreshWaste; /**< TLH remainders too small to be reused, left unused at refreshes since the last GC */
+	double _averageBytesUsed; /**< weighted average of the TLH bytes allocated per GC interval, 0 until the thread allocated in a complete interval */
+	double _averageRefreshWaste; /**< weighted average of the bytes left unused per refresh */
 public:
 protected:
 private:
+	/**
+	 * @return true if the refresh size is chosen by the adaptive sizing policy, which needs the allocation history of a complete GC interval
+	 */
+	MMINLINE bool isAdaptivelySized(MM_GCExtensionsBase *extensions) { return extensions->tlhAdaptiveSizing && (0.0 < _averageBytesUsed); }
+
+	/**
+	 * Choose the size of the next refresh from the allocation rate of the thread, the bytes it allocates per GC interval,
+	 * so that the TLH waste expected over an interval stays within tlhWasteTargetPercent with as few refreshes as possible.
+	 * @return the refresh size, within the TLH minimum and maximum sizes
+	 */
+	uintptr_t calculateAdaptiveRefreshSize(MM_EnvironmentBase *env);
+
+	/**
+	 * Fold the TLH usage of the GC interval that just ended into the averages of the thread, and start a new interval.
+	 */
+	void updateAllocationHistory(MM_EnvironmentBase *env);
+
 	/**
 	 * Replenish the allocation interface TLH cache with new storage.
 	 * This is a placeholder function for all non-TLH implementing configurations until a further revision of the code finally pushes TLH
@@ -251,7 +274,12 @@ private:
 		_abandonedList(NULL),
 		_abandonedListSize(0),
 		_zeroTLH(zeroTLH),
-		_reservedBytesForGC(0)
+		_reservedBytesForGC(0),
+		_intervalBytesUsed(0),
+		_intervalRefreshCount(0),
+		_intervalRefreshWaste(0),
+		_averageBytesUsed(0.0),
+		_averageRefreshWaste(0.0)
 	{};
 
 	/*
@@ -712,6 +712,10 @@ MM_Packet *
 MM_WorkPackets::getPacket(MM_EnvironmentBase *env, MM_PacketList *list)
 {
 	MM_Packet *packet;
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t fetchStartTime = omrtime_hires_clock();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	
 	packet = list->pop(env);
 	
@@ -719,6 +723,9 @@ MM_WorkPackets::getPacket(MM_EnvironmentBase *env, MM_PacketList *list)
 		return NULL;
 	}
 	
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	env->_workPacketStats.addToPacketFetchTime(fetchStartTime, omrtime_hires_clock());
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	packet->setOwner(env);
 
 	return packet;
@@ -125,6 +125,34 @@ done:
 	return result;
 }
 
+/**
+ * Try to acquire a spinlock without spinning or blocking.
+ * @param[in] s spinlock to be acquired
+ * @param[in] lockTracing lock statistics
+ * @return  0 on success or -1 if the spinlock is held by another thread
+ */
+intptr_t
+omrgc_spinlock_try_acquire(J9GCSpinlock *spinlock, J9ThreadMonitorTracing*  lockTracing)
+{
+	volatile intptr_t *target = (volatile intptr_t*) &spinlock->target;
+	intptr_t oldValue = -1;
+	intptr_t newValue = 0;
+
+	if ((oldValue != *target) || (oldValue != (intptr_t) MM_AtomicOperations::lockCompareExchange((volatile uintptr_t*) target, oldValue, newValue))) {
+		return -1;
+	}
+
+#if defined(OMR_THR_JLM)
+	J9ThreadMonitorTracing* tracing = lockTracing;
+	if (tracing != NULL) {
+		UPDATE_JLM_MON_ENTER(tracing);
+	}
+#endif /* OMR_THR_JLM */
+	/* On out-of-order memory models (e.g. Power4), ensure that all reads and writes have been completed at this point */
+	MM_AtomicOperations::readWriteBarrier();
+	return 0;
+}
+
 /**
  * Destroy a spinlock.
  * @param[in] s spinlock to be destroyed
@@ -200,6 +200,8 @@ MM_AllocationContextSegregated::tryAllocateRegionFromSmallSizeClass(MM_Environme
 	MM_HeapRegionDescriptorSegregated *region = _regionPool->allocateRegionFromSmallSizeClass(env, sizeClass);
 	bool result = false;
 	if (region != NULL) {
+		/* available regions must have been swept against the marks of the last collection */
+		Assert_MM_true(!region->isSweepPending(_regionPool->getSweepCycle()));
 		_smallRegions[sizeClass] = region;
 		/* cache the small full region in AC */
 		_perContextSmallFullRegions[sizeClass]->enqueue(region);
@@ -215,6 +217,7 @@ MM_AllocationContextSegregated::trySweepAndAllocateRegionFromSmallSizeClass(MM_E
 
 	MM_HeapRegionDescriptorSegregated *region = _regionPool->sweepAndAllocateRegionFromSmallSizeClass(env, sizeClass);
 	if (region != NULL) {
+		Assert_MM_true(!region->isSweepPending(_regionPool->getSweepCycle()));
 		MM_AtomicOperations::storeSync();
 		_smallRegions[sizeClass] = region;
 		/* Don't update bytesAllocated because unswept regions are still considered to be in use */
@@ -28,6 +28,8 @@
 #include "omrcfg.h"
 #include "MemorySpacesAPI.h"
 
+#include <string.h>
+
 #include "ConfigurationSegregated.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -45,6 +47,7 @@
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedAllocationTracker.hpp"
 #include "SegregatedGC.hpp"
+#include "SizeClassProfile.hpp"
 #include "SizeClasses.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
@@ -80,11 +83,13 @@ MM_ConfigurationSegregated::initialize(MM_EnvironmentBase *env)
 
 	bool success = false;
 
-	/* OMRTODO investigate why these must be equal or it segfaults. */
 	MM_GCExtensionsBase *extensions = env->getExtensions();
-	extensions->splitAvailableListSplitAmount = extensions->gcThreadCount;
 
 	if (MM_Configuration::initialize(env)) {
+		/* OMRTODO investigate why these must be equal or it segfaults.
+		 * The GC thread count is only known once the base configuration is initialized.
+		 */
+		extensions->splitAvailableListSplitAmount = extensions->gcThreadCount;
 		env->getOmrVM()->_sizeClasses = _delegate.getSegregatedSizeClasses(env);
 		if (NULL != env->getOmrVM()->_sizeClasses) {
 			extensions->setSegregatedHeap(true);
@@ -93,6 +98,28 @@ MM_ConfigurationSegregated::initialize(MM_EnvironmentBase *env)
 			success = true;
 		}
 	}
+
+	if (success && (NULL != extensions->sizeClassProfileDumpFile)) {
+		/* the option does not outlive startup, keep the file name until the profile is written at shutdown */
+		uintptr_t fileNameBytes = strlen(extensions->sizeClassProfileDumpFile) + 1;
+		_sizeClassProfileDumpFile = (char *)env->getForge()->allocate(fileNameBytes, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL != _sizeClassProfileDumpFile) {
+			memcpy(_sizeClassProfileDumpFile, extensions->sizeClassProfileDumpFile, fileNameBytes);
+			extensions->sizeClassProfileDumpFile = _sizeClassProfileDumpFile;
+			extensions->sizeClassProfileHistogram = MM_SizeClassProfile::newHistogram(env);
+		}
+		success = (NULL != extensions->sizeClassProfileHistogram);
+	}
+
+	/* the heap resizes like a standard one */
+	if (!extensions->heapExpansionGCRatioThreshold._wasSpecified) {
+		extensions->heapExpansionGCRatioThreshold._valueSpecified = 13;
+	}
+
+	if (!extensions->heapContractionGCRatioThreshold._wasSpecified) {
+		extensions->heapContractionGCRatioThreshold._valueSpecified = 5;
+	}
+
 	return success;
 }
 
@@ -101,6 +128,18 @@ MM_ConfigurationSegregated::tearDown(MM_EnvironmentBase* env)
 {
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 
+	if (NULL != extensions->sizeClassProfileHistogram) {
+		MM_SizeClassProfile::dump(env, extensions->sizeClassProfileDumpFile, extensions->sizeClassProfileHistogram);
+		env->getForge()->free(extensions->sizeClassProfileHistogram);
+		extensions->sizeClassProfileHistogram = NULL;
+	}
+
+	if (NULL != _sizeClassProfileDumpFile) {
+		env->getForge()->free(_sizeClassProfileDumpFile);
+		_sizeClassProfileDumpFile = NULL;
+		extensions->sizeClassProfileDumpFile = NULL;
+	}
+
 	if (NULL != extensions->defaultSizeClasses) {
 		extensions->defaultSizeClasses->kill(env);
 		extensions->defaultSizeClasses = NULL;
@@ -125,7 +164,10 @@ MM_ConfigurationSegregated::createDefaultMemorySpace(MM_EnvironmentBase *env, MM
 	MM_PhysicalArenaRegionBased *physicalArena = NULL;
 	MM_RegionPoolSegregated *regionPool = NULL;
 
-	if(NULL == (extensions->defaultSizeClasses = MM_SizeClasses::newInstance(env))) {
+	extensions->defaultSizeClasses = MM_SizeClasses::newInstance(env);
+	/* the allocation size profile is only read by the size classes, and the option does not outlive startup */
+	extensions->sizeClassProfileFile = NULL;
+	if(NULL == extensions->defaultSizeClasses) {
 		return NULL;
 	}
 
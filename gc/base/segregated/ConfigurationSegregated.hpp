@@ -50,6 +50,7 @@ protected:
 private:
 	static const uintptr_t SEGREGATED_REGION_SIZE_BYTES = (64 * 1024);
 	static const uintptr_t SEGREGATED_ARRAYLET_LEAF_SIZE_BYTES = OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES;
+	char *_sizeClassProfileDumpFile; /**< Copy of the sizeClassProfileDumpFile option, owned by the configuration */
 
 	/*
 	 * Function members
@@ -68,6 +69,7 @@ public:
 	
 	MM_ConfigurationSegregated(MM_EnvironmentBase *env)
 		: MM_Configuration(env, gc_policy_metronome, mm_regionAlignment, SEGREGATED_REGION_SIZE_BYTES, SEGREGATED_ARRAYLET_LEAF_SIZE_BYTES, gc_modron_wrtbar_none, gc_modron_allocation_type_segregated)
+		, _sizeClassProfileDumpFile(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
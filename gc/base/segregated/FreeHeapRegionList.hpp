@@ -64,6 +64,12 @@ public:
 	virtual void push(MM_HeapRegionDescriptorSegregated *region) = 0;
 	virtual void push(MM_HeapRegionQueue *src) = 0;
 	virtual void push(MM_FreeHeapRegionList *src) = 0;
+
+	/**
+	 * Move up to maxRegions regions from the front of src to this list, taking each list lock once.
+	 * @return the number of regions moved
+	 */
+	virtual uintptr_t push(MM_FreeHeapRegionList *src, uintptr_t maxRegions) = 0;
 	
 	virtual MM_HeapRegionDescriptorSegregated* pop() = 0;
 
@@ -51,6 +51,7 @@ private:
 	MM_HeapRegionManager *_regionManager;
 	OMR_SizeClasses *_segregatedSizeClasses;
 	uintptr_t _nextArrayletIndex; /**< next arraylet to use for allocation */
+	uintptr_t _sweepCycle; /**< sweep cycle of the region pool in which the region was last swept or handed out empty */
 	
 	/*
 	 * Function members
@@ -65,6 +66,7 @@ public:
 		,_regionManager(NULL)
 		,_segregatedSizeClasses(env->getOmrVM()->_sizeClasses)
 		,_nextArrayletIndex(0)
+		,_sweepCycle(0)
 	{
 		_arrayletBackPointers = ((uintptr_t **)(this + 1));
 		_typeId = __FUNCTION__;
@@ -129,6 +131,14 @@ public:
 	MMINLINE bool isArrayletUnused(uintptr_t index) { return _arrayletBackPointers[index] == NULL; }
 	MMINLINE bool isArrayletUsed(uintptr_t index)   { return _arrayletBackPointers[index] != NULL; }
 	MMINLINE void setNextArrayletIndex (uintptr_t index)   { _nextArrayletIndex = index; }
+
+	/**
+	 * Record that the region has been swept (or allocated empty) in the given sweep cycle of the region pool.
+	 * Regions are only allowed to be allocated into once they are swept in the current cycle.
+	 */
+	MMINLINE void setSweepCycle(uintptr_t sweepCycle) { _sweepCycle = sweepCycle; }
+	MMINLINE bool isSweepPending(uintptr_t currentSweepCycle) { return _sweepCycle != currentSweepCycle; }
+
 	void addBytesFreedToArrayletBackout(MM_EnvironmentBase* env);
 	void addBytesFreedToSmallSpineBackout(MM_EnvironmentBase* env);
 
@@ -142,6 +142,31 @@ public:
 		unlock();
 	}
 
+	virtual uintptr_t
+	push(MM_FreeHeapRegionList *srcAsFPL, uintptr_t maxRegions)
+	{
+		MM_LockingFreeHeapRegionList* src = MM_LockingFreeHeapRegionList::asLockingFreeHeapRegionList(srcAsFPL);
+		uintptr_t moved = 0;
+		if (src->_head == NULL) { /* Nothing to move - single read needs no lock */
+			return moved;
+		}
+		lock();
+		src->lock();
+
+		while (moved < maxRegions) {
+			MM_HeapRegionDescriptorSegregated *region = src->popInternal();
+			if (NULL == region) {
+				break;
+			}
+			pushInternal(region);
+			moved += 1;
+		}
+
+		src->unlock();
+		unlock();
+		return moved;
+	}
+
 	virtual MM_HeapRegionDescriptorSegregated *
 	pop()
 	{
@@ -98,7 +98,7 @@ MM_MemoryPoolSegregated::tearDown(MM_EnvironmentBase *env)
 MM_SegregatedAllocationTracker *
 MM_MemoryPoolSegregated::createAllocationTracker(MM_EnvironmentBase* env)
 {
-	return MM_SegregatedAllocationTracker::newInstance(env, &_bytesInUse, _extensions->allocationTrackerFlushThreshold);
+	return MM_SegregatedAllocationTracker::newInstance(env, &_bytesInUse, &_freeRegionRefillStats, _extensions->allocationTrackerFlushThreshold);
 }
 
 
@@ -355,6 +355,24 @@ MM_MemoryPoolSegregated::debugGetActualFreeMemorySize()
 	return totalBytesInUse;
 }
 
+void
+MM_MemoryPoolSegregated::getFreeRegionRefillStats(MM_FreeRegionRefillStats *stats)
+{
+	GC_OMRVMThreadListIterator vmThreadListIterator(_extensions->getOmrVM());
+	OMR_VMThread *walkThread;
+	*stats = _freeRegionRefillStats;
+
+	while (NULL != (walkThread = vmThreadListIterator.nextOMRVMThread())) {
+		MM_EnvironmentBase *walkEnv = MM_EnvironmentBase::getEnvironment(walkThread);
+		if (NULL != walkEnv->_allocationTracker) {
+			const MM_FreeRegionRefillStats *threadStats = walkEnv->_allocationTracker->getFreeRegionRefillStats();
+			stats->_refillCount += threadStats->_refillCount;
+			stats->_regionsRefilled += threadStats->_regionsRefilled;
+			stats->_splitFreeListAllocationCount += threadStats->_splitFreeListAllocationCount;
+		}
+	}
+}
+
 void
 MM_MemoryPoolSegregated::setFreeMemorySize(uintptr_t freeMemorySize)
 {
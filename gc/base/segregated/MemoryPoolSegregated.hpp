@@ -48,6 +48,7 @@ public:
 	MM_GlobalAllocationManagerSegregated *_globalAllocationManager;
 	MM_GCExtensionsBase* _extensions;
 	volatile uintptr_t _bytesInUse;
+	MM_FreeRegionRefillStats _freeRegionRefillStats; /**< Free region refill counters flushed by the allocation trackers of terminated threads */
 	
 	/*
 	 * Function members
@@ -80,6 +81,12 @@ public:
 	virtual uintptr_t getActualFreeMemorySize();
 	virtual uintptr_t getActualFreeEntryCount();
 	uintptr_t debugGetActualFreeMemorySize();
+
+	/**
+	 * Sum the free region refill counters of all threads, including the ones that have terminated.
+	 * @param[out] stats the counters
+	 */
+	void getFreeRegionRefillStats(MM_FreeRegionRefillStats *stats);
 	uintptr_t debugCountFreeBytes();
 	virtual void setFreeMemorySize(uintptr_t freeMemorySize);
 	virtual void setFreeEntryCount(uintptr_t entryCount);
@@ -124,6 +131,9 @@ protected:
 		, _bytesInUse(0)
 	{
 		_typeId = __FUNCTION__;
+		_freeRegionRefillStats._refillCount = 0;
+		_freeRegionRefillStats._regionsRefilled = 0;
+		_freeRegionRefillStats._splitFreeListAllocationCount = 0;
 	}
 	
 private:
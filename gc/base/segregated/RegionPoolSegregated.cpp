@@ -38,6 +38,7 @@
 #include "OMR_VMThread.hpp"
 #include "OMRVMThreadListIterator.hpp"
 #include "SegregatedAllocationInterface.hpp"
+#include "SegregatedAllocationTracker.hpp"
 
 #include "RegionPoolSegregated.hpp"
 
@@ -88,6 +89,22 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 	}
 	_splitAvailableListSplitCount = env->getExtensions()->splitAvailableListSplitAmount;
 	Assert_MM_true(0 < _splitAvailableListSplitCount);
+
+	_freeRegionRefillBatchSize = env->getExtensions()->freeRegionRefillBatchSize;
+	if (1 < _freeRegionRefillBatchSize) {
+		_splitSingleFreeLists = (MM_LockingFreeHeapRegionList *)env->getForge()->allocate(sizeof(MM_LockingFreeHeapRegionList) * _splitAvailableListSplitCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _splitSingleFreeLists) {
+			return false;
+		}
+		for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
+			new (&_splitSingleFreeLists[j]) MM_LockingFreeHeapRegionList(MM_HeapRegionList::HRL_KIND_FREE, true);
+		}
+		for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
+			if (!_splitSingleFreeLists[j].initialize(env)) {
+				return false;
+			}
+		}
+	}
 	for (szClass=OMR_SIZECLASSES_MIN_SMALL; szClass<=OMR_SIZECLASSES_MAX_SMALL; szClass++) {
 		for (int32_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
 			uintptr_t splitAvailableListsSize = sizeof(MM_LockingHeapRegionQueue) * _splitAvailableListSplitCount;
@@ -161,6 +178,14 @@ MM_RegionPoolSegregated::tearDown(MM_EnvironmentBase *env)
 		_coalesceFreeList->kill(env);
 		_coalesceFreeList = NULL;
 	}
+
+	if (NULL != _splitSingleFreeLists) {
+		for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
+			_splitSingleFreeLists[j].tearDown(env);
+		}
+		env->getForge()->free(_splitSingleFreeLists);
+		_splitSingleFreeLists = NULL;
+	}
 	
 	if (_largeFullRegions) {
 		_largeFullRegions->kill(env);
@@ -216,6 +241,12 @@ MM_RegionPoolSegregated::addSingleFree(MM_EnvironmentBase *env, MM_HeapRegionQue
 void
 MM_RegionPoolSegregated::moveInUseToSweep(MM_EnvironmentBase *env)
 {
+	/* regions left unswept since the last collection stay in the sweep lists and are swept against the new marks */
+	_carriedSweepDebtRegions = _currentTotalCountOfSweepRegions;
+	_lastLazySweptRegions = _lazySweptRegions;
+	_lazySweptRegions = 0;
+	_sweepCycle += 1;
+
 	_currentTotalCountOfSweepRegions = 0;
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 		_darkMatterCellCount[sizeClass] = 0;
@@ -240,6 +271,11 @@ void
 MM_RegionPoolSegregated::countFreeRegions(uintptr_t *singleFree, uintptr_t *multiFree, uintptr_t *coalesceFree)
 {
 	*singleFree = _singleFreeList->getTotalRegions();
+	if (NULL != _splitSingleFreeLists) {
+		for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
+			*singleFree += _splitSingleFreeLists[j].getTotalRegions();
+		}
+	}
 	*multiFree = _multiFreeList->getTotalRegions();
 	*coalesceFree = _coalesceFreeList->getTotalRegions();
 }
@@ -290,13 +326,61 @@ MM_RegionPoolSegregated::addFreeRegion(MM_EnvironmentBase *env, MM_HeapRegionDes
 	}
 }
 
+void
+MM_RegionPoolSegregated::pushSplitFreeLists(MM_FreeHeapRegionList *target)
+{
+	if (NULL != _splitSingleFreeLists) {
+		for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
+			target->push(&_splitSingleFreeLists[j]);
+		}
+	}
+}
+
+MM_HeapRegionDescriptorSegregated *
+MM_RegionPoolSegregated::allocateFromSplitFreeLists(MM_EnvironmentBase *env, uintptr_t szClass)
+{
+	uintptr_t splitIndex = env->getEnvironmentId() % _splitAvailableListSplitCount;
+	MM_FreeHeapRegionList *splitFreeList = &_splitSingleFreeLists[splitIndex];
+	MM_HeapRegionDescriptorSegregated *region = splitFreeList->allocate(env, szClass);
+
+	if (NULL == region) {
+		/* refill the split list with a batch of regions, taking the shared list lock once for all of them */
+		uintptr_t refilled = splitFreeList->push(_singleFreeList, _freeRegionRefillBatchSize);
+		if (0 < refilled) {
+			env->_allocationTracker->addFreeRegionRefill(env, refilled);
+			region = splitFreeList->allocate(env, szClass);
+		}
+	}
+
+	/* the shared list is empty, take the regions other environments have refilled but not used yet */
+	for (uintptr_t j=1; (NULL == region) && (j<_splitAvailableListSplitCount); j++) {
+		MM_FreeHeapRegionList *otherSplitFreeList = &_splitSingleFreeLists[(splitIndex + j) % _splitAvailableListSplitCount];
+		region = otherSplitFreeList->allocate(env, szClass);
+	}
+
+	if (NULL != region) {
+		env->_allocationTracker->addSplitFreeListAllocation(env);
+	}
+
+	return region;
+}
+
+MM_HeapRegionDescriptorSegregated *
+MM_RegionPoolSegregated::allocateSingleFreeRegion(MM_EnvironmentBase *env, uintptr_t szClass)
+{
+	if (NULL != _splitSingleFreeLists) {
+		return allocateFromSplitFreeLists(env, szClass);
+	}
+	return _singleFreeList->allocate(env, szClass);
+}
+
 MM_HeapRegionDescriptorSegregated *
 MM_RegionPoolSegregated::allocateFromRegionPool(MM_EnvironmentBase *env, uintptr_t numRegions, uintptr_t szClass, uintptr_t maxExcess)
 {
 	MM_HeapRegionDescriptorSegregated *region = NULL;
 
 	if (numRegions == 1) {
-		region = _singleFreeList->allocate(env, szClass);
+		region = allocateSingleFreeRegion(env, szClass);
 	}
 	
 	if (region == NULL) {
@@ -306,10 +390,17 @@ MM_RegionPoolSegregated::allocateFromRegionPool(MM_EnvironmentBase *env, uintptr
 			region = _coalesceFreeList->allocate(env, szClass, numRegions, maxExcess);
 		}
 	}
-	
+
+	if ((NULL == region) && (1 == numRegions) && env->getExtensions()->segregatedLazySweep) {
+		/* pay off the sweep debt left by the last collection until a region is freed, rather than failing the allocation */
+		while ((NULL == region) && sweepForFreeRegion(env)) {
+			region = allocateSingleFreeRegion(env, szClass);
+		}
+	}
 	
 	if (region != NULL) {
 		incrementRegionsInUse(region->getRange()); /* we must add here because we will return remainder later */
+		region->setSweepCycle(_sweepCycle);
 		
 		/* We must notify the allocation tracker that a fresh region has been allocated, it will know how to
 		 * account for bytes lost to internal fragmentation and will account for all the memory allocated
@@ -412,11 +503,48 @@ MM_RegionPoolSegregated::sweepAndAllocateRegionFromSmallSizeClass(MM_Environment
 		_smallOccupancy[sizeClass] = (_smallOccupancy[sizeClass] * 0.9f) + (region->getMemoryPoolACL()->getMarkCount() / region->getNumCells() * 0.1f );
 		decrementCurrentCountOfSweepRegions(sizeClass, 1);
 		decrementCurrentTotalCountOfSweepRegions(1);
+		MM_AtomicOperations::add(&_lazySweptRegions, 1);
 		_smallFullRegions[sizeClass]->enqueue(region);
 	}
 	return region;
 }
 
+bool
+MM_RegionPoolSegregated::sweepForFreeRegion(MM_EnvironmentBase *env)
+{
+	uintptr_t splitIndex = env->getEnvironmentId() % _splitAvailableListSplitCount;
+
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		while (NULL != (region = _smallSweepRegions[sizeClass]->dequeue())) {
+			_sweepScheme->sweepRegion(env, region);
+			decrementCurrentCountOfSweepRegions(sizeClass, 1);
+			decrementCurrentTotalCountOfSweepRegions(1);
+			MM_AtomicOperations::add(&_lazySweptRegions, 1);
+
+			MM_MemoryPoolAggregatedCellList *memoryPoolACL = region->getMemoryPoolACL();
+			uintptr_t numCells = region->getNumCells();
+			if (memoryPoolACL->getFreeCount() == numCells) {
+				region->emptyRegionReturned(env);
+				addFreeRegion(env, region);
+				return true;
+			}
+
+			/* keep maintaining the occupancy of the size class, as the collection's sweep would */
+			updateOccupancy(sizeClass, (memoryPoolACL->getMarkCount() * 100) / numCells);
+			if (memoryPoolACL->getMarkCount() == numCells) {
+				_smallFullRegions[sizeClass]->enqueue(region);
+			} else {
+				/* only the primary bucket is searched for available regions outside of a collection */
+				(&(_smallAvailableRegions[sizeClass][PRIMARY_BUCKET])[splitIndex])->enqueue(region);
+				_skipAvailableRegionForAllocation[sizeClass] = 0;
+			}
+		}
+	}
+
+	return false;
+}
+
 void
 MM_RegionPoolSegregated::updateOccupancy (uintptr_t sizeClass, uintptr_t occupancy)
 {
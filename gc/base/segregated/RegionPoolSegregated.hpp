@@ -38,6 +38,7 @@ class MM_EnvironmentBase;
 class MM_FreeHeapRegionList;
 class MM_HeapRegionDescriptorSegregated;
 class MM_HeapRegionQueue;
+class MM_LockingFreeHeapRegionList;
 class MM_LockingHeapRegionQueue;
 
 #define PRIMARY_BUCKET 0
@@ -72,6 +73,14 @@ private:
 	MM_FreeHeapRegionList *_singleFreeList; /**< Singleton free regions. */
 	MM_FreeHeapRegionList *_multiFreeList; /**< Contiguous free regions (may include regions that are actually singletons). */
 	MM_FreeHeapRegionList *_coalesceFreeList; /**< Free regions that might be coalescable, so avoid allocating from them if at all possible. */
+
+	/**
+	 * @note Singleton free regions are moved in batches from _singleFreeList to the split free lists, so that
+	 * allocation contexts refilling a small size class mostly contend on the split list of their own index
+	 * rather than all on _singleFreeList.
+	 */
+	MM_LockingFreeHeapRegionList *_splitSingleFreeLists; /**< Singleton free regions, split by environment index. NULL if batched refill is disabled. */
+	uintptr_t _freeRegionRefillBatchSize; /**< Number of regions moved from _singleFreeList to a split free list at once */
 	
 	/** 
 	 * @note No allocation is currently happening on the available regions.  These are roughly sorted
@@ -134,6 +143,12 @@ private:
 	volatile uintptr_t _currentCountOfSweepRegions[OMR_SIZECLASSES_MAX_SMALL + 1];
 	uintptr_t _initialTotalCountOfSweepRegions;
 	volatile uintptr_t _currentTotalCountOfSweepRegions;
+
+	uintptr_t _sweepCycle; /**< Incremented every time the in use regions are moved to the sweep lists */
+	uintptr_t _sweepDebtRegions; /**< Small regions the last collection left unswept for allocating threads (lazy sweep) */
+	volatile uintptr_t _lazySweptRegions; /**< Small regions swept by allocating threads since the last collection */
+	uintptr_t _lastLazySweptRegions; /**< Small regions swept by allocating threads between the two last collections */
+	uintptr_t _carriedSweepDebtRegions; /**< Small regions still unswept when the last collection started */
 	
 	bool _isSweepingSmall; /**< if GC is sweeping small pages */
 	uintptr_t _splitAvailableListSplitCount; /* number of split available region queues per size class per defragment bucket */
@@ -157,6 +172,17 @@ private:
 	{
 		MM_AtomicOperations::subtract(&_regionsInUse, value);
 	}
+
+	/**
+	 * Allocate a singleton region from the split free list of the environment, refilling it with a batch of
+	 * regions from _singleFreeList if it is empty, and taking from the other split free lists as a last resort.
+	 */
+	MM_HeapRegionDescriptorSegregated *allocateFromSplitFreeLists(MM_EnvironmentBase *env, uintptr_t szClass);
+
+	/**
+	 * Allocate a singleton region from the split free lists if they are enabled, from _singleFreeList otherwise.
+	 */
+	MM_HeapRegionDescriptorSegregated *allocateSingleFreeRegion(MM_EnvironmentBase *env, uintptr_t szClass);
 	
 protected:
 public:
@@ -174,6 +200,13 @@ public:
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromArrayletSizeClass(MM_EnvironmentBase *env);
 	MM_HeapRegionDescriptorSegregated *sweepAndAllocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
+
+	/**
+	 * Sweep small regions left unswept by the collection until one of them is found to be empty and is
+	 * returned to the free lists, making the swept partially used regions available for allocation.
+	 * @return true if a region has been freed
+	 */
+	bool sweepForFreeRegion(MM_EnvironmentBase *env);
 	void enqueueAvailable(MM_HeapRegionDescriptorSegregated *region, uintptr_t sizeClass, uintptr_t occupancy, uintptr_t splitListIndex);
 
 	/**
@@ -185,6 +218,11 @@ public:
 	void addFreeRange(void *lowAddress, void *highAddress);
 	void addFreeRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region, bool alreadyFree = false);
 	void addSingleFree(MM_EnvironmentBase *env, MM_HeapRegionQueue *regionQueue);
+
+	/**
+	 * Move the regions of all split free lists to the given list, so that they can be coalesced.
+	 */
+	void pushSplitFreeLists(MM_FreeHeapRegionList *target);
 	
 	MMINLINE uintptr_t roundUpRegion(uintptr_t size) {	return (size + _heapRegionManager->getRegionSize() - 1) & (~(_heapRegionManager->getRegionSize() - 1)); }
 	MMINLINE uintptr_t roundDownRegion(uintptr_t size) { return (size) & (~(_heapRegionManager->getRegionSize() - 1)); }
@@ -225,6 +263,17 @@ public:
 		MM_AtomicOperations::subtract(&_currentTotalCountOfSweepRegions, count);
 	}
 	
+	MMINLINE uintptr_t getSweepCycle() const { return _sweepCycle; }
+
+	/**
+	 * Record the number of small regions the collection leaves to be swept by allocating threads.
+	 */
+	MMINLINE void setSweepDebtRegions(uintptr_t regions) { _sweepDebtRegions = regions; }
+	MMINLINE uintptr_t getSweepDebtRegions() const { return _sweepDebtRegions; }
+	MMINLINE uintptr_t getLazySweptRegions() const { return _lazySweptRegions; }
+	MMINLINE uintptr_t getLastLazySweptRegions() const { return _lastLazySweptRegions; }
+	MMINLINE uintptr_t getCarriedSweepDebtRegions() const { return _carriedSweepDebtRegions; }
+
 	MMINLINE void addDarkMatterCellsAfterSweepForSizeClass(uintptr_t sizeClass, uintptr_t cellCount) {
 		MM_AtomicOperations::add(&_darkMatterCellCount[sizeClass], cellCount);
 	}	
@@ -270,12 +319,19 @@ public:
 		, _singleFreeList(NULL)
 		, _multiFreeList(NULL)
 		, _coalesceFreeList(NULL)
+		, _splitSingleFreeLists(NULL)
+		, _freeRegionRefillBatchSize(0)
 		, _arrayletAvailableRegions(NULL)
 		, _arrayletFullRegions(NULL)
 		, _arrayletSweepRegions(NULL)
 		, _largeFullRegions(NULL)
 		, _largeSweepRegions(NULL)
 		, _regionsInUse(0)
+		, _sweepCycle(0)
+		, _sweepDebtRegions(0)
+		, _lazySweptRegions(0)
+		, _lastLazySweptRegions(0)
+		, _carriedSweepDebtRegions(0)
 		, _isSweepingSmall(false)
 	{
 		_typeId = __FUNCTION__;
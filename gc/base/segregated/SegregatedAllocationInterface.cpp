@@ -34,6 +34,7 @@
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "SizeClasses.hpp"
+#include "SizeClassProfile.hpp"
 #include "ObjectHeapIteratorSegregated.hpp"
 
 #include "SegregatedAllocationInterface.hpp"
@@ -99,6 +100,11 @@ MM_SegregatedAllocationInterface::initialize(MM_EnvironmentBase *env)
 			_replenishSizes[sizeClass] = extensions->allocationCacheInitialSize;
 		}
 	}
+
+	if (result && (NULL != extensions->sizeClassProfileHistogram)) {
+		_smallAllocationSizeHistogram = MM_SizeClassProfile::newHistogram(env);
+		result = (NULL != _smallAllocationSizeHistogram);
+	}
 	
 	return result;
 }
@@ -113,6 +119,15 @@ MM_SegregatedAllocationInterface::tearDown(MM_EnvironmentBase *env)
 		_frequentObjectsStats->kill(env);
 		_frequentObjectsStats = NULL;
 	}
+
+	if (NULL != _smallAllocationSizeHistogram) {
+		uintptr_t *histogram = env->getExtensions()->sizeClassProfileHistogram;
+		if (NULL != histogram) {
+			MM_SizeClassProfile::merge(histogram, _smallAllocationSizeHistogram);
+		}
+		env->getForge()->free(_smallAllocationSizeHistogram);
+		_smallAllocationSizeHistogram = NULL;
+	}
 }
 
 /**
@@ -186,6 +201,9 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 	if ((NULL != cell) && !allocateDescription->isCompletedFromTlh()) {
 		_stats._allocationBytes += allocateDescription->getContiguousBytes();
 		++_stats._allocationCount;
+		if ((NULL != _smallAllocationSizeHistogram) && (sizeInBytes <= OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES)) {
+			MM_SizeClassProfile::record(_smallAllocationSizeHistogram, sizeInBytes);
+		}
 	}
 
 	return cell;
@@ -264,6 +282,9 @@ MM_SegregatedAllocationInterface::flushCache(MM_EnvironmentBase *env)
 	memset(_allocationCache, 0, sizeof(LanguageSegregatedAllocationCache));
 	env->getExtensions()->allocationStats.merge(&_stats);
 	_stats.clear();
+	if (NULL != _smallAllocationSizeHistogram) {
+		MM_SizeClassProfile::merge(env->getExtensions()->sizeClassProfileHistogram, _smallAllocationSizeHistogram);
+	}
 }
 
 /**
@@ -56,6 +56,7 @@ private:
 	MM_SizeClasses* _sizeClasses; /**< The size classes used to map byte sizes to size class indexes. */
 	
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
+	uintptr_t *_smallAllocationSizeHistogram; /**< Number of small allocations per size since the last flush, NULL unless an allocation size profile is captured */
 	
 	uintptr_t *_allocationCacheBases[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The Base of each current cache (per size class). */
 
@@ -102,7 +103,8 @@ protected:
 	MM_SegregatedAllocationInterface(MM_EnvironmentBase *env) :
 		MM_ObjectAllocationInterface(env),
 		_sizeClasses(NULL),
-		_cachedAllocationsEnabled(true)
+		_cachedAllocationsEnabled(true),
+		_smallAllocationSizeHistogram(NULL)
 	{
 		_typeId = __FUNCTION__;
 		memset(_allocationCacheBases, 0, sizeof(_allocationCacheBases));
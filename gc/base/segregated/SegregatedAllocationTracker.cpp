@@ -32,13 +32,13 @@
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
 MM_SegregatedAllocationTracker*
-MM_SegregatedAllocationTracker::newInstance(MM_EnvironmentBase *env, volatile uintptr_t *globalBytesInUse, uintptr_t flushThreshold)
+MM_SegregatedAllocationTracker::newInstance(MM_EnvironmentBase *env, volatile uintptr_t *globalBytesInUse, MM_FreeRegionRefillStats *globalFreeRegionRefillStats, uintptr_t flushThreshold)
 {
 	MM_SegregatedAllocationTracker* allocationTracker;
 	allocationTracker = (MM_SegregatedAllocationTracker*)env->getForge()->allocate(sizeof(MM_SegregatedAllocationTracker), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if(NULL != allocationTracker) {
 		new(allocationTracker) MM_SegregatedAllocationTracker(env);
-		if(!allocationTracker->initialize(env, globalBytesInUse, flushThreshold)) {
+		if(!allocationTracker->initialize(env, globalBytesInUse, globalFreeRegionRefillStats, flushThreshold)) {
 			allocationTracker->kill(env);
 			return NULL;
 		}
@@ -54,11 +54,12 @@ MM_SegregatedAllocationTracker::kill(MM_EnvironmentBase *env)
 }
 
 bool
-MM_SegregatedAllocationTracker::initialize(MM_EnvironmentBase *env, uintptr_t volatile *globalBytesInUse, uintptr_t flushThreshold)
+MM_SegregatedAllocationTracker::initialize(MM_EnvironmentBase *env, uintptr_t volatile *globalBytesInUse, MM_FreeRegionRefillStats *globalFreeRegionRefillStats, uintptr_t flushThreshold)
 {
 	_bytesAllocated = 0;
 	_flushThreshold = flushThreshold;
 	_globalBytesInUse = globalBytesInUse;
+	_globalFreeRegionRefillStats = globalFreeRegionRefillStats;
 	updateAllocationTrackerThreshold(env);
 	return true;
 }
@@ -70,6 +71,7 @@ MM_SegregatedAllocationTracker::tearDown(MM_EnvironmentBase *env)
 	 * due to the allocation tracker flush threshold. It also updates the flush threshold if necessary.
 	 */
 	flushBytes();
+	flushFreeRegionRefillStats();
 	updateAllocationTrackerThreshold(env);
 }
 
@@ -134,4 +136,20 @@ MM_SegregatedAllocationTracker::flushBytes()
 	_bytesAllocated = 0;
 }
 
+/**
+ * Atomically adds this thread's free region refill counters to the global memory pool's counters, so they survive the thread.
+ */
+void
+MM_SegregatedAllocationTracker::flushFreeRegionRefillStats()
+{
+	if (NULL != _globalFreeRegionRefillStats) {
+		MM_AtomicOperations::add(&_globalFreeRegionRefillStats->_refillCount, _freeRegionRefillStats._refillCount);
+		MM_AtomicOperations::add(&_globalFreeRegionRefillStats->_regionsRefilled, _freeRegionRefillStats._regionsRefilled);
+		MM_AtomicOperations::add(&_globalFreeRegionRefillStats->_splitFreeListAllocationCount, _freeRegionRefillStats._splitFreeListAllocationCount);
+	}
+	_freeRegionRefillStats._refillCount = 0;
+	_freeRegionRefillStats._regionsRefilled = 0;
+	_freeRegionRefillStats._splitFreeListAllocationCount = 0;
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
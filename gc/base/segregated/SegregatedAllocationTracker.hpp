@@ -29,6 +29,15 @@
 
 class MM_EnvironmentBase;
 
+/**
+ * Counters of the batched refill of singleton free regions, see MM_RegionPoolSegregated.
+ */
+struct MM_FreeRegionRefillStats {
+	uintptr_t _refillCount; /**< Number of batches of free regions moved to a split free list */
+	uintptr_t _regionsRefilled; /**< Number of free regions moved to a split free list */
+	uintptr_t _splitFreeListAllocationCount; /**< Number of free regions allocated from the split free lists */
+};
+
 class MM_SegregatedAllocationTracker : public MM_BaseVirtual
 {
 public:
@@ -37,9 +46,11 @@ private:
 	intptr_t _bytesAllocated; /**< A negative amount indicates this tracker has freed more bytes than allocated. */
 	uintptr_t _flushThreshold; /**< If |bytesAllocated| > this threshold, we'll flush the bytes allocated to the pool. */
 	volatile uintptr_t *_globalBytesInUse; /**< The memory pool accumulator to flush bytes to */
+	MM_FreeRegionRefillStats _freeRegionRefillStats; /**< Free region refill counters of this thread */
+	MM_FreeRegionRefillStats *_globalFreeRegionRefillStats; /**< The memory pool accumulator the free region refill counters are flushed to when the thread terminates */
 
 public:
-	static MM_SegregatedAllocationTracker* newInstance(MM_EnvironmentBase *env, volatile uintptr_t *globalBytesInUse, uintptr_t flushThreshold);
+	static MM_SegregatedAllocationTracker* newInstance(MM_EnvironmentBase *env, volatile uintptr_t *globalBytesInUse, MM_FreeRegionRefillStats *globalFreeRegionRefillStats, uintptr_t flushThreshold);
 	virtual void kill(MM_EnvironmentBase *env);
 
 	static void updateAllocationTrackerThreshold(MM_EnvironmentBase* env);
@@ -48,9 +59,18 @@ public:
 	void addBytesAllocated(MM_EnvironmentBase* env, uintptr_t bytesAllocated);
 	void addBytesFreed(MM_EnvironmentBase* env, uintptr_t bytesFreed);
 	intptr_t getUnflushedBytesAllocated(MM_EnvironmentBase* env) { return _bytesAllocated; }
+
+	void
+	addFreeRegionRefill(MM_EnvironmentBase* env, uintptr_t regionCount)
+	{
+		_freeRegionRefillStats._refillCount += 1;
+		_freeRegionRefillStats._regionsRefilled += regionCount;
+	}
+	void addSplitFreeListAllocation(MM_EnvironmentBase* env) { _freeRegionRefillStats._splitFreeListAllocationCount += 1; }
+	const MM_FreeRegionRefillStats *getFreeRegionRefillStats() { return &_freeRegionRefillStats; }
 	
 protected:
-	virtual bool initialize(MM_EnvironmentBase *env, uintptr_t volatile *globalBytesInUse, uintptr_t flushThreshold);
+	virtual bool initialize(MM_EnvironmentBase *env, uintptr_t volatile *globalBytesInUse, MM_FreeRegionRefillStats *globalFreeRegionRefillStats, uintptr_t flushThreshold);
 	virtual void tearDown(MM_EnvironmentBase *env);
 	
 private:
@@ -58,11 +78,16 @@ private:
 		_bytesAllocated(0)
 		,_flushThreshold(0)
 		,_globalBytesInUse(NULL)
+		,_globalFreeRegionRefillStats(NULL)
 	{
 		_typeId = __FUNCTION__;
+		_freeRegionRefillStats._refillCount = 0;
+		_freeRegionRefillStats._regionsRefilled = 0;
+		_freeRegionRefillStats._splitFreeListAllocationCount = 0;
 	};
 
 	void flushBytes();
+	void flushFreeRegionRefillStats();
 };
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
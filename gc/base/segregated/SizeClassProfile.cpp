@@ -0,0 +1,248 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+
+#include <string.h>
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+
+#include "SizeClassProfile.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/* The default size classes, the smallest of which bounds the generated ones */
+static const uintptr_t defaultCellSizes[OMR_SIZECLASSES_NUM_SMALL+1] = SMALL_SIZECLASSES;
+
+/* Longest line of a profile file */
+#define SIZE_CLASS_PROFILE_LINE_LENGTH 128
+
+/**
+ * Parse an unsigned decimal number, skipping leading blanks.
+ * @return the character following the number, or NULL if there was no number
+ */
+static const char *
+parseUnsigned(const char *cursor, uintptr_t *value)
+{
+	while ((' ' == *cursor) || ('\t' == *cursor)) {
+		cursor += 1;
+	}
+	if ((*cursor < '0') || (*cursor > '9')) {
+		return NULL;
+	}
+	*value = 0;
+	while ((*cursor >= '0') && (*cursor <= '9')) {
+		*value = (*value * 10) + (uintptr_t)(*cursor - '0');
+		cursor += 1;
+	}
+	return cursor;
+}
+
+uintptr_t *
+MM_SizeClassProfile::newHistogram(MM_EnvironmentBase *env)
+{
+	uintptr_t histogramBytes = sizeof(uintptr_t) * SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH;
+	uintptr_t *histogram = (uintptr_t *)env->getForge()->allocate(histogramBytes, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != histogram) {
+		memset(histogram, 0, histogramBytes);
+	}
+	return histogram;
+}
+
+void
+MM_SizeClassProfile::merge(uintptr_t *histogram, uintptr_t *threadHistogram)
+{
+	for (uintptr_t granules = 0; granules < SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH; granules++) {
+		if (0 != threadHistogram[granules]) {
+			MM_AtomicOperations::add(&histogram[granules], threadHistogram[granules]);
+			threadHistogram[granules] = 0;
+		}
+	}
+}
+
+bool
+MM_SizeClassProfile::dump(MM_EnvironmentBase *env, const char *fileName, uintptr_t *histogram)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	intptr_t fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		return false;
+	}
+
+	omrfile_printf(fd, "# Segregated heap allocation size profile: <size in bytes> <allocation count>, sizes rounded up to %zu bytes\n", (uintptr_t)SIZE_CLASS_PROFILE_GRANULE);
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL+1];
+	if (generateCellSizes(env, histogram, cellSizes)) {
+		omrfile_printf(fd, "# SMALL_SIZECLASSES { %zu", cellSizes[0]);
+		for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+			omrfile_printf(fd, ", %zu", cellSizes[sizeClass]);
+		}
+		omrfile_printf(fd, " }\n");
+	}
+	for (uintptr_t granules = 0; granules < SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH; granules++) {
+		if (0 != histogram[granules]) {
+			omrfile_printf(fd, "%zu %zu\n", granules * SIZE_CLASS_PROFILE_GRANULE, histogram[granules]);
+		}
+	}
+
+	return 0 == omrfile_close(fd);
+}
+
+bool
+MM_SizeClassProfile::load(MM_EnvironmentBase *env, const char *fileName, uintptr_t *histogram)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		return false;
+	}
+
+	memset(histogram, 0, sizeof(uintptr_t) * SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH);
+	bool result = true;
+	uintptr_t allocationCount = 0;
+	char line[SIZE_CLASS_PROFILE_LINE_LENGTH];
+	bool continued = false;
+	bool comment = false;
+	while (result && (NULL != omrfile_read_text(fd, line, sizeof(line)))) {
+		const char *cursor = line;
+		while ((' ' == *cursor) || ('\t' == *cursor)) {
+			cursor += 1;
+		}
+		if (continued) {
+			/* the rest of a line longer than the buffer, only comments may be that long */
+			result = comment;
+		} else if (('#' == *cursor) || ('\n' == *cursor) || ('\r' == *cursor) || ('\0' == *cursor)) {
+			/* comment or blank line */
+			comment = true;
+		} else {
+			uintptr_t size = 0;
+			uintptr_t count = 0;
+			cursor = parseUnsigned(cursor, &size);
+			if (NULL != cursor) {
+				cursor = parseUnsigned(cursor, &count);
+			}
+			if ((NULL == cursor) || (size > OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES)) {
+				result = false;
+			} else {
+				histogram[(size + SIZE_CLASS_PROFILE_GRANULE - 1) / SIZE_CLASS_PROFILE_GRANULE] += count;
+				allocationCount += count;
+			}
+			comment = false;
+		}
+		continued = (NULL == strchr(line, '\n'));
+	}
+	omrfile_close(fd);
+
+	return result && (0 != allocationCount);
+}
+
+bool
+MM_SizeClassProfile::generateCellSizes(MM_EnvironmentBase *env, uintptr_t *histogram, uintptr_t *cellSizes)
+{
+	return generateCellSizes(env->getForge(), env->getExtensions()->regionSize, histogram, cellSizes);
+}
+
+bool
+MM_SizeClassProfile::generateCellSizes(OMR::GC::Forge *forge, uintptr_t regionSize, uintptr_t *histogram, uintptr_t *cellSizes)
+{
+	const uintptr_t granule = SIZE_CLASS_PROFILE_GRANULE;
+	const uintptr_t length = SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH;
+	const uintptr_t classCount = OMR_SIZECLASSES_NUM_SMALL;
+	/* the smallest and largest cell sizes allowed, in granules */
+	const uintptr_t first = MM_Math::roundToCeiling(granule, defaultCellSizes[OMR_SIZECLASSES_MIN_SMALL]) / granule;
+	const uintptr_t last = length - 1;
+
+	if (((last - first + 1) < classCount) || (regionSize < (last * granule))) {
+		return false;
+	}
+
+	/* allocations[j] and bytes[j] accumulate the allocations of at most j granules and their sizes,
+	 * waste[k * length + j] is the least memory lost by allocations of at most j granules using k+1 size classes,
+	 * the largest of which has cells of j granules, and choice[k * length + j] the size of the next smaller class.
+	 */
+	uintptr_t tableBytes = (sizeof(double) * length * (2 + classCount)) + (sizeof(uintptr_t) * length * classCount);
+	double *allocations = (double *)forge->allocate(tableBytes, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == allocations) {
+		return false;
+	}
+	double *bytes = allocations + length;
+	double *waste = bytes + length;
+	uintptr_t *choice = (uintptr_t *)(waste + (length * classCount));
+
+	double allocationSum = 0.0;
+	double byteSum = 0.0;
+	for (uintptr_t j = 0; j < length; j++) {
+		allocationSum += (double)histogram[j];
+		byteSum += (double)histogram[j] * (double)(j * granule);
+		allocations[j] = allocationSum;
+		bytes[j] = byteSum;
+	}
+
+	bool result = (0.0 < allocationSum);
+	if (result) {
+		/* the smallest size class takes all allocations up to its cell size */
+		for (uintptr_t j = first; j <= last; j++) {
+			uintptr_t cellSize = j * granule;
+			double cellCost = (double)cellSize + ((double)(regionSize % cellSize) / (double)(regionSize / cellSize));
+			waste[j] = (cellCost * allocations[j]) - bytes[j];
+			choice[j] = 0;
+		}
+		for (uintptr_t k = 1; k < classCount; k++) {
+			double *previous = waste + ((k - 1) * length);
+			double *current = waste + (k * length);
+			for (uintptr_t j = first + k; j <= last; j++) {
+				uintptr_t cellSize = j * granule;
+				double cellCost = (double)cellSize + ((double)(regionSize % cellSize) / (double)(regionSize / cellSize));
+				double best = 0.0;
+				uintptr_t bestChoice = 0;
+				for (uintptr_t i = first + k - 1; i < j; i++) {
+					double candidate = previous[i] + (cellCost * (allocations[j] - allocations[i])) - (bytes[j] - bytes[i]);
+					if ((0 == bestChoice) || (candidate < best)) {
+						best = candidate;
+						bestChoice = i;
+					}
+				}
+				current[j] = best;
+				choice[(k * length) + j] = bestChoice;
+			}
+		}
+
+		/* walk back from the largest size class, which must hold the largest small allocations */
+		cellSizes[0] = 0;
+		uintptr_t j = last;
+		for (uintptr_t k = classCount; k > 0; k--) {
+			cellSizes[k] = j * granule;
+			j = choice[((k - 1) * length) + j];
+		}
+	}
+
+	forge->free(allocations);
+	return result;
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SIZECLASSPROFILE_HPP_)
+#define SIZECLASSPROFILE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrgcconsts.h"
+#include "sizeclasses.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/* Granule of the small allocation size histogram, sizes are rounded up to it */
+#define SIZE_CLASS_PROFILE_GRANULE 8
+#define SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH ((OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES / SIZE_CLASS_PROFILE_GRANULE) + 1)
+
+class MM_EnvironmentBase;
+
+namespace OMR {
+namespace GC {
+class Forge;
+}
+}
+
+/**
+ * Allocation size profile of the segregated heap, and generation of small size classes fitted to it.
+ *
+ * A profile is the histogram of small allocation sizes recorded by MM_SegregatedAllocationInterface while
+ * sizeClassProfileDumpFile is set, in granules of SIZE_CLASS_PROFILE_GRANULE bytes. It is written as a text file
+ * with one "<size> <count>" line per recorded size, preceded by comment lines starting with '#' which give the
+ * size classes generated for it.
+ * Those can be pasted into SMALL_SIZECLASSES, or the file can be loaded at startup to generate them again.
+ */
+class MM_SizeClassProfile
+{
+public:
+	/**
+	 * Allocate an empty histogram, to be freed with the forge.
+	 * @return the histogram, or NULL if memory is short
+	 */
+	static uintptr_t *newHistogram(MM_EnvironmentBase *env);
+
+	/**
+	 * Count a small allocation in a histogram.
+	 * @param histogram the number of allocations per granule
+	 * @param sizeInBytes the size of the allocation, at most OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES
+	 */
+	static MMINLINE void
+	record(uintptr_t *histogram, uintptr_t sizeInBytes)
+	{
+		histogram[(sizeInBytes + SIZE_CLASS_PROFILE_GRANULE - 1) / SIZE_CLASS_PROFILE_GRANULE] += 1;
+	}
+
+	/**
+	 * Atomically add a thread's histogram into the histogram of the run, and clear it.
+	 * @param histogram the histogram of the run
+	 * @param threadHistogram the histogram to add, zeroed on return
+	 */
+	static void merge(uintptr_t *histogram, uintptr_t *threadHistogram);
+
+	/**
+	 * Write an allocation size profile.
+	 * @param fileName the file to write, replaced if it exists
+	 * @param histogram the number of allocations per granule, SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH entries
+	 * @return true if the profile was written
+	 */
+	static bool dump(MM_EnvironmentBase *env, const char *fileName, uintptr_t *histogram);
+
+	/**
+	 * Read an allocation size profile written by dump().
+	 * @param fileName the file to read
+	 * @param histogram receives the number of allocations per granule, SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH entries
+	 * @return true if the file was read and holds at least one allocation
+	 */
+	static bool load(MM_EnvironmentBase *env, const char *fileName, uintptr_t *histogram);
+
+	/**
+	 * Choose the cell sizes of the small size classes which minimize the memory lost to internal fragmentation for
+	 * the given profile: the unused end of each cell, and the share of each cell in the unused end of its region.
+	 * Cell sizes are multiples of SIZE_CLASS_PROFILE_GRANULE, the smallest is at least the smallest cell size of
+	 * SMALL_SIZECLASSES and the largest is OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES.
+	 * @param histogram the number of allocations per granule
+	 * @param cellSizes receives the OMR_SIZECLASSES_NUM_SMALL+1 cell sizes, indexed by size class
+	 * @return true if cell sizes were generated, false if the histogram is empty or memory is short
+	 */
+	static bool generateCellSizes(MM_EnvironmentBase *env, uintptr_t *histogram, uintptr_t *cellSizes);
+
+	/**
+	 * @see generateCellSizes(MM_EnvironmentBase *, uintptr_t *, uintptr_t *)
+	 * @param forge the forge the work tables are allocated from
+	 * @param regionSize the size of the regions cells are carved from
+	 */
+	static bool generateCellSizes(OMR::GC::Forge *forge, uintptr_t regionSize, uintptr_t *histogram, uintptr_t *cellSizes);
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SIZECLASSPROFILE_HPP_ */
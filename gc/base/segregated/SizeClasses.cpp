@@ -22,6 +22,8 @@
 #include "SizeClasses.hpp"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "SizeClassProfile.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
@@ -62,6 +64,15 @@ MM_SizeClasses::initialize(MM_EnvironmentBase *env)
 	_sizeClassIndex = sizeClasses->sizeClassIndex;
 	
 	memcpy(_smallCellSizes, initialCellSizes, sizeof(initialCellSizes));
+
+	const char *profileFile = env->getExtensions()->sizeClassProfileFile;
+	if (NULL != profileFile) {
+		/* replace the initial size classes by those fitting the allocation size profile of a previous run */
+		uintptr_t histogram[SIZE_CLASS_PROFILE_HISTOGRAM_LENGTH];
+		if (!MM_SizeClassProfile::load(env, profileFile, histogram) || !MM_SizeClassProfile::generateCellSizes(env, histogram, _smallCellSizes)) {
+			return false;
+		}
+	}
 	
 	_sizeClassIndex[0] = 0;
 	_smallNumCells[0] = 0;
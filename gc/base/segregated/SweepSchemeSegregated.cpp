@@ -24,8 +24,10 @@
 #include "sizeclasses.h"
 #include "ModronAssertions.h"
 
+#include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "FreeHeapRegionList.hpp"
+#include "GCCode.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
@@ -103,6 +105,9 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 	_isFixHeapForWalk = isFixHeapForWalk;
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		/* heap walks, explicit and aggressive collections always sweep the whole heap */
+		MM_GCCode gcCode = env->_cycleState->_gcCode;
+		_isLazySweep = _extensions->segregatedLazySweep && !isFixHeapForWalk && !gcCode.isExplicitGC() && !gcCode.isAggressiveGC();
 		preSweep(env);
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
@@ -118,11 +123,16 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
-	incrementalSweepSmall(env);
+	if (!_isLazySweep) {
+		incrementalSweepSmall(env);
+	}
 	regionPool->joinBucketListsForSplitIndex(env);
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
 		regionPool->setSweepSmallPages(false);
+		/* the small regions left in the sweep lists are swept by allocating threads before they are reused */
+		regionPool->setSweepDebtRegions(regionPool->getCurrentTotalCountOfSweepRegions());
+		Trc_MM_SweepSchemeSegregated_sweepDebt(env->getLanguageVMThread(), regionPool->getSweepDebtRegions(), regionPool->getCarriedSweepDebtRegions(), regionPool->getLastLazySweptRegions());
 		postSweep(env);
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
@@ -144,6 +154,7 @@ void
 MM_SweepSchemeSegregated::sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region)
 {
 	region->getMemoryPoolACL()->resetCounts();
+	region->setSweepCycle(_memoryPool->getRegionPool()->getSweepCycle());
 
 	switch (region->getRegionType()) {
 
@@ -388,6 +399,7 @@ MM_SweepSchemeSegregated::incrementalCoalesceFreeRegions(MM_EnvironmentBase *env
 	yieldFromSweep(env, yieldSlackTime);
 
 	coalesceFreeList->push(regionPool->getSingleFreeList());
+	regionPool->pushSplitFreeLists(coalesceFreeList);
 	coalesceFreeList->push(regionPool->getMultiFreeList());
 	
 	MM_HeapRegionDescriptorSegregated *coalescing = NULL;
@@ -54,6 +54,7 @@ protected:
 private:
 	bool _isFixHeapForWalk;
 	bool _clearMarkMapAfterSweep; /**< If a region should be unmarked after it is swept */
+	bool _isLazySweep; /**< If the small regions are left for allocating threads to sweep in the current sweep */
 
 	/*
 	 * Function members
@@ -88,6 +89,7 @@ protected:
 		,_extensions(env->getExtensions())
 		,_isFixHeapForWalk(false)
 		,_clearMarkMapAfterSweep(true)
+		,_isLazySweep(false)
 	{
 		_typeId = __FUNCTION__;
 	};
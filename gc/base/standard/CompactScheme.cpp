@@ -33,6 +33,7 @@
 #include "Bits.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "CompactFixHeapForWalkTask.hpp"
+#include "CompactStats.hpp"
 #include "CompactSchemeFixupObject.hpp"
 #include "Debug.hpp"
 #include "EnvironmentBase.hpp"
@@ -53,6 +54,7 @@
 #include "ObjectModel.hpp"
 #include "ParallelDispatcher.hpp"
 #include "ParallelSweepScheme.hpp"
+#include "ParallelSweepChunk.hpp"
 #include "ParallelTask.hpp"
 #include "SlotObject.hpp"
 #include "SublistPool.hpp"
@@ -277,6 +279,41 @@ public:
 	{}
 };
 
+/* A sub area considered by partial compaction, with the sweep statistics of the chunks starting in it */
+struct PartialCompactCandidate {
+	uintptr_t subAreaIndex; /**< ordinal of the tentative sub area in heap order */
+	uintptr_t liveBytes; /**< bytes that compacting the sub area would move */
+	uintptr_t fragmentedBytes; /**< free bytes of the sub area outside of the largest free entry of each chunk */
+};
+
+/* A committed region and the ordinal of its first tentative sub area, used to place sweep chunks in sub areas */
+struct PartialCompactRegion {
+	void *lowAddress;
+	void *highAddress;
+	uintptr_t firstSubAreaIndex;
+};
+
+/**
+ * Helper function used by J9_SORT to rank partial compaction candidates, most fragmented bytes
+ * recovered per live byte moved first.
+ */
+static int
+comparePartialCompactCandidateFunc(const void *element1, const void *element2)
+{
+	const PartialCompactCandidate *candidate1 = (const PartialCompactCandidate *)element1;
+	const PartialCompactCandidate *candidate2 = (const PartialCompactCandidate *)element2;
+	uint64_t score1 = (uint64_t)candidate1->fragmentedBytes * ((uint64_t)candidate2->liveBytes + 1);
+	uint64_t score2 = (uint64_t)candidate2->fragmentedBytes * ((uint64_t)candidate1->liveBytes + 1);
+
+	if (score1 == score2) {
+		return (candidate1->subAreaIndex < candidate2->subAreaIndex) ? -1 : 1;
+	} else if (score1 > score2) {
+		return -1;
+	} else {
+		return 1;
+	}
+}
+
 bool
 MM_CompactScheme::initialize(MM_EnvironmentBase *env)
 {
@@ -286,6 +323,11 @@ MM_CompactScheme::initialize(MM_EnvironmentBase *env)
 void
 MM_CompactScheme::tearDown(MM_EnvironmentBase *env)
 {
+	if (NULL != _compactSubAreaMap) {
+		env->getForge()->free(_compactSubAreaMap);
+		_compactSubAreaMap = NULL;
+		_compactSubAreaMapSize = 0;
+	}
 	_delegate.tearDown(env);
 }
 
@@ -358,6 +400,9 @@ MM_CompactScheme::workerSetupForGC(MM_EnvironmentStandard *env, bool singleThrea
 	setRealLimitsSubAreas(env);
 	removeNullSubAreas(env);
 	completeSubAreaTable(env);
+	if (_partialCompact) {
+		sweepFixupOnlySubAreas(env);
+	}
 }
 
 void
@@ -381,11 +426,8 @@ MM_CompactScheme::freeChunkEnd(omrobjectptr_t chunk)
 	return (omrobjectptr_t)((uintptr_t)chunk + getFreeChunkSize(chunk));
 }
 
-/**
- *  Create sub areas table for regions.
- */
-void
-MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded)
+uintptr_t
+MM_CompactScheme::calculateSubAreaSize(MM_EnvironmentStandard *env)
 {
 	/* finding whether there are memory limitations */
 	uintptr_t max_subarea_num = _subAreaTableSize / sizeof(_subAreaTable[0]);
@@ -410,7 +452,145 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 	} else {
 		min_subarea_size = _heap->getMaximumPhysicalRange();
 	}
-	uintptr_t size = (DESIRED_SUBAREA_SIZE >= min_subarea_size) ?  DESIRED_SUBAREA_SIZE : min_subarea_size;
+	return (DESIRED_SUBAREA_SIZE >= min_subarea_size) ?  DESIRED_SUBAREA_SIZE : min_subarea_size;
+}
+
+bool
+MM_CompactScheme::selectPartialCompactSubAreas(MM_EnvironmentStandard *env)
+{
+	uintptr_t subAreaSize = calculateSubAreaSize(env);
+	uintptr_t subAreaCount = 0;
+	uintptr_t regionCount = 0;
+	MM_HeapRegionDescriptorStandard *region = NULL;
+
+	GC_HeapRegionIteratorStandard regionCounter(_rootManager);
+	while (NULL != (region = regionCounter.nextRegion())) {
+		if (region->isCommitted() && (0 != region->getSize())) {
+			subAreaCount += ((region->getSize() - 1) / subAreaSize) + 1;
+			regionCount += 1;
+		}
+	}
+	if (subAreaCount < 2) {
+		return false;
+	}
+
+	if (subAreaCount > _compactSubAreaMapSize) {
+		if (NULL != _compactSubAreaMap) {
+			env->getForge()->free(_compactSubAreaMap);
+		}
+		_compactSubAreaMap = (uint8_t *)env->getForge()->allocate(subAreaCount * sizeof(uint8_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		_compactSubAreaMapSize = (NULL == _compactSubAreaMap) ? 0 : subAreaCount;
+		if (NULL == _compactSubAreaMap) {
+			return false;
+		}
+	}
+
+	PartialCompactRegion *regions = (PartialCompactRegion *)env->getForge()->allocate(regionCount * sizeof(PartialCompactRegion), OMR::GC::AllocationCategory::OTHER, OMR_GET_CALLSITE());
+	if (NULL == regions) {
+		return false;
+	}
+	PartialCompactCandidate *candidates = (PartialCompactCandidate *)env->getForge()->allocate(subAreaCount * sizeof(PartialCompactCandidate), OMR::GC::AllocationCategory::OTHER, OMR_GET_CALLSITE());
+	if (NULL == candidates) {
+		env->getForge()->free(regions);
+		return false;
+	}
+
+	/* Regions are iterated in address order, so the table can be binary searched */
+	uintptr_t regionIndex = 0;
+	uintptr_t firstSubAreaIndex = 0;
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (region->isCommitted() && (0 != region->getSize())) {
+			regions[regionIndex].lowAddress = region->getLowAddress();
+			regions[regionIndex].highAddress = region->getHighAddress();
+			regions[regionIndex].firstSubAreaIndex = firstSubAreaIndex;
+			firstSubAreaIndex += ((region->getSize() - 1) / subAreaSize) + 1;
+			regionIndex += 1;
+		}
+	}
+	for (uintptr_t i = 0; i < subAreaCount; i++) {
+		candidates[i].subAreaIndex = i;
+		candidates[i].liveBytes = 0;
+		candidates[i].fragmentedBytes = 0;
+		_compactSubAreaMap[i] = 0;
+	}
+
+	/* The sweep that decided to compact left per chunk statistics, the sub area table has not overwritten them yet */
+	MM_SweepHeapSectioningIterator sectioningIterator(_extensions->sweepHeapSectioning);
+	MM_ParallelSweepChunk *chunk = NULL;
+	while (NULL != (chunk = sectioningIterator.nextChunk())) {
+		uintptr_t chunkSize = chunk->size();
+		if ((NULL == chunk->memoryPool) || (0 == chunkSize)) {
+			continue;
+		}
+		uintptr_t low = 0;
+		uintptr_t high = regionCount;
+		while (low < high) {
+			uintptr_t middle = low + ((high - low) / 2);
+			if (chunk->chunkBase >= regions[middle].highAddress) {
+				low = middle + 1;
+			} else {
+				high = middle;
+			}
+		}
+		if ((low == regionCount) || (chunk->chunkBase < regions[low].lowAddress)) {
+			continue;
+		}
+		uintptr_t subAreaIndex = regions[low].firstSubAreaIndex + (((uintptr_t)chunk->chunkBase - (uintptr_t)regions[low].lowAddress) / subAreaSize);
+		/* free entries at the chunk edges are counted as candidates to join the neighbouring chunks, not in freeBytes */
+		uintptr_t edgeFreeBytes = chunk->leadingFreeCandidateSize + chunk->trailingFreeCandidateSize;
+		uintptr_t freeBytes = OMR_MIN(chunk->freeBytes, chunkSize);
+		candidates[subAreaIndex].liveBytes += chunkSize - OMR_MIN(freeBytes + edgeFreeBytes, chunkSize);
+		if (freeBytes > chunk->_largestFreeEntry) {
+			candidates[subAreaIndex].fragmentedBytes += freeBytes - chunk->_largestFreeEntry;
+		}
+	}
+
+	env->getForge()->free(regions);
+
+	J9_SORT(candidates, subAreaCount, sizeof(PartialCompactCandidate), comparePartialCompactCandidateFunc);
+
+	/* Setup and fixup are paid whatever is moved, the rest of the pause target goes to moving objects */
+	uint64_t pauseTarget = _extensions->partialCompactPauseTarget;
+	uint64_t moveMillis = pauseTarget - OMR_MIN(_fixedCostMillis, pauseTarget);
+	moveMillis = OMR_MAX(moveMillis, pauseTarget / 4);
+	uintptr_t budgetBytes = (uintptr_t)OMR_MIN(moveMillis * _moveBytesPerMillisecond, (uint64_t)UDATA_MAX);
+
+	uintptr_t selectedCount = 0;
+	uintptr_t selectedLiveBytes = 0;
+	for (uintptr_t i = 0; i < subAreaCount; i++) {
+		if (0 == candidates[i].fragmentedBytes) {
+			/* ranked last, nothing left worth moving */
+			break;
+		}
+		/* the most fragmented sub area is always compacted, the others only while they fit the budget */
+		if ((0 != selectedCount) && ((selectedLiveBytes + candidates[i].liveBytes) > budgetBytes)) {
+			continue;
+		}
+		_compactSubAreaMap[candidates[i].subAreaIndex] = 1;
+		selectedLiveBytes += candidates[i].liveBytes;
+		selectedCount += 1;
+	}
+	env->getForge()->free(candidates);
+
+	if ((0 == selectedCount) || (subAreaCount == selectedCount)) {
+		return false;
+	}
+
+	env->_compactStats._partialCompactSubAreas = selectedCount;
+	env->_compactStats._partialCompactSkippedSubAreas = subAreaCount - selectedCount;
+	env->_compactStats._partialCompactBudgetBytes = budgetBytes;
+	return true;
+}
+
+/**
+ *  Create sub areas table for regions.
+ */
+void
+MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded)
+{
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	uintptr_t size = calculateSubAreaSize(env);
 
 
 	/* Single threaded pass to set tentative sub area limits tentative limits are
@@ -419,6 +599,7 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
 		GC_HeapRegionIteratorStandard regionIterator(_rootManager);
 		uintptr_t i = 0;
+		uintptr_t subAreaIndex = 0;
 		while(NULL != (region = regionIterator.nextRegion())) {
 			if (!region->isCommitted() || (0 == region->getSize())) {
 				continue;
@@ -429,7 +610,8 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 			MM_MemorySubSpace *memorySubSpace = region->getSubSpace();
 			intptr_t state = SubAreaEntry::init;
 
-			if (singleThreaded) {
+			/* A partial compaction keeps the sub area granularity it was selected with */
+			if (singleThreaded && !_partialCompact) {
 				size = areaSize;
 			}
 			_subAreaTable[i].firstObject = (omrobjectptr_t)lowAddress;
@@ -440,6 +622,11 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 			for( uintptr_t subAreaNum=0; subAreaNum < numSubAreas; subAreaNum++){
 				uint8_t *p = (uint8_t*)(((uintptr_t)lowAddress) + (subAreaNum * size));
 
+				if (_partialCompact) {
+					state = (0 != _compactSubAreaMap[subAreaIndex]) ? SubAreaEntry::init : SubAreaEntry::fixup_only;
+					subAreaIndex += 1;
+				}
+
 				_subAreaTable[i].freeChunk = (omrobjectptr_t)p;
 				_subAreaTable[i].memoryPool = memorySubSpace->getMemoryPool(p);
 				_subAreaTable[i].state = state;
@@ -539,6 +726,66 @@ MM_CompactScheme::completeSubAreaTable(MM_EnvironmentStandard *env)
 	}
 }
 
+void
+MM_CompactScheme::sweepFixupOnlySubAreas(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if ((SubAreaEntry::fixup_only == subAreaTable[i].state) && changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::sweeping)) {
+				sweepFixupOnlySubArea(env, region->getSubSpace(), subAreaTable[i].firstObject, subAreaTable[i+1].firstObject);
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::sweepFixupOnlySubArea(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, omrobjectptr_t firstObject, omrobjectptr_t finish)
+{
+	/* No object of the previous sub area starts in the page of firstObject, nor one of this sub area in the page of finish */
+	omrobjectptr_t freeBase = firstObject;
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)firstObject, (uintptr_t *)pageStart(pageIndex(finish)));
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		if (objectPtr > freeBase) {
+			memorySubSpace->abandonHeapChunk(freeBase, objectPtr);
+		}
+		freeBase = (omrobjectptr_t)((uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+	}
+	if (freeBase < finish) {
+		memorySubSpace->abandonHeapChunk(freeBase, finish);
+	}
+
+	/* The compact table shares the mark map: an empty entry forwards the objects of its page to themselves */
+	_markMap->setBitsInRange(env, pageStart(pageIndex(firstObject)), pageStart(pageIndex(finish)), true);
+}
+
+void
+MM_CompactScheme::updatePartialCompactEstimates(MM_EnvironmentBase *env, MM_CompactStats *compactStats)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t moveMicros = omrtime_hires_delta(compactStats->_moveStartTime, compactStats->_moveEndTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	if ((0 != moveMicros) && (0 != compactStats->_movedBytes)) {
+		_moveBytesPerMillisecond = (uintptr_t)OMR_MAX(((uint64_t)compactStats->_movedBytes * 1000) / moveMicros, 1);
+	}
+
+	uint64_t fixedCostMicros = omrtime_hires_delta(compactStats->_setupStartTime, compactStats->_setupEndTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	fixedCostMicros += omrtime_hires_delta(compactStats->_fixupStartTime, compactStats->_fixupEndTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	fixedCostMicros += omrtime_hires_delta(compactStats->_rootFixupStartTime, compactStats->_rootFixupEndTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	_fixedCostMillis = fixedCostMicros / 1000;
+}
+
 void
 MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, bool aggressive)
 {
@@ -550,6 +797,16 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	uintptr_t fixupObjectsCount = 0;
 	bool singleThreaded = false;
 
+	/* We force a single sub area compaction if:
+	 *  o the compaction is aggressive. We use a single sub area per segment to avoid potentially having
+	 *    multiple holes created per segment, thereby fragmenting the space. This will result in
+	 *    singlethreaded compaction per segment, and so should only be done in extreme OOM situations.
+	 *  o no worker GC threads
+	 */
+	if (aggressive || (1 == env->_currentTask->getThreadCount())  || (_extensions->usingSATBBarrier())) {
+		singleThreaded = true;
+	}
+
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
 		/* Do any necessary initialization */
 		/* TODO: Perhaps the task dispatch should occur internally within so that the initialization doesn't need to be
@@ -563,17 +820,21 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
 		_extensions->heap->resetLargestFreeEntry();
 
-		env->_currentTask->releaseSynchronizedGCThreads(env);
-	}
+		/* Fragmentation is relieved by compacting where it is, other reasons need the whole heap compacted */
+		_partialCompact = false;
+		if (_extensions->partialCompact && !aggressive && !_extensions->usingSATBBarrier()) {
+			switch (_extensions->globalGCStats.compactStats._compactReason) {
+			case COMPACT_FRAGMENTED:
+			case COMPACT_MICRO_FRAG:
+			case COMPACT_PAGE:
+				_partialCompact = selectPartialCompactSubAreas(env);
+				break;
+			default:
+				break;
+			}
+		}
 
-	/* We force a single sub area compaction if:
-	 *  o the compaction is aggressive. We use a single sub area per segment to avoid potentially having
-	 *    multiple holes created per segment, thereby fragmenting the space. This will result in
-	 *    singlethreaded compaction per segment, and so should only be done in extreme OOM situations.
-	 *  o no worker GC threads
-	 */
-	if (aggressive || (1 == env->_currentTask->getThreadCount())  || (_extensions->usingSATBBarrier())) {
-		singleThreaded = true;
+		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
 	env->_compactStats._setupStartTime = omrtime_hires_clock();
@@ -679,7 +940,23 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 		poolState->_memoryPool = subAreaTable[i].memoryPool;
 
 		do {
-			if (NULL != subAreaTable[i].freeChunk) {
+			if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+				/* Left in place by a partial compaction: its holes are free memory, they extend any free memory before them */
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, subAreaTable[i].firstObject, subAreaTable[i + 1].firstObject, true);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					if (objectIterator.isDeadObject()) {
+						if (NULL == currentFreeBase) {
+							currentFreeBase = (void *)objectPtr;
+						}
+					} else if (NULL != currentFreeBase) {
+						currentFreeSize = (uintptr_t)objectPtr - (uintptr_t)currentFreeBase;
+						addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, currentFreeSize);
+						currentFreeBase = NULL;
+						currentFreeSize = 0;
+					}
+				}
+			} else if (NULL != subAreaTable[i].freeChunk) {
 				if (subAreaTable[i].freeChunk == subAreaTable[i].firstObject) {
 					/* The entire sub area is free */
 					if (NULL == currentFreeBase) {
@@ -1357,7 +1634,7 @@ MM_CompactScheme::fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCou
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_up)) {
-        		fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, subAreaTable[i].state == SubAreaEntry::fixup_only, objectCount);
+        		fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, objectCount);
 			}
         }
         /* Number of regions in regionTable, including
@@ -1374,7 +1651,7 @@ MM_CompactScheme::fixupObjectSlot(GC_SlotObject* slotObject)
 }
 
 void
-MM_CompactScheme::fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish,  bool markedOnly, uintptr_t& objectCount)
+MM_CompactScheme::fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish, uintptr_t& objectCount)
 {
 	/* if start address is NULL, means we don't need to fix this subarea */
 	if (NULL == firstObject) {
@@ -1383,22 +1660,13 @@ MM_CompactScheme::fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t first
 
 	MM_CompactSchemeFixupObject fixupObject(env, this);
 
-	if (markedOnly) {
-		finish = pageStart(pageIndex(finish));
-		MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)firstObject, (uintptr_t *)finish);
-		omrobjectptr_t objectPtr = NULL;
-		while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
-			objectCount++;
-			fixupObject.fixupObject(env, objectPtr);
-		}
-	} else {
-		GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, firstObject, finish, false);
+	/* Compacted sub areas hold only live objects, fixup_only ones were swept while setting up */
+	GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, firstObject, finish, false);
 
-		omrobjectptr_t objectPtr;
-		while (NULL != (objectPtr = objectIterator.nextObject())) {
-			objectCount++;
-			fixupObject.fixupObject(env, objectPtr);
-		}
+	omrobjectptr_t objectPtr;
+	while (NULL != (objectPtr = objectIterator.nextObject())) {
+		objectCount++;
+		fixupObject.fixupObject(env, objectPtr);
 	}
 }
 
@@ -1416,11 +1684,9 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		}
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
-        	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
-	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
-	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
-				}
+        	/* fixup_only sub areas need it too, their compact table entries were cleared */
+        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
+        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
         	}
         }
         /* Number of regions in regionTable, including
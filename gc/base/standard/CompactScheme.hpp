@@ -47,6 +47,10 @@ class MM_MemoryPool;
 class MM_MemorySubSpace;
 class MM_ParallelDispatcher;
 class CompactTableEntry;
+class MM_CompactStats;
+
+/* Move rate assumed by partial compaction until a compaction has been measured, in bytes per millisecond */
+#define PARTIAL_COMPACT_DEFAULT_MOVE_BYTES_PER_MILLISECOND ((uintptr_t)(256 * 1024))
 
 class MM_CompactMemoryPoolState : public MM_BaseVirtual
 {
@@ -100,7 +104,8 @@ private:
 			evacuating,
 			fixing_up,
 			rebuilding_mark_bits,
-			fixing_heap_for_walk
+			fixing_heap_for_walk,
+			sweeping
 		};
     	
 		/* legal values for state
@@ -138,6 +143,11 @@ protected:
 	omrobjectptr_t         _compactFrom;
 	omrobjectptr_t         _compactTo;
 	MM_CompactDelegate     _delegate;
+	bool                   _partialCompact; /**< true if only the sub areas flagged in _compactSubAreaMap are compacted this cycle */
+	uint8_t                *_compactSubAreaMap; /**< one entry per tentative sub area, in heap order, non-zero if the sub area is compacted by a partial compaction */
+	uintptr_t              _compactSubAreaMapSize; /**< number of entries _compactSubAreaMap can hold */
+	uintptr_t              _moveBytesPerMillisecond; /**< move rate measured by the last compaction, used to size partial compactions */
+	uint64_t               _fixedCostMillis; /**< setup and fixup time of the last compaction, which a partial compaction does not reduce */
 
 public:
 
@@ -160,6 +170,22 @@ protected:
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
 
+	/**
+	 * @return the size of the sub areas the regions are divided into when compacting with several threads
+	 */
+	uintptr_t calculateSubAreaSize(MM_EnvironmentStandard *env);
+
+	/**
+	 * Choose the sub areas a partial compaction moves, before the sub area table overwrites the sweep chunks.
+	 * Sub areas are ranked by the free bytes the last sweep found outside of their largest free entry
+	 * (fragmented free memory) per live byte to move, and picked in that order until the live bytes to
+	 * move exceed the budget derived from partialCompactPauseTarget.
+	 *
+	 * @param env[in] the main thread
+	 * @return true if some sub areas are left in place, false if the whole heap should be compacted
+	 */
+	bool selectPartialCompactSubAreas(MM_EnvironmentStandard *env);
+
 	void createSubAreaTable(MM_EnvironmentStandard *env, bool singleThreaded);
 	/**
 	 * Set the real limits for a specific subArea
@@ -170,6 +196,16 @@ protected:
 	void removeNullSubAreas(MM_EnvironmentStandard *env);
 	void completeSubAreaTable(MM_EnvironmentStandard *env);
 
+	/**
+	 * Make the sub areas left in place by a partial compaction walkable: the gaps between marked objects
+	 * are turned into holes, then the compact table entries of their pages are cleared so objects in them
+	 * forward to themselves.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void sweepFixupOnlySubAreas(MM_EnvironmentStandard *env);
+	void sweepFixupOnlySubArea(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, omrobjectptr_t firstObject, omrobjectptr_t finish);
+
 	void saveForwardingPtr(class CompactTableEntry&,
 					omrobjectptr_t objectPtr,
 					omrobjectptr_t forwardingPtr,
@@ -212,10 +248,9 @@ protected:
 	 * @param env[in] the current thread
 	 * @param[in] firstObject The first object in the subArea
 	 * @param[in] finish The last object in the subArea
-	 * @param markedOnly[in] Should only marked objects be walked
 	 * @param[in/out] objectCount the number of objects fixed up (accumulated)
 	 */
-	void fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish,  bool markedOnly, uintptr_t& objectCount);
+	void fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish, uintptr_t& objectCount);
 	void fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCount);
 
 	void rebuildFreelist(MM_EnvironmentStandard *env);
@@ -315,6 +350,12 @@ public:
 	void fixHeapForWalk(MM_EnvironmentBase *env, uintptr_t walkFlags, uintptr_t walkReason);
 	void parallelFixHeapForWalk(MM_EnvironmentBase *env);
 
+	/**
+	 * Record the move rate and fixed costs of a completed compaction, used to size the next partial compactions.
+	 * @param compactStats[in] the merged stats of the compaction
+	 */
+	void updatePartialCompactEstimates(MM_EnvironmentBase *env, MM_CompactStats *compactStats);
+
 	/**
 	 * Perform fixup for a single object slot
 	 * @param slotObject pointer to slotObject for fixup
@@ -336,6 +377,11 @@ public:
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
 		, _delegate()
+		, _partialCompact(false)
+		, _compactSubAreaMap(NULL)
+		, _compactSubAreaMapSize(0)
+		, _moveBytesPerMillisecond(PARTIAL_COMPACT_DEFAULT_MOVE_BYTES_PER_MILLISECOND)
+		, _fixedCostMillis(0)
 	{
 		_typeId = __FUNCTION__;
 	}
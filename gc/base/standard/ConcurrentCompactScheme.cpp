@@ -0,0 +1,452 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+
+#include "ConcurrentCompactScheme.hpp"
+
+#include "ModronAssertions.h"
+
+#include "AllocateDescription.hpp"
+#include "AtomicOperations.hpp"
+#include "CollectorLanguageInterface.hpp"
+#include "CompactStats.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "HeapMapIterator.hpp"
+#include "MarkingScheme.hpp"
+#include "MarkMap.hpp"
+#include "Math.hpp"
+#include "MemoryPool.hpp"
+#include "ObjectModel.hpp"
+#include "ParallelSweepChunk.hpp"
+#include "SweepHeapSectioning.hpp"
+
+#if !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+#define getConsumedSizeInBytesWithHeaderForMove getConsumedSizeInBytesWithHeader
+#endif /* !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
+
+/**
+ * Allocate and initialize a new instance of the receiver.
+ * @return a new instance of the receiver, or NULL on failure.
+ */
+MM_ConcurrentCompactScheme *
+MM_ConcurrentCompactScheme::newInstance(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme)
+{
+	MM_ConcurrentCompactScheme *concurrentCompactScheme = (MM_ConcurrentCompactScheme *)env->getForge()->allocate(sizeof(MM_ConcurrentCompactScheme), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != concurrentCompactScheme) {
+		new(concurrentCompactScheme) MM_ConcurrentCompactScheme(env, markingScheme);
+		if (!concurrentCompactScheme->initialize(env)) {
+			concurrentCompactScheme->kill(env);
+			concurrentCompactScheme = NULL;
+		}
+	}
+
+	return concurrentCompactScheme;
+}
+
+bool
+MM_ConcurrentCompactScheme::initialize(MM_EnvironmentBase *env)
+{
+	return true;
+}
+
+void
+MM_ConcurrentCompactScheme::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _sliceTable) {
+		env->getForge()->free((void *)_sliceTable);
+		_sliceTable = NULL;
+	}
+}
+
+/**
+ * Free the receiver and all associated resources.
+ */
+void
+MM_ConcurrentCompactScheme::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ConcurrentCompactScheme::isSupported(MM_EnvironmentBase *env)
+{
+	return _extensions->collectorLanguageInterface->concurrentCompact_isReadBarrierSupported(env);
+}
+
+uintptr_t
+MM_ConcurrentCompactScheme::selectEvacuateRanges(MM_EnvironmentBase *env, uintptr_t *liveBytes)
+{
+	MM_SweepHeapSectioningIterator sectioningIterator(_extensions->sweepHeapSectioning);
+	MM_ParallelSweepChunk *chunk = NULL;
+
+	/* Copies are allocated from the free memory left outside of the set, keep half of it in reserve */
+	uintptr_t totalFreeBytes = 0;
+	while (NULL != (chunk = sectioningIterator.nextChunk())) {
+		totalFreeBytes += getChunkFreeBytes(chunk);
+	}
+
+	uintptr_t selectedFreeBytes = 0;
+	uintptr_t selectedLiveBytes = 0;
+	uintptr_t sliceCount = 0;
+	_rangeCount = 0;
+
+	sectioningIterator.restart(_extensions->sweepHeapSectioning);
+	while (NULL != (chunk = sectioningIterator.nextChunk())) {
+		uintptr_t chunkSize = chunk->size();
+		uintptr_t chunkFreeBytes = getChunkFreeBytes(chunk);
+		if ((NULL == chunk->memoryPool) || (0 == chunkSize) || (chunkFreeBytes >= chunkSize)) {
+			/* nothing live to evacuate */
+			continue;
+		}
+		uintptr_t chunkLiveBytes = chunkSize - chunkFreeBytes;
+		if ((chunkLiveBytes * 100) >= (_extensions->concurrentCompactLiveThreshold * chunkSize)) {
+			continue;
+		}
+		uintptr_t remainingFreeBytes = totalFreeBytes - selectedFreeBytes - chunkFreeBytes;
+		if ((selectedLiveBytes + chunkLiveBytes) > (remainingFreeBytes / 2)) {
+			break;
+		}
+
+		EvacuateRange *range = (0 == _rangeCount) ? NULL : &_ranges[_rangeCount - 1];
+		if ((NULL != range) && (range->top == chunk->chunkBase) && (range->memoryPool == chunk->memoryPool)) {
+			range->top = chunk->chunkTop;
+		} else {
+			if (CONCURRENT_COMPACT_MAX_RANGES == _rangeCount) {
+				break;
+			}
+			if (NULL != range) {
+				sliceCount += MM_Math::roundToCeiling(CONCURRENT_COMPACT_SLICE_SIZE, (uintptr_t)range->top - (uintptr_t)range->base) / CONCURRENT_COMPACT_SLICE_SIZE;
+			}
+			range = &_ranges[_rangeCount];
+			range->memoryPool = chunk->memoryPool;
+			range->base = chunk->chunkBase;
+			range->top = chunk->chunkTop;
+			range->firstSlice = sliceCount;
+			_rangeCount += 1;
+		}
+		selectedFreeBytes += chunkFreeBytes;
+		selectedLiveBytes += chunkLiveBytes;
+	}
+
+	if (0 != _rangeCount) {
+		EvacuateRange *range = &_ranges[_rangeCount - 1];
+		sliceCount += MM_Math::roundToCeiling(CONCURRENT_COMPACT_SLICE_SIZE, (uintptr_t)range->top - (uintptr_t)range->base) / CONCURRENT_COMPACT_SLICE_SIZE;
+	}
+
+	*liveBytes = selectedLiveBytes;
+	return sliceCount;
+}
+
+MM_ConcurrentCompactScheme::EvacuateRange *
+MM_ConcurrentCompactScheme::findRange(void *address)
+{
+	for (uintptr_t i = 0; i < _rangeCount; i++) {
+		if ((address >= _ranges[i].base) && (address < _ranges[i].top)) {
+			return &_ranges[i];
+		}
+	}
+	return NULL;
+}
+
+MM_ConcurrentCompactScheme::EvacuateRange *
+MM_ConcurrentCompactScheme::findRangeForSlice(uintptr_t sliceIndex)
+{
+	uintptr_t i = 1;
+	while ((i < _rangeCount) && (_ranges[i].firstSlice <= sliceIndex)) {
+		i += 1;
+	}
+	return &_ranges[i - 1];
+}
+
+bool
+MM_ConcurrentCompactScheme::selectEvacuation(MM_EnvironmentBase *env)
+{
+	Assert_MM_false(isEvacuating());
+	Assert_MM_true(NULL == _sliceTable);
+
+	uintptr_t liveBytes = 0;
+	uintptr_t sliceCount = selectEvacuateRanges(env, &liveBytes);
+	if (0 == sliceCount) {
+		_rangeCount = 0;
+		return false;
+	}
+
+	_sliceTable = (volatile uintptr_t *)env->getForge()->allocate(sliceCount * sizeof(uintptr_t), OMR::GC::AllocationCategory::OTHER, OMR_GET_CALLSITE());
+	if (NULL == _sliceTable) {
+		_rangeCount = 0;
+		return false;
+	}
+	for (uintptr_t i = 0; i < sliceCount; i++) {
+		_sliceTable[i] = slice_unclaimed;
+	}
+	_sliceCount = sliceCount;
+	_selectedLiveBytes = liveBytes;
+
+	return true;
+}
+
+void
+MM_ConcurrentCompactScheme::cancelEvacuation(MM_EnvironmentBase *env)
+{
+	Assert_MM_false(isEvacuating());
+
+	env->getForge()->free((void *)_sliceTable);
+	_sliceTable = NULL;
+	_sliceCount = 0;
+	_rangeCount = 0;
+	_selectedLiveBytes = 0;
+}
+
+void
+MM_ConcurrentCompactScheme::startEvacuation(MM_EnvironmentBase *env, MM_CompactStats *compactStats)
+{
+	Assert_MM_false(isEvacuating());
+	Assert_MM_true(NULL != _sliceTable);
+
+	_nextSlice = 0;
+	_evacuatedObjects = 0;
+	_evacuatedBytes = 0;
+	_barrierBytes = 0;
+	_pinnedSlices = 0;
+	_finalBytes = 0;
+
+	/* Nothing may be allocated in the set any more. The removed free entries stay formatted as holes until the next sweep. */
+	void *lowAddress = _ranges[0].base;
+	void *highAddress = _ranges[0].top;
+	for (uintptr_t i = 0; i < _rangeCount; i++) {
+		MM_HeapLinkedFreeHeader *freeListHead = NULL;
+		MM_HeapLinkedFreeHeader *freeListTail = NULL;
+		uintptr_t freeMemoryCount = 0;
+		uintptr_t freeMemorySize = 0;
+		_ranges[i].memoryPool->removeFreeEntriesWithinRange(env, _ranges[i].base, _ranges[i].top, 0, freeListHead, freeListTail, freeMemoryCount, freeMemorySize);
+		lowAddress = OMR_MIN(lowAddress, _ranges[i].base);
+		highAddress = OMR_MAX(highAddress, _ranges[i].top);
+	}
+	_evacuateBase = lowAddress;
+	MM_AtomicOperations::storeSync();
+	_evacuateTop = highAddress;
+
+	compactStats->_concurrentEvacuateRanges = _rangeCount;
+	compactStats->_concurrentEvacuateLiveBytes = _selectedLiveBytes;
+
+	MM_CollectorLanguageInterface *cli = _extensions->collectorLanguageInterface;
+	cli->concurrentCompact_enableReadBarrier(env, this);
+	cli->concurrentCompact_evacuateRoots(env, this);
+}
+
+bool
+MM_ConcurrentCompactScheme::refreshCopySpace(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uint8_t **copyBase, uint8_t **copyTop, uintptr_t objectSize, uintptr_t remainingBytes)
+{
+	if (*copyBase < *copyTop) {
+		memoryPool->abandonHeapChunk(*copyBase, *copyTop);
+	}
+	*copyBase = NULL;
+	*copyTop = NULL;
+
+	/* Ask for room for the rest of the slice, the pool may hand out less */
+	MM_AllocateDescription allocDescription(remainingBytes, 0, false, true);
+	void *addrBase = NULL;
+	void *addrTop = NULL;
+	if (NULL != memoryPool->collectorAllocateTLH(env, &allocDescription, remainingBytes, addrBase, addrTop, true)) {
+		if (((uintptr_t)addrTop - (uintptr_t)addrBase) >= objectSize) {
+			*copyBase = (uint8_t *)addrBase;
+			*copyTop = (uint8_t *)addrTop;
+			return true;
+		}
+		memoryPool->abandonHeapChunk(addrBase, addrTop);
+	}
+
+	/* No free entry large enough for the rest of the slice, look for one fitting just this object */
+	MM_AllocateDescription objectAllocDescription(objectSize, 0, false, true);
+	void *objectBase = memoryPool->collectorAllocate(env, &objectAllocDescription, true);
+	if (NULL != objectBase) {
+		*copyBase = (uint8_t *)objectBase;
+		*copyTop = (uint8_t *)objectBase + objectSize;
+		return true;
+	}
+
+	return false;
+}
+
+uintptr_t
+MM_ConcurrentCompactScheme::evacuateSlice(MM_EnvironmentBase *env, uintptr_t sliceIndex, bool fromBarrier)
+{
+	if (slice_unclaimed != MM_AtomicOperations::lockCompareExchange(&_sliceTable[sliceIndex], slice_unclaimed, slice_busy)) {
+		return 0;
+	}
+
+	bool const compressed = _extensions->compressObjectReferences();
+	EvacuateRange *range = findRangeForSlice(sliceIndex);
+	uintptr_t *sliceBase = (uintptr_t *)((uintptr_t)range->base + ((sliceIndex - range->firstSlice) * CONCURRENT_COMPACT_SLICE_SIZE));
+	uintptr_t *sliceTop = (uintptr_t *)OMR_MIN((uintptr_t)sliceBase + CONCURRENT_COMPACT_SLICE_SIZE, (uintptr_t)range->top);
+	MM_MarkMap *markMap = _markingScheme->getMarkMap();
+
+	/* The heap map iterator must not read object sizes: the headers of evacuated objects hold forwarding pointers */
+	MM_HeapMapIterator markedObjectIterator(_extensions, markMap, sliceBase, sliceTop, false);
+	uintptr_t remainingBytes = 0;
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		remainingBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeaderForMove(objectPtr);
+	}
+
+	uint8_t *copyBase = NULL;
+	uint8_t *copyTop = NULL;
+	uintptr_t objectCount = 0;
+	uintptr_t byteCount = 0;
+	uintptr_t sliceState = slice_evacuated;
+
+	markedObjectIterator.reset(markMap, sliceBase, sliceTop);
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+		uintptr_t objectSizeAfterMove = _extensions->objectModel.getConsumedSizeInBytesWithHeaderForMove(objectPtr);
+
+		if (((uintptr_t)(copyTop - copyBase) < objectSizeAfterMove)
+			&& !refreshCopySpace(env, range->memoryPool, &copyBase, &copyTop, objectSizeAfterMove, remainingBytes)
+		) {
+			sliceState = slice_pinned;
+			break;
+		}
+
+		omrobjectptr_t destinationObjectPtr = (omrobjectptr_t)copyBase;
+		env->preObjectMoveForCompact(objectPtr);
+		memcpy(destinationObjectPtr, objectPtr, objectSize);
+		env->postObjectMoveForCompact(destinationObjectPtr, objectPtr);
+
+		/* This thread owns the slice, nobody else can have forwarded the object */
+		MM_ForwardedHeader forwardedHeader(objectPtr, compressed);
+		omrobjectptr_t forwardedPtr = forwardedHeader.setForwardedObject(destinationObjectPtr);
+		Assert_MM_true(forwardedPtr == destinationObjectPtr);
+
+		copyBase += objectSizeAfterMove;
+		remainingBytes -= objectSizeAfterMove;
+		objectCount += 1;
+		byteCount += objectSizeAfterMove;
+	}
+
+	if (copyBase < copyTop) {
+		range->memoryPool->abandonHeapChunk(copyBase, copyTop);
+	}
+
+	MM_AtomicOperations::add(&_evacuatedObjects, objectCount);
+	MM_AtomicOperations::add(&_evacuatedBytes, byteCount);
+	if (fromBarrier) {
+		MM_AtomicOperations::add(&_barrierBytes, byteCount);
+	}
+	if (slice_pinned == sliceState) {
+		MM_AtomicOperations::add(&_pinnedSlices, 1);
+	}
+
+	/* Publish the copies and forwarding pointers before the slice state */
+	MM_AtomicOperations::storeSync();
+	_sliceTable[sliceIndex] = sliceState;
+
+	return byteCount;
+}
+
+omrobjectptr_t
+MM_ConcurrentCompactScheme::evacuateObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	EvacuateRange *range = findRange(objectPtr);
+	if (NULL == range) {
+		/* between two ranges of the set */
+		return objectPtr;
+	}
+
+	uintptr_t sliceIndex = range->firstSlice + (((uintptr_t)objectPtr - (uintptr_t)range->base) / CONCURRENT_COMPACT_SLICE_SIZE);
+	for (;;) {
+		uintptr_t sliceState = _sliceTable[sliceIndex];
+		if (slice_unclaimed == sliceState) {
+			evacuateSlice(env, sliceIndex, true);
+		} else if (slice_busy == sliceState) {
+			/* another thread is copying the slice, the original must not be used meanwhile */
+			MM_AtomicOperations::yieldCPU();
+		} else {
+			break;
+		}
+	}
+	MM_AtomicOperations::loadSync();
+
+	MM_ForwardedHeader forwardedHeader(objectPtr, _extensions->compressObjectReferences());
+	omrobjectptr_t forwardedPtr = forwardedHeader.getForwardedObject();
+	return (NULL == forwardedPtr) ? objectPtr : forwardedPtr;
+}
+
+void
+MM_ConcurrentCompactScheme::payAllocationTax(MM_EnvironmentBase *env, uintptr_t allocationSize)
+{
+	if (!isEvacuating()) {
+		return;
+	}
+
+	uintptr_t taxBytes = allocationSize * _extensions->concurrentCompactEvacuateRate;
+	uintptr_t paidBytes = 0;
+	while ((paidBytes < taxBytes) && (_nextSlice < _sliceCount)) {
+		uintptr_t sliceIndex = MM_AtomicOperations::add(&_nextSlice, 1) - 1;
+		if (sliceIndex >= _sliceCount) {
+			break;
+		}
+		/* a slice already evacuated from the read barrier costs nothing, move on to the next one */
+		paidBytes += evacuateSlice(env, sliceIndex, false);
+	}
+}
+
+void
+MM_ConcurrentCompactScheme::completeEvacuation(MM_EnvironmentBase *env)
+{
+	Assert_MM_true(isEvacuating());
+
+	for (uintptr_t sliceIndex = 0; sliceIndex < _sliceCount; sliceIndex++) {
+		/* mutators are stopped, no slice can be busy */
+		Assert_MM_true(slice_busy != _sliceTable[sliceIndex]);
+		_finalBytes += evacuateSlice(env, sliceIndex, false);
+	}
+	_nextSlice = _sliceCount;
+}
+
+void
+MM_ConcurrentCompactScheme::closeEvacuation(MM_EnvironmentBase *env, MM_CompactStats *compactStats)
+{
+	Assert_MM_true(isEvacuating());
+
+	_extensions->collectorLanguageInterface->concurrentCompact_disableReadBarrier(env);
+
+	compactStats->_concurrentEvacuatedObjects = _evacuatedObjects;
+	compactStats->_concurrentEvacuatedBytes = _evacuatedBytes;
+	compactStats->_concurrentEvacuatedBarrierBytes = _barrierBytes;
+	compactStats->_concurrentEvacuatedFinalBytes = _finalBytes;
+	compactStats->_concurrentEvacuatePinnedSlices = _pinnedSlices;
+
+	env->getForge()->free((void *)_sliceTable);
+	_sliceTable = NULL;
+	_sliceCount = 0;
+	_nextSlice = 0;
+	_rangeCount = 0;
+	_selectedLiveBytes = 0;
+	_evacuateTop = NULL;
+	_evacuateBase = NULL;
+}
+
+#endif /* OMR_GC_MODRON_COMPACTION */
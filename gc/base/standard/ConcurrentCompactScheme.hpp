@@ -0,0 +1,291 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(CONCURRENTCOMPACTSCHEME_HPP_)
+#define CONCURRENTCOMPACTSCHEME_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "ForwardedHeader.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ParallelSweepChunk.hpp"
+
+class MM_CompactStats;
+class MM_MarkingScheme;
+class MM_MemoryPool;
+
+/* Maximum number of address ranges (runs of adjacent sweep chunks) evacuated at once */
+#define CONCURRENT_COMPACT_MAX_RANGES 64
+/* Granule of evacuation work: all objects starting in a slice are evacuated together by a single thread */
+#define CONCURRENT_COMPACT_SLICE_SIZE ((uintptr_t)4096)
+
+/**
+ * Incremental compaction of the standard global GC. Instead of sliding the whole heap in a stop-the-world
+ * compaction, sparse sweep chunks are selected at the end of a global collect and their live objects are
+ * copied elsewhere while mutators run:
+ *
+ * - at the end of the global collect the sparse chunks are removed from the free lists, the language read
+ *   barrier is armed and the roots referring into the evacuation set are evacuated;
+ * - mutators evacuate slices of the set as an allocation tax, and any mutator loading a reference to an object
+ *   of the set evacuates the slice holding it through readBarrier(), so mutators only ever hold the copies;
+ * - the next global collect evacuates what is left, then its mark heals all remaining heap references through
+ *   the forwarding pointers left in the original objects; the originals are unreachable and their chunks are
+ *   swept as free memory.
+ *
+ * Each slice is evacuated by exactly one thread (the claimer) and other threads wait for it, so an original is
+ * never written once a mutator may hold a reference to its copy. A slice for which no copy space is found is
+ * pinned: its remaining objects stay in place for good.
+ *
+ * The mark bits of the last global collect are used to find the objects of the set, so the mark map must not
+ * change while the evacuation is open: concurrent mark and the scavenger are not supported.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentCompactScheme : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	/* A run of adjacent sweep chunks of one memory pool selected for evacuation */
+	struct EvacuateRange {
+		MM_MemoryPool *memoryPool; /**< pool the chunks belong to, copies are allocated from it */
+		void *base; /**< first byte of the range */
+		void *top; /**< first byte after the range */
+		uintptr_t firstSlice; /**< index in the slice table of the first slice of the range */
+	};
+
+	/* legal values of a slice table entry */
+	enum {
+		slice_unclaimed = 0, /**< no object of the slice was evacuated yet */
+		slice_busy, /**< a thread is evacuating the slice */
+		slice_evacuated, /**< all objects of the slice are forwarded to their copies */
+		slice_pinned /**< copy space ran out, some objects of the slice are not forwarded */
+	};
+
+	MM_GCExtensionsBase *_extensions;
+	MM_MarkingScheme *_markingScheme;
+	EvacuateRange _ranges[CONCURRENT_COMPACT_MAX_RANGES]; /**< the evacuation set */
+	uintptr_t _rangeCount; /**< number of valid entries in _ranges */
+	void *_evacuateBase; /**< lowest address of the evacuation set, quick filter for the read barrier */
+	void *_evacuateTop; /**< first address above the evacuation set, NULL if no evacuation is open */
+	volatile uintptr_t *_sliceTable; /**< state of every slice of the evacuation set */
+	uintptr_t _sliceCount; /**< number of slices of the evacuation set */
+	volatile uintptr_t _nextSlice; /**< next slice to be claimed by an allocation tax payer */
+	uintptr_t _selectedLiveBytes; /**< estimated live bytes of the evacuation set chosen by selectEvacuation() */
+
+	volatile uintptr_t _evacuatedObjects; /**< objects copied since the evacuation was opened */
+	volatile uintptr_t _evacuatedBytes; /**< bytes copied since the evacuation was opened */
+	volatile uintptr_t _barrierBytes; /**< part of _evacuatedBytes copied from the read barrier */
+	volatile uintptr_t _pinnedSlices; /**< slices left in place */
+	uintptr_t _finalBytes; /**< part of _evacuatedBytes copied by completeEvacuation() */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Free entries at either end of a chunk are counted by the sweep as candidates to join its neighbours, not in freeBytes.
+	 * @return all the free memory the last sweep found in the chunk
+	 */
+	MMINLINE uintptr_t getChunkFreeBytes(MM_ParallelSweepChunk *chunk)
+	{
+		return chunk->freeBytes + chunk->leadingFreeCandidateSize + chunk->trailingFreeCandidateSize;
+	}
+
+	/**
+	 * Choose the sweep chunks to evacuate, based on the free bytes found in them by the last sweep.
+	 * @param[out] liveBytes estimated live bytes of the chosen chunks
+	 * @return the number of slices in the chosen ranges, 0 if nothing is worth evacuating
+	 */
+	uintptr_t selectEvacuateRanges(MM_EnvironmentBase *env, uintptr_t *liveBytes);
+
+	/**
+	 * @return the range containing the given address, or NULL if it is not in the evacuation set
+	 */
+	EvacuateRange *findRange(void *address);
+
+	/**
+	 * @return the range containing the given slice
+	 */
+	EvacuateRange *findRangeForSlice(uintptr_t sliceIndex);
+
+	/**
+	 * Claim a slice and evacuate all marked objects starting in it.
+	 * @param fromBarrier true if the calling mutator is blocked on an object of the slice
+	 * @return the number of bytes copied, 0 if the slice was already claimed by another thread
+	 */
+	uintptr_t evacuateSlice(MM_EnvironmentBase *env, uintptr_t sliceIndex, bool fromBarrier);
+
+	/**
+	 * Get copy space for the objects of a slice.
+	 * @param[in/out] copyBase current copy space, on return the new one
+	 * @param[in/out] copyTop top of the current copy space, on return the top of the new one
+	 * @param objectSize size of the object that does not fit the current copy space
+	 * @param remainingBytes bytes of the slice left to copy, including objectSize
+	 * @return true if an object of objectSize fits the new copy space
+	 */
+	bool refreshCopySpace(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uint8_t **copyBase, uint8_t **copyTop, uintptr_t objectSize, uintptr_t remainingBytes);
+
+	/**
+	 * Slow path of the read barrier, the object is within the bounds of the evacuation set.
+	 */
+	omrobjectptr_t evacuateObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_ConcurrentCompactScheme *newInstance(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if the language provides the read barrier concurrent compaction depends on
+	 */
+	bool isSupported(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true between startEvacuation() and closeEvacuation()
+	 */
+	MMINLINE bool isEvacuating() { return NULL != _evacuateTop; }
+
+	/**
+	 * Choose the evacuation set from the chunk statistics of the sweep that just completed, so the caller can
+	 * fall back to a compaction when there is nothing to evacuate. Called with exclusive VM access.
+	 * @return true if an evacuation set was selected, and must then be opened by startEvacuation() or
+	 * dropped by cancelEvacuation()
+	 */
+	bool selectEvacuation(MM_EnvironmentBase *env);
+
+	/**
+	 * Drop the evacuation set chosen by selectEvacuation() without opening it.
+	 */
+	void cancelEvacuation(MM_EnvironmentBase *env);
+
+	/**
+	 * Open the evacuation set chosen by selectEvacuation() at the end of a global collect. Called with
+	 * exclusive VM access.
+	 * @param[out] compactStats receives the size of the evacuation set
+	 */
+	void startEvacuation(MM_EnvironmentBase *env, MM_CompactStats *compactStats);
+
+	/**
+	 * Evacuate slices of the evacuation set on behalf of an allocating mutator.
+	 * @param allocationSize the number of bytes the mutator allocated
+	 */
+	void payAllocationTax(MM_EnvironmentBase *env, uintptr_t allocationSize);
+
+	/**
+	 * Evacuate all slices not evacuated yet. Called with exclusive VM access before the mark map of the
+	 * last global collect is cleared and before the free lists are reset.
+	 */
+	void completeEvacuation(MM_EnvironmentBase *env);
+
+	/**
+	 * Forget the evacuation set once a mark has healed every reference to it, and disarm the read barrier.
+	 * @param[out] compactStats receives the evacuation totals
+	 */
+	void closeEvacuation(MM_EnvironmentBase *env, MM_CompactStats *compactStats);
+
+	/**
+	 * @return true if the object is within the bounds of the evacuation set
+	 */
+	MMINLINE bool
+	isObjectInEvacuateBounds(omrobjectptr_t objectPtr)
+	{
+		return ((void *)objectPtr >= _evacuateBase) && ((void *)objectPtr < _evacuateTop);
+	}
+
+	/**
+	 * Read barrier the language applies to every reference it loads while an evacuation is open.
+	 * @return the copy of the object if it belongs to the evacuation set (evacuating it if needed), the object otherwise
+	 */
+	MMINLINE omrobjectptr_t
+	readBarrier(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+	{
+		if (isObjectInEvacuateBounds(objectPtr)) {
+			objectPtr = evacuateObject(env, objectPtr);
+		}
+		return objectPtr;
+	}
+
+	/**
+	 * Apply the read barrier to a slot and heal it.
+	 */
+	MMINLINE void
+	fixupSlot(MM_EnvironmentBase *env, omrobjectptr_t *slotPtr)
+	{
+		omrobjectptr_t objectPtr = *slotPtr;
+		if (isObjectInEvacuateBounds(objectPtr)) {
+			*slotPtr = evacuateObject(env, objectPtr);
+		}
+	}
+
+	/**
+	 * Used by the healing mark, with exclusive VM access, once the evacuation is complete.
+	 * @return the copy of an evacuated object, or NULL if the object was not moved
+	 */
+	MMINLINE omrobjectptr_t
+	getForwardedObject(omrobjectptr_t objectPtr)
+	{
+		omrobjectptr_t forwardedPtr = NULL;
+		if (isObjectInEvacuateBounds(objectPtr)) {
+			MM_ForwardedHeader forwardedHeader(objectPtr, _extensions->compressObjectReferences());
+			forwardedPtr = forwardedHeader.getForwardedObject();
+		}
+		return forwardedPtr;
+	}
+
+	/**
+	 * Create a ConcurrentCompactScheme object.
+	 */
+	MM_ConcurrentCompactScheme(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme)
+		: MM_BaseVirtual()
+		, _extensions(env->getExtensions())
+		, _markingScheme(markingScheme)
+		, _rangeCount(0)
+		, _evacuateBase(NULL)
+		, _evacuateTop(NULL)
+		, _sliceTable(NULL)
+		, _sliceCount(0)
+		, _nextSlice(0)
+		, _selectedLiveBytes(0)
+		, _evacuatedObjects(0)
+		, _evacuatedBytes(0)
+		, _barrierBytes(0)
+		, _pinnedSlices(0)
+		, _finalBytes(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_MODRON_COMPACTION */
+#endif /* CONCURRENTCOMPACTSCHEME_HPP_ */
@@ -85,7 +85,16 @@ MM_ConfigurationStandard::initialize(MM_EnvironmentBase* env)
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 	bool result = MM_Configuration::initialize(env);
 	if (result) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+		/* An open evacuation relies on the mark map and the remembered set of the last global GC staying unchanged */
+		if (extensions->isConcurrentMarkEnabled() || extensions->isScavengerEnabled()) {
+			extensions->concurrentCompact = false;
+		}
+#endif /* OMR_GC_MODRON_COMPACTION */
 		extensions->payAllocationTax = extensions->isConcurrentMarkEnabled() || extensions->isConcurrentSweepEnabled();
+#if defined(OMR_GC_MODRON_COMPACTION)
+		extensions->payAllocationTax = extensions->payAllocationTax || extensions->concurrentCompact;
+#endif /* OMR_GC_MODRON_COMPACTION */
 		extensions->setStandardGC(true);
 	}
 
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(COPYSCANCACHEDEQUE_HPP_)
+#define COPYSCANCACHEDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+
+class MM_CopyScanCacheStandard;
+
+/* Capacity of a scan cache deque, must be a power of 2. Pushes to a full deque fall back to the shared scan list. */
+#define OMR_SCAVENGER_SCAN_CACHE_DEQUE_SIZE 256
+
+/**
+ * Fixed capacity work-stealing deque (Chase-Lev) of scan caches.
+ * The owning GC thread pushes and pops at the bottom without atomic read-modify-write operations,
+ * other GC threads steal from the top with a compare-and-swap. Only the final entry is contended
+ * between the owner and thieves.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_CopyScanCacheDeque
+{
+	/*
+	 * Data members
+	 */
+private:
+	volatile uintptr_t _top; /**< index of the next entry to be stolen, advanced only by compare-and-swap */
+	volatile uintptr_t _bottom; /**< index of the next entry to be pushed, written only by the owner */
+	MM_CopyScanCacheStandard * volatile _entries[OMR_SCAVENGER_SCAN_CACHE_DEQUE_SIZE];
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * Push a cache onto the bottom of the deque. Must only be called by the owning thread.
+	 * @param cache[in] the cache to push
+	 * @return false if the deque is full
+	 */
+	MMINLINE bool
+	push(MM_CopyScanCacheStandard *cache)
+	{
+		uintptr_t bottom = _bottom;
+		if ((bottom - _top) >= OMR_SCAVENGER_SCAN_CACHE_DEQUE_SIZE) {
+			return false;
+		}
+		_entries[bottom & (OMR_SCAVENGER_SCAN_CACHE_DEQUE_SIZE - 1)] = cache;
+		/* the entry must be visible before a thief can observe the new bottom */
+		MM_AtomicOperations::storeSync();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the most recently pushed cache from the bottom of the deque. Must only be called by the owning thread.
+	 * @return the cache, or NULL if the deque is empty
+	 */
+	MMINLINE MM_CopyScanCacheStandard *
+	pop()
+	{
+		uintptr_t bottom = _bottom;
+		if (bottom == _top) {
+			return NULL;
+		}
+		bottom -= 1;
+		_bottom = bottom;
+		/* publish the reservation of the bottom entry before checking for competing thieves */
+		MM_AtomicOperations::sync();
+		uintptr_t top = _top;
+		MM_CopyScanCacheStandard *cache = NULL;
+		if (top <= bottom) {
+			cache = _entries[bottom & (OMR_SCAVENGER_SCAN_CACHE_DEQUE_SIZE - 1)];
+			if (top == bottom) {
+				/* last entry - race any thief for it */
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					cache = NULL;
+				}
+				_bottom = top + 1;
+			}
+		} else {
+			/* thieves emptied the deque */
+			_bottom = top;
+		}
+		return cache;
+	}
+
+	/**
+	 * Steal the least recently pushed cache from the top of the deque. May be called by any thread.
+	 * @return the cache, or NULL if the deque is empty or the steal lost a race
+	 */
+	MMINLINE MM_CopyScanCacheStandard *
+	steal()
+	{
+		uintptr_t top = _top;
+		MM_AtomicOperations::sync();
+		uintptr_t bottom = _bottom;
+		MM_CopyScanCacheStandard *cache = NULL;
+		if (top < bottom) {
+			cache = _entries[top & (OMR_SCAVENGER_SCAN_CACHE_DEQUE_SIZE - 1)];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				cache = NULL;
+			}
+		}
+		return cache;
+	}
+
+	/**
+	 * Racy check for entries, suitable for deciding whether to attempt a steal or to wait for work.
+	 * @return true if the deque appears to contain no entries
+	 */
+	MMINLINE bool
+	isEmpty()
+	{
+		return (_top >= _bottom);
+	}
+
+	/**
+	 * Racy count of entries, suitable for heuristics only.
+	 * @return approximate number of entries in the deque
+	 */
+	MMINLINE uintptr_t
+	getApproximateSize()
+	{
+		uintptr_t top = _top;
+		uintptr_t bottom = _bottom;
+		return (bottom > top) ? (bottom - top) : 0;
+	}
+
+	/**
+	 * Reset the deque. Must only be called when no other thread can access it.
+	 */
+	MMINLINE void
+	clear()
+	{
+		_top = 0;
+		_bottom = 0;
+	}
+
+	/**
+	 * Create a CopyScanCacheDeque object.
+	 */
+	MM_CopyScanCacheDeque()
+		: _top(0)
+		, _bottom(0)
+	{
+	}
+};
+
+#endif /* COPYSCANCACHEDEQUE_HPP_ */
@@ -41,8 +41,8 @@ MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *ca
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 	
-	_sublistCount = extensions->cacheListSplit;
-	Assert_MM_true(0 < _sublistCount);
+	Assert_MM_true(0 < extensions->cacheListSplit);
+	_sublistCount = _layout.initialize(env, extensions->cacheListSplit);
 
 	_sublists = (CopyScanCacheSublist *)extensions->getForge()->allocate(
 			sizeof(CopyScanCacheSublist) * _sublistCount,
@@ -71,8 +71,9 @@ MM_CopyScanCacheList::reinitializeForRestore(MM_EnvironmentBase *env)
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 
-	uintptr_t newSublistCount = extensions->cacheListSplit;
-	Assert_MM_true(0 < newSublistCount);
+	Assert_MM_true(0 < extensions->cacheListSplit);
+	MM_NUMASublistLayout newLayout;
+	uintptr_t newSublistCount = newLayout.initialize(env, extensions->cacheListSplit);
 
 	if (newSublistCount > _sublistCount) {
 		CopyScanCacheSublist *newSublists = (CopyScanCacheSublist *)extensions->getForge()->allocate(
@@ -98,6 +99,7 @@ MM_CopyScanCacheList::reinitializeForRestore(MM_EnvironmentBase *env)
 				extensions->getForge()->free(_sublists);
 				_sublists = newSublists;
 				_sublistCount = newSublistCount;
+				_layout = newLayout;
 			}
 		}
 	}
@@ -364,11 +366,10 @@ MM_CopyScanCacheList::pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandar
 MM_CopyScanCacheStandard *
 MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 {
-	uintptr_t index = getSublistIndex(env);
 	MM_CopyScanCacheStandard *cache = NULL;
 
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
-		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[index];
+		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[getSublistIndex(env, i)];
 
 		if (NULL != list->_cacheHead) {
 			env->_scavengerStats._acquireListLockCount += 1;
@@ -385,11 +386,12 @@ MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 			list->_cacheLock.release();
 
 			if (NULL != cache) {
+				if (_layout.isRemoteStep(i)) {
+					env->_scavengerStats._numaRemoteCacheCount += 1;
+				}
 				break;
 			}
 		}
-
-		index = (index + 1) % _sublistCount;
 	}
 
 	return cache;
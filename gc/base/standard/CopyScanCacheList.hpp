@@ -36,6 +36,7 @@
 #include "EnvironmentStandard.hpp" 
 #include "LightweightNonReentrantLock.hpp"
 #include "ModronAssertions.h"
+#include "NUMASublistLayout.hpp"
 
 class MM_Collector;
 class MM_CopyScanCacheStandard;
@@ -75,6 +76,7 @@ private:
 	
 	CopyScanCacheSublist *_sublists;	/**< An array of CopyScanCacheSublist structures which is _sublistCount elements long */
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
+	MM_NUMASublistLayout _layout; /**< maps threads onto the sublists, grouping them by NUMA node when GC threads are NUMA-aware */
 	
 	MM_CopyScanCacheChunk *_chunkHead; 
 	uintptr_t _incrementEntryCount;
@@ -96,12 +98,13 @@ private:
 	 * it should use
 	 * 
 	 * @param env the current environment
+	 * @param step the number of sublists already visited by the current search
 	 * 
 	 * @return an index into the _sublists array
 	 */
-	uintptr_t getSublistIndex(MM_EnvironmentBase *env)
+	uintptr_t getSublistIndex(MM_EnvironmentBase *env, uintptr_t step = 0)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		return _layout.getSublistIndex(env, step);
 	}
 	
 	/**
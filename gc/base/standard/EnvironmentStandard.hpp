@@ -33,6 +33,9 @@
 #include "omrport.h"
 #include "modronopt.h"
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#include "CopyScanCacheDeque.hpp"
+#endif /* OMR_GC_MODRON_SCAVENGER */
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "SublistFragment.hpp"
@@ -60,6 +63,8 @@ public:
 	
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	J9VMGC_SublistFragment _scavengerRememberedSet;
+	MM_CopyScanCacheDeque _scanCacheDeque; /**< scan caches queued by this thread when scavenger work stealing is enabled, stolen from by other GC threads */
+	bool _scanCacheDequeActive; /**< true while _scanCacheDeque is registered with the scavenger for the current cycle */
 #endif
 	void *_tenureTLHRemainderBase;  /**< base and top pointers of the last unused tenure TLH copy cache, that might be reused  on next copy refresh */
 	void *_tenureTLHRemainderTop;
@@ -93,6 +98,10 @@ public:
 		,_inactiveDeferredCopyCache(NULL)
 		,_inactiveTenureCopyScanCache(NULL)
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		,_scanCacheDeque()
+		,_scanCacheDequeActive(false)
+#endif /* OMR_GC_MODRON_SCAVENGER */
 		,_tenureTLHRemainderBase(NULL)
 		,_tenureTLHRemainderTop(NULL)
 		,_loaAllocation(false)
@@ -34,6 +34,7 @@
 #include "CollectorLanguageInterface.hpp"
 #if defined(OMR_GC_MODRON_COMPACTION)
 #include "CompactScheme.hpp"
+#include "ConcurrentCompactScheme.hpp"
 #endif /* OMR_GC_MODRON_COMPACTION */
 #include "Configuration.hpp"
 #include "CycleState.hpp"
@@ -311,6 +312,14 @@ MM_ParallelGlobalGC::initialize(MM_EnvironmentBase *env)
 	if(NULL == _compactScheme) {
 		goto error_no_memory;
 	}
+
+	if (_extensions->concurrentCompact) {
+		_concurrentCompactScheme = MM_ConcurrentCompactScheme::newInstance(env, _markingScheme);
+		if (NULL == _concurrentCompactScheme) {
+			goto error_no_memory;
+		}
+		_extensions->concurrentCompactScheme = _concurrentCompactScheme;
+	}
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
 	_heapWalker = MM_ParallelHeapWalker::newInstance(this, _markingScheme->getMarkMap(), env);
@@ -376,6 +385,12 @@ MM_ParallelGlobalGC::tearDown(MM_EnvironmentBase *env)
 		_compactScheme->kill(env);
 		_compactScheme = NULL;
 	}
+
+	if (NULL != _concurrentCompactScheme) {
+		_extensions->concurrentCompactScheme = NULL;
+		_concurrentCompactScheme->kill(env);
+		_concurrentCompactScheme = NULL;
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	if (NULL != _heapWalker) {
@@ -444,6 +459,11 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 	uintptr_t regionSize = _extensions->regionSize;
 	Assert_MM_true((0 != regionSize) && (0 == (heapBase % regionSize)));
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/* Copies of the objects still to evacuate are allocated from the free lists, before they are reset */
+	bool evacuationCompleted = completeConcurrentEvacuation(env);
+#endif /* OMR_GC_MODRON_COMPACTION */
+
 	/* Reset memory pools of associated memory spaces */
 	_extensions->heap->resetSpacesForGarbageCollect(env);
 	
@@ -452,6 +472,11 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 	_compactThisCycle = false;
+	_evacuateThisCycle = false;
+	if (evacuationCompleted) {
+		/* Heal every reference to the evacuated objects while marking, the originals are then swept */
+		_markingScheme->setConcurrentCompactFixupScheme(_concurrentCompactScheme);
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	_fixHeapForWalkCompleted = false;
@@ -465,12 +490,22 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 	/* Mark */	
 	markAll(env, initMarkMap);
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+	if (evacuationCompleted) {
+		_markingScheme->setConcurrentCompactFixupScheme(NULL);
+		_concurrentCompactScheme->closeEvacuation(env, &_extensions->globalGCStats.compactStats);
+	}
+#endif /* OMR_GC_MODRON_COMPACTION */
+
 	_delegate.postMarkProcessing(env);
 	
 	sweep(env, allocDescription, rebuildMarkBits);
 
 
 #if defined(OMR_GC_MODRON_COMPACTION)
+	/* The compact stanza of this cycle, if any, also carries the totals of an evacuation closed by its mark */
+	bool compactReported = false;
+
 	/* If a compaction was required, then do one */
 	if (_compactThisCycle) {
 		_collectionStatistics._tenureFragmentation = MICRO_FRAGMENTATION;
@@ -479,6 +514,7 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 		}
 
 		mainThreadCompact(env, allocDescription, rebuildMarkBits);
+		compactReported = true;
 		_collectionStatistics._tenureFragmentation = NO_FRAGMENTATION;
 		if (_extensions->processLargeAllocateStats) {
 			processLargeAllocateStatsAfterCompact(env);
@@ -493,6 +529,7 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 			compactStats->_startTime = 0;
 			compactStats->_endTime = 0;
 			reportCompactEnd(env);
+			compactReported = true;
 		}
 		_collectionStatistics._tenureFragmentation = MICRO_FRAGMENTATION;
 		if (GLOBALGC_ESTIMATE_FRAGMENTATION == (_extensions->estimateFragmentation & GLOBALGC_ESTIMATE_FRAGMENTATION)) {
@@ -543,6 +580,27 @@ MM_ParallelGlobalGC::mainThreadGarbageCollect(MM_EnvironmentBase *env, MM_Alloca
 	_extensions->oldHeapSizeOnLastGlobalGC = _extensions->heap->getActiveMemorySize(MEMORY_TYPE_OLD);
 	_extensions->freeOldHeapSizeOnLastGlobalGC = _extensions->heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD);
 #endif /* OMR_GC_MODRON_SCAVENGER */
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/* Open the evacuation chosen in place of a compaction, and report it along with the one closed by this
+	 * cycle unless a compact stanza was already reported for this cycle
+	 */
+	if ((evacuationCompleted && !compactReported) || _evacuateThisCycle) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		MM_CompactStats *compactStats = &_extensions->globalGCStats.compactStats;
+		if (!compactReported) {
+			reportCompactStart(env);
+			compactStats->_startTime = omrtime_hires_clock();
+		}
+		if (_evacuateThisCycle) {
+			_concurrentCompactScheme->startEvacuation(env, compactStats);
+		}
+		if (!compactReported) {
+			compactStats->_endTime = omrtime_hires_clock();
+			reportCompactEnd(env);
+		}
+	}
+#endif /* OMR_GC_MODRON_COMPACTION */
 	
 	/* Restart the allocation caches associated to all threads */
 	mainThreadRestartAllocationCaches(env);
@@ -662,6 +720,12 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		compactReason = COMPACT_AGGRESSIVE;
 		goto compactionReqd;
 	}
+
+	/* Let tests exercise the compaction modes reserved for fragmentation */
+	if (_extensions->fvtest_forceFragmentationCompact) {
+		compactReason = COMPACT_FRAGMENTED;
+		goto compactionReqd;
+	}
 	
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)	
 
@@ -725,7 +789,10 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t totalSize = memorySubSpace->getActiveMemorySize();
 		MM_MemoryPool *memoryPool= memorySubSpace->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+		if (!_extensions->concurrentSweep)
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+		{
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -877,6 +944,13 @@ MM_ParallelGlobalGC::sweep(MM_EnvironmentBase *env, MM_AllocateDescription *allo
 #if defined(OMR_GC_MODRON_COMPACTION)
 	/* Decide is a compaction is required - this decision must be made after we sweep since we use the largestFreeEntrySize, as changed by sweep, to determine if a compaction should be done */
 	_compactThisCycle = shouldCompactThisCycle(env, allocDescription, activeSubSpace->maxExpansionInSpace(env), env->_cycleState->_gcCode);
+	if (_compactThisCycle && shouldEvacuateInsteadOfCompact(env)) {
+		/* Only give up the compaction if there is something to evacuate in its place */
+		if (_concurrentCompactScheme->selectEvacuation(env)) {
+			_compactThisCycle = false;
+			_evacuateThisCycle = true;
+		}
+	}
 
 	if (!_compactThisCycle)  
 #endif /* OMR_GC_MODRON_COMPACTION */		
@@ -906,6 +980,11 @@ MM_ParallelGlobalGC::sweep(MM_EnvironmentBase *env, MM_AllocateDescription *allo
 #if defined(OMR_GC_MODRON_COMPACTION)
 	if (0 != activeSubSpace->getContractionSize()) {
 		_compactThisCycle = compactRequiredBeforeHeapContraction(env, allocDescription, activeSubSpace->getContractionSize());
+		if (_compactThisCycle && _evacuateThisCycle) {
+			/* The compaction moves the objects the evacuation set was chosen for */
+			_concurrentCompactScheme->cancelEvacuation(env);
+			_evacuateThisCycle = false;
+		}
 	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 
@@ -913,6 +992,47 @@ MM_ParallelGlobalGC::sweep(MM_EnvironmentBase *env, MM_AllocateDescription *allo
 	reportSweepEnd(env);
 }
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+bool
+MM_ParallelGlobalGC::shouldEvacuateInsteadOfCompact(MM_EnvironmentBase *env)
+{
+	bool evacuate = false;
+	if ((NULL != _concurrentCompactScheme) && !env->_cycleState->_gcCode.shouldAggressivelyCompact()) {
+		switch (_extensions->globalGCStats.compactStats._compactReason) {
+		case COMPACT_FRAGMENTED:
+		case COMPACT_MICRO_FRAG:
+		case COMPACT_PAGE:
+			evacuate = _concurrentCompactScheme->isSupported(env);
+			break;
+		default:
+			break;
+		}
+	}
+	return evacuate;
+}
+
+bool
+MM_ParallelGlobalGC::completeConcurrentEvacuation(MM_EnvironmentBase *env)
+{
+	bool evacuationCompleted = false;
+	if ((NULL != _concurrentCompactScheme) && _concurrentCompactScheme->isEvacuating()) {
+		_concurrentCompactScheme->completeEvacuation(env);
+		evacuationCompleted = true;
+	}
+	return evacuationCompleted;
+}
+
+#if defined(OMR_GC_ALLOCATION_TAX)
+void
+MM_ParallelGlobalGC::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription)
+{
+	if (NULL != _concurrentCompactScheme) {
+		_concurrentCompactScheme->payAllocationTax(env, allocDescription->getAllocationTaxSize());
+	}
+}
+#endif /* OMR_GC_ALLOCATION_TAX */
+#endif /* OMR_GC_MODRON_COMPACTION */
+
 bool
 MM_ParallelGlobalGC::completeFreelistRebuildRequired(MM_EnvironmentBase *env, SweepCompletionReason *reason)
 {
@@ -997,6 +1117,7 @@ MM_ParallelGlobalGC::mainThreadCompact(MM_EnvironmentBase *env, MM_AllocateDescr
 	MM_ParallelCompactTask compactTask(env, _dispatcher, _compactScheme, rebuildMarkBits, env->_cycleState->_gcCode.shouldAggressivelyCompact());
 	_dispatcher->run(env, &compactTask);
 	compactStats->_endTime = omrtime_hires_clock();
+	_compactScheme->updatePartialCompactEstimates(env, compactStats);
 	reportCompactEnd(env);
 	
 	/* Remember the gc count of the last compaction */ 
@@ -1251,6 +1372,14 @@ MM_ParallelGlobalGC::prepareHeapForWalk(MM_EnvironmentBase *env)
 {
 	GC_OMRVMInterface::flushCachesForGC(env);
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/* The mark below replaces the mark map an open evacuation depends on, close the evacuation first */
+	bool evacuationCompleted = completeConcurrentEvacuation(env);
+	if (evacuationCompleted) {
+		_markingScheme->setConcurrentCompactFixupScheme(_concurrentCompactScheme);
+	}
+#endif /* OMR_GC_MODRON_COMPACTION */
+
 	_markingScheme->mainSetupForWalk(env);
 	
 	/* Run a parallel mark */
@@ -1258,6 +1387,13 @@ MM_ParallelGlobalGC::prepareHeapForWalk(MM_EnvironmentBase *env)
 	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, true, NULL);
 	_dispatcher->run(env, &markTask);
 
+#if defined(OMR_GC_MODRON_COMPACTION)
+	if (evacuationCompleted) {
+		_markingScheme->setConcurrentCompactFixupScheme(NULL);
+		_concurrentCompactScheme->closeEvacuation(env, &_extensions->globalGCStats.compactStats);
+	}
+#endif /* OMR_GC_MODRON_COMPACTION */
+
 	_delegate.prepareHeapForWalk(env);
 }
 
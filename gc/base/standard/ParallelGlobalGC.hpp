@@ -49,6 +49,7 @@ void healReferenceSlots(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *regi
 
 class MM_CollectionStatisticsStandard;
 class MM_CompactScheme;
+class MM_ConcurrentCompactScheme;
 class MM_ParallelDispatcher;
 class MM_MarkingScheme;
 class MM_MemorySubSpace;
@@ -70,6 +71,8 @@ private:
 #if defined(OMR_GC_MODRON_COMPACTION)
 	MM_CompactScheme *_compactScheme;
 	bool _compactThisCycle;		/**< keep a decision should compact run this cycle */
+	MM_ConcurrentCompactScheme *_concurrentCompactScheme; /**< incremental evacuation replacing fragmentation driven compactions, NULL unless concurrentCompact is set */
+	bool _evacuateThisCycle; /**< keep a decision should an evacuation be opened at the end of this cycle */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 protected:
@@ -169,6 +172,20 @@ private:
 	 *	@param rebuildMarkBits rebuild of mark bits required
 	 */
 	void mainThreadCompact(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool rebuildMarkBits);
+
+	/**
+	 * Decide whether the compaction chosen by the sweep is replaced by a concurrent compaction evacuation.
+	 * Only compactions triggered by fragmentation are, the others need the whole heap to be slid.
+	 * @return true if an evacuation is to be opened at the end of the cycle
+	 */
+	bool shouldEvacuateInsteadOfCompact(MM_EnvironmentBase *env);
+
+	/**
+	 * Evacuate what is left of an open concurrent compaction evacuation, before the mark map it depends on
+	 * is cleared and the free lists are reset.
+	 * @return true if an evacuation was open, the following mark must heal references to it
+	 */
+	bool completeConcurrentEvacuation(MM_EnvironmentBase *env);
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	void mainThreadRestartAllocationCaches(MM_EnvironmentBase *env);
@@ -323,6 +340,15 @@ public:
 	getCompactScheme(MM_EnvironmentBase *env) {
 		return _compactScheme;
 	}
+
+	MM_ConcurrentCompactScheme *
+	getConcurrentCompactScheme(MM_EnvironmentBase *env) {
+		return _concurrentCompactScheme;
+	}
+
+#if defined(OMR_GC_ALLOCATION_TAX)
+	virtual void payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription);
+#endif /* OMR_GC_ALLOCATION_TAX */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	virtual void completeExternalConcurrentCycle(MM_EnvironmentBase *env);
@@ -345,6 +371,8 @@ public:
 #if defined(OMR_GC_MODRON_COMPACTION)
 		, _compactScheme(NULL)
 		, _compactThisCycle(false)
+		, _concurrentCompactScheme(NULL)
+		, _evacuateThisCycle(false)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
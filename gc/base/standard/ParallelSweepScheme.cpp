@@ -45,6 +45,7 @@
 #include "SweepHeapSectioningSegmented.hpp"
 #include "SweepPoolManagerAddressOrderedList.hpp"
 #include "SweepPoolState.hpp"
+#include "HeapMapScanner.hpp"
 #include "MarkMap.hpp"
 #include "ModronAssertions.h"
 #include "HeapMapWordIterator.hpp"
@@ -341,14 +342,8 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		/* Skip the rest of the free run in bulk */
+		markMapCurrent = MM_HeapMapScanner::findNonEmptySlot(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
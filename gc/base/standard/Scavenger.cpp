@@ -244,6 +244,9 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 	}
 
 
+	/* slots fetched ahead for prefetching are held in a fixed size ring */
+	_extensions->scavengerPrefetchDistance = OMR_MIN(_extensions->scavengerPrefetchDistance, MAXIMUM_SCAVENGER_PREFETCH_DISTANCE);
+
 	/* No thread can use more than _cachesPerThread cache entries at 1 time (flip, tenure, scan, large, possibly deferred)
 	 * So long as (N * _cachesPerThread) cache entries exist,the head of the scan list
 	 * will contain a valid entry. We set the appropriate number of caches per thread here */
@@ -307,6 +310,12 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
+	if (NULL != _scanCacheDeques) {
+		env->getForge()->free((void *)_scanCacheDeques);
+		_scanCacheDeques = NULL;
+		_scanCacheDequeCount = 0;
+	}
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -399,6 +408,23 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 
 	restoreMainThreadTenureTLHRemainders(env);
 
+	if (_extensions->scavengerWorkStealing && !IS_CONCURRENT_ENABLED) {
+		/* the deque table is indexed by worker ID, so grow it if the GC thread pool has been expanded */
+		uintptr_t threadCountMaximum = _dispatcher->threadCountMaximum();
+		if (_scanCacheDequeCount < threadCountMaximum) {
+			if (NULL != _scanCacheDeques) {
+				env->getForge()->free((void *)_scanCacheDeques);
+				_scanCacheDequeCount = 0;
+			}
+			_scanCacheDeques = (MM_CopyScanCacheDeque * volatile *)env->getForge()->allocate(threadCountMaximum * sizeof(MM_CopyScanCacheDeque *), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			if (NULL != _scanCacheDeques) {
+				/* on failure work stealing is simply not used, all scan caches go to the scan list */
+				memset((void *)_scanCacheDeques, 0, threadCountMaximum * sizeof(MM_CopyScanCacheDeque *));
+				_scanCacheDequeCount = threadCountMaximum;
+			}
+		}
+	}
+
 	/* Reinitialize the copy scan caches */
 	Assert_MM_true(_scavengeCacheFreeList.areAllCachesReturned());
 	Assert_MM_true(0 == _cachedEntryCount);
@@ -856,6 +882,14 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 		finalGCStats->_copy_cachesize_counts[i] += scavStats->_copy_cachesize_counts[i];
 	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
+	finalGCStats->_slotPrefetchCount += scavStats->_slotPrefetchCount;
+	finalGCStats->_slotPrefetchScanCount += scavStats->_slotPrefetchScanCount;
+	finalGCStats->_scanCacheDequePushCount += scavStats->_scanCacheDequePushCount;
+	finalGCStats->_scanCacheDequeOverflowCount += scavStats->_scanCacheDequeOverflowCount;
+	finalGCStats->_scanCacheStealCount += scavStats->_scanCacheStealCount;
+	finalGCStats->_scanCacheStealFailedCount += scavStats->_scanCacheStealFailedCount;
+	finalGCStats->_numaRemoteCacheCount += scavStats->_numaRemoteCacheCount;
+	finalGCStats->_numaNodeStats.merge(&scavStats->_numaNodeStats);
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
 	finalGCStats->_completeStallTime += scavStats->_completeStallTime;
@@ -885,6 +919,9 @@ MM_Scavenger::mergeThreadGCStats(MM_EnvironmentBase *env)
 	/* This thread is just about to complete the scavenge task, record the timestamp.
 	 * This must be done before mergeGCStatsBase or else the timestamp won't be mereged as needed by adaptive threading. */
 	env->_scavengerStats._endTime = omrtime_hires_clock();
+	if (_extensions->numaAwareGCThreads) {
+		scavStats->_numaNodeStats.recordThread(env->getNumaNodeIndex(), scavStats->_flipBytes + scavStats->_tenureAggregateBytes, scavStats->_numaRemoteCacheCount);
+	}
 	mergeGCStatsBase(env, &_extensions->incrementScavengerStats, scavStats);
 
 	/* Merge language specific statistics. No known interesting data per increment - they are merged directly to aggregate cycle stats */
@@ -1068,6 +1105,9 @@ MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 	}
 
 	env->approxScanCacheCount = _scavengeCacheScanList.getApproximateEntryCount();
+	if ((NULL != _scanCacheDeques) && (env->approxScanCacheCount < threadCount)) {
+		env->approxScanCacheCount += getApproximateScanCacheDequeEntryCount();
+	}
 	if (env->approxScanCacheCount < threadCount) {
 		uintptr_t cacheSizeBasedOnScanCacheCount = calculateCopyScanCacheSizeForQueueLength(maxCacheSize, threadCount, env->approxScanCacheCount);
 		cacheSize = OMR_MIN(cacheSizeBasedOnScanCacheCount, cacheSize);
@@ -1994,6 +2034,27 @@ MM_Scavenger::flushCopyScanCounts(MM_EnvironmentBase* env, bool majorFlush)
 	}
 }
 
+MMINLINE bool
+MM_Scavenger::fillSlotPrefetchRing(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, SlotPrefetchRing *ring)
+{
+	uintptr_t prefetchDistance = _extensions->scavengerPrefetchDistance;
+	while (ring->count < prefetchDistance) {
+		GC_SlotObject *slotObject = objectScanner->getNextSlot();
+		if (NULL == slotObject) {
+			return false;
+		}
+		/* the slot is re-read when it is popped, so a stale referent here only costs a useless prefetch */
+		omrobjectptr_t objectPtr = slotObject->readReferenceFromSlot();
+		if (isObjectInEvacuateMemory(objectPtr)) {
+			prefetchForwardedHeader(objectPtr);
+			env->_scavengerStats._slotPrefetchCount += 1;
+		}
+		ring->slots[(ring->head + ring->count) % MAXIMUM_SCAVENGER_PREFETCH_DISTANCE] = slotObject->readAddressFromSlot();
+		ring->count += 1;
+	}
+	return true;
+}
+
 MMINLINE bool
 MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *scanCache, omrobjectptr_t objectPtr, uintptr_t flags, omrobjectptr_t *rememberedSetSlot)
 {
@@ -2040,13 +2101,36 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	GC_SlotObject *slotObject = NULL;
 
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
-		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
-		shouldRemember |= isSlotObjectInNewSpace;
-		if (NULL != *copyCache) {
-			slotsCopied += 1;
+	if (0 == _extensions->scavengerPrefetchDistance) {
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+			shouldRemember |= isSlotObjectInNewSpace;
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
+			slotsScanned += 1;
 		}
-		slotsScanned += 1;
+	} else {
+		/* run the object scanner ahead of copyAndForward() so that referent headers are in cache when they are needed */
+		SlotPrefetchRing ring;
+		ring.head = 0;
+		ring.count = 0;
+		bool moreSlots = true;
+		do {
+			if (moreSlots) {
+				moreSlots = fillSlotPrefetchRing(env, objectScanner, &ring);
+			}
+			if (0 < ring.count) {
+				GC_SlotObject ringSlotObject(env->getOmrVM(), popSlotPrefetchRing(&ring));
+				bool isSlotObjectInNewSpace = copyAndForward(env, &ringSlotObject);
+				shouldRemember |= isSlotObjectInNewSpace;
+				if (NULL != *copyCache) {
+					slotsCopied += 1;
+				}
+				slotsScanned += 1;
+			}
+		} while (moreSlots || (0 < ring.count));
+		env->_scavengerStats._slotPrefetchScanCount += slotsScanned;
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
 
@@ -2174,24 +2258,74 @@ MM_Scavenger::incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobj
 	uint64_t slotsCopied = 0;
 	uint64_t slotsScanned = 0;
 
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
-		/* If the object should be remembered and it is in old space, remember it */
-		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
-		scanCache->_shouldBeRemembered |= isSlotObjectInNewSpace;
-		slotsScanned += 1;
+	if (0 == _extensions->scavengerPrefetchDistance) {
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			/* If the object should be remembered and it is in old space, remember it */
+			bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+			scanCache->_shouldBeRemembered |= isSlotObjectInNewSpace;
+			slotsScanned += 1;
 
-		MM_CopyScanCacheStandard *copyCache = env->_effectiveCopyScanCache;
-		if (NULL != copyCache) {
-			/* Copy cache will be set only if a referent object is copied (ie, if not previously forwarded) */
-			slotsCopied += 1;
-
-			MM_CopyScanCacheStandard *nextScanCache = aliasToCopyCache(env, slotObject, scanCache, copyCache);
-			if (NULL != nextScanCache) {
-				/* alias and switch to nextScanCache if it was selected */
-				updateCopyScanCounts(env, slotsScanned, slotsCopied);
-				return nextScanCache;
+			MM_CopyScanCacheStandard *copyCache = env->_effectiveCopyScanCache;
+			if (NULL != copyCache) {
+				/* Copy cache will be set only if a referent object is copied (ie, if not previously forwarded) */
+				slotsCopied += 1;
+
+				MM_CopyScanCacheStandard *nextScanCache = aliasToCopyCache(env, slotObject, scanCache, copyCache);
+				if (NULL != nextScanCache) {
+					/* alias and switch to nextScanCache if it was selected */
+					updateCopyScanCounts(env, slotsScanned, slotsCopied);
+					return nextScanCache;
+				}
 			}
 		}
+	} else {
+		/* run the object scanner ahead of copyAndForward() so that referent headers are in cache when they are needed */
+		SlotPrefetchRing ring;
+		ring.head = 0;
+		ring.count = 0;
+		bool moreSlots = true;
+		do {
+			if (moreSlots) {
+				moreSlots = fillSlotPrefetchRing(env, objectScanner, &ring);
+			}
+			if (0 < ring.count) {
+				GC_SlotObject ringSlotObject(env->getOmrVM(), popSlotPrefetchRing(&ring));
+				bool isSlotObjectInNewSpace = copyAndForward(env, &ringSlotObject);
+				scanCache->_shouldBeRemembered |= isSlotObjectInNewSpace;
+				slotsScanned += 1;
+
+				MM_CopyScanCacheStandard *copyCache = env->_effectiveCopyScanCache;
+				if (NULL != copyCache) {
+					slotsCopied += 1;
+
+					MM_CopyScanCacheStandard *nextScanCache = aliasToCopyCache(env, &ringSlotObject, scanCache, copyCache);
+					if (NULL != nextScanCache) {
+						/* Slots in the ring have already been taken from the object scanner and cannot be resumed
+						 * later, so they must be completed before switching caches. If that copies anything the
+						 * selected copy cache may have been retired, so only switch if it is still active.
+						 */
+						uint64_t slotsCopiedBeforeDrain = slotsCopied;
+						while (0 < ring.count) {
+							GC_SlotObject drainSlotObject(env->getOmrVM(), popSlotPrefetchRing(&ring));
+							scanCache->_shouldBeRemembered |= copyAndForward(env, &drainSlotObject);
+							slotsScanned += 1;
+							if (NULL != env->_effectiveCopyScanCache) {
+								slotsCopied += 1;
+							}
+						}
+						if ((slotsCopied == slotsCopiedBeforeDrain) || (nextScanCache == env->_survivorCopyScanCache) || (nextScanCache == env->_tenureCopyScanCache)) {
+							env->_scavengerStats._slotPrefetchScanCount += slotsScanned;
+							updateCopyScanCounts(env, slotsScanned, slotsCopied);
+							return nextScanCache;
+						}
+						/* selected copy cache was retired while draining -- abandon aliasing and finish scanning this object */
+						scanCache->_hasPartiallyScannedObject = false;
+						moreSlots = true;
+					}
+				}
+			}
+		} while (moreSlots || (0 < ring.count));
+		env->_scavengerStats._slotPrefetchScanCount += slotsScanned;
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
 
@@ -2340,17 +2474,31 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 		return cache;
 	}
 
+	if (env->_scanCacheDequeActive) {
+		/* most recently pushed work of this thread is the most likely to still be in cache */
+		cache = env->_scanCacheDeque.pop();
+		if (NULL != cache) {
+			return cache;
+		}
+	}
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	env->_scavengerStats._acquireScanListCount += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
- 	while (!doneFlag && !shouldAbortScanLoop(env)) {
- 		while (_cachedEntryCount > 0) {
- 			cache = getNextScanCacheFromList(env);
+	while (!doneFlag && !shouldAbortScanLoop(env)) {
+		while (isScanWorkQueued()) {
+			cache = NULL;
+			if (_cachedEntryCount > 0) {
+				cache = getNextScanCacheFromList(env);
+			}
+			if ((NULL == cache) && (NULL != _scanCacheDeques)) {
+				cache = stealScanCache(env);
+			}
 
 			if (NULL != cache) {
  				/* Check if there are threads waiting that should be notified because of pending entries */
- 				if((_cachedEntryCount > 0) && _waitingCount) {
+ 				if(_waitingCount && isScanWorkQueued()) {
 					if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
 						if(0 != _waitingCount) {
 							omrthread_monitor_notify(_scanCacheMonitor);
@@ -2371,7 +2519,7 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 		_waitingCount += 1;
 
 		if(doneIndex == _doneIndex) {
-			if((env->_currentTask->getThreadCount() == _waitingCount) && (0 == _cachedEntryCount)) {
+			if((env->_currentTask->getThreadCount() == _waitingCount) && !isScanWorkQueued()) {
 				flushBuffersForGetNextScanCache(env, true);
 
 				if (shouldDoFinalNotify(env)) {
@@ -2382,7 +2530,7 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 					env->_scavengerStats.addToNotifyStallTime(notifyStartTime, omrtime_hires_clock());
 				}
 			} else {
-				while((0 == _cachedEntryCount) && (doneIndex == _doneIndex) && !shouldAbortScanLoop(env)) {
+				while(!isScanWorkQueued() && (doneIndex == _doneIndex) && !shouldAbortScanLoop(env)) {
 					flushBuffersForGetNextScanCache(env);
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 					uint64_t waitEndTime, waitStartTime;
@@ -2594,6 +2742,7 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 
 	/* GC init (set up per-invocation values) */
 	workerSetupForGC(env);
+	activateScanCacheDeque(env);
 
 	/*
 	 * There is a hidden assumption that RS Overflow flag would not be changed between beginning of scavenge and this point,
@@ -2646,6 +2795,8 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 		rootScanner.pruneRememberedSet(env);
 	}
 
+	deactivateScanCacheDeque(env);
+
 	/* No matter what happens, always sum up the gc stats */
 	mergeThreadGCStats(env);
 }
@@ -3615,7 +3766,14 @@ MM_Scavenger::returnEmptyCopyCachesToFreeList(MM_EnvironmentStandard *env)
 MMINLINE void
 MM_Scavenger::addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry)
 {
-	_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	if (env->_scanCacheDequeActive && env->_scanCacheDeque.push(newCacheEntry)) {
+		env->_scavengerStats._scanCacheDequePushCount += 1;
+	} else {
+		if (env->_scanCacheDequeActive) {
+			env->_scavengerStats._scanCacheDequeOverflowCount += 1;
+		}
+		_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	}
 	if (0 != _waitingCount) {
 		/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
 		if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
@@ -3697,6 +3855,87 @@ MM_Scavenger::getNextScanCacheFromList(MM_EnvironmentStandard *env)
 	return _scavengeCacheScanList.popCache(env);
 }
 
+void
+MM_Scavenger::activateScanCacheDeque(MM_EnvironmentStandard *env)
+{
+	Assert_MM_false(env->_scanCacheDequeActive);
+	uintptr_t workerID = env->getWorkerID();
+	if ((NULL != _scanCacheDeques) && (workerID < _scanCacheDequeCount)) {
+		Assert_MM_true(env->_scanCacheDeque.isEmpty());
+		env->_scanCacheDeque.clear();
+		_scanCacheDeques[workerID] = &env->_scanCacheDeque;
+		env->_scanCacheDequeActive = true;
+	}
+}
+
+void
+MM_Scavenger::deactivateScanCacheDeque(MM_EnvironmentStandard *env)
+{
+	if (env->_scanCacheDequeActive) {
+		Assert_MM_true(env->_scanCacheDeque.isEmpty());
+		/* other threads may still hold the pointer, but the deque lives as long as the environment and is empty */
+		_scanCacheDeques[env->getWorkerID()] = NULL;
+		env->_scanCacheDequeActive = false;
+	}
+}
+
+MM_CopyScanCacheStandard *
+MM_Scavenger::stealScanCache(MM_EnvironmentStandard *env)
+{
+	uintptr_t workerID = env->getWorkerID();
+	uintptr_t nodeCount = _extensions->numaAwareGCThreads ? _extensions->_numaManager.getAffinityLeaderCount() : 0;
+	bool nodeLocal = (1 < nodeCount);
+
+	/* NUMA-aware threads are bound round-robin by worker ID, so first try the victims bound to the same node */
+	for (uintptr_t pass = (nodeLocal ? 0 : 1); pass < 2; pass++) {
+		for (uintptr_t i = 1; i < _scanCacheDequeCount; i++) {
+			uintptr_t victimID = (workerID + i) % _scanCacheDequeCount;
+			bool sameNode = nodeLocal && ((victimID % nodeCount) == env->getNumaNodeIndex());
+			if (sameNode != (0 == pass)) {
+				continue;
+			}
+			MM_CopyScanCacheDeque *victim = _scanCacheDeques[victimID];
+			if ((NULL != victim) && !victim->isEmpty()) {
+				MM_CopyScanCacheStandard *cache = victim->steal();
+				if (NULL != cache) {
+					env->_scavengerStats._scanCacheStealCount += 1;
+					if (nodeLocal && !sameNode) {
+						env->_scavengerStats._numaRemoteCacheCount += 1;
+					}
+					return cache;
+				}
+				env->_scavengerStats._scanCacheStealFailedCount += 1;
+			}
+		}
+	}
+	return NULL;
+}
+
+bool
+MM_Scavenger::isWorkAvailableInScanCacheDeques()
+{
+	for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+		MM_CopyScanCacheDeque *deque = _scanCacheDeques[i];
+		if ((NULL != deque) && !deque->isEmpty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+uintptr_t
+MM_Scavenger::getApproximateScanCacheDequeEntryCount()
+{
+	uintptr_t count = 0;
+	for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+		MM_CopyScanCacheDeque *deque = _scanCacheDeques[i];
+		if (NULL != deque) {
+			count += deque->getApproximateSize();
+		}
+	}
+	return count;
+}
+
 /**
  * Determine whether a scavenge that has been started did complete successfully.
  * @return true if the scavenge completed successfully, false otherwise.
@@ -4116,6 +4355,16 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 			while (NULL != (cache = _scavengeCacheScanList.popCache(env))) {
 				flushCache(env, cache);
 			}
+
+			/* other threads are synchronized, so their deques can be drained from here */
+			for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+				MM_CopyScanCacheDeque *deque = _scanCacheDeques[i];
+				if (NULL != deque) {
+					while (NULL != (cache = deque->steal())) {
+						flushCache(env, cache);
+					}
+				}
+			}
 		}
 		Assert_MM_true(0 == _cachedEntryCount);
 
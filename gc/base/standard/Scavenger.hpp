@@ -34,6 +34,7 @@
 #include "CollectionStatisticsStandard.hpp"
 #include "Collector.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
+#include "CopyScanCacheDeque.hpp"
 #include "CopyScanCacheList.hpp"
 #include "CopyScanCacheStandard.hpp"
 #include "CycleState.hpp"
@@ -114,9 +115,21 @@ private:
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics;  /** Common collect stats (memory, time etc.) */
 
+	/**
+	 * Slots fetched ahead from an object scanner whose referent headers have been prefetched
+	 * but which have not yet been copied/forwarded (see MM_GCExtensionsBase::scavengerPrefetchDistance).
+	 */
+	struct SlotPrefetchRing {
+		fomrobject_t *slots[MAXIMUM_SCAVENGER_PREFETCH_DISTANCE];
+		uintptr_t head; /**< index of the oldest slot in the ring */
+		uintptr_t count; /**< number of slots in the ring */
+	};
+
 	MM_CopyScanCacheList _scavengeCacheFreeList; /**< pool of unused copy-scan caches */
 	MM_CopyScanCacheList _scavengeCacheScanList; /**< scan lists */
 	volatile uintptr_t _cachedEntryCount; /**< non-empty scanCacheList count (not the total count of caches in the lists) */
+	MM_CopyScanCacheDeque * volatile *_scanCacheDeques; /**< per worker work-stealing deques, indexed by worker ID, NULL entries for threads not participating in the current cycle (only allocated if scavengerWorkStealing is enabled) */
+	uintptr_t _scanCacheDequeCount; /**< number of entries in _scanCacheDeques */
 	uintptr_t _cachesPerThread; /**< maximum number of copy and scan caches required per thread at any one time */
 	omrthread_monitor_t _scanCacheMonitor; /**< monitor to synchronize threads on scan lists */
 	omrthread_monitor_t _freeCacheMonitor; /**< monitor to synchronize threads on free list */
@@ -307,6 +320,44 @@ public:
 	MMINLINE void copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset);
 
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
+
+	/**
+	 * Hint the processor that the header (forwarding word) of an object in evacuate space will shortly
+	 * be read and possibly updated by copyAndForward().
+	 * @param objectPtr The object to prefetch
+	 */
+	MMINLINE void
+	prefetchForwardedHeader(omrobjectptr_t objectPtr)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch((const void *)objectPtr, 1, 3);
+#endif /* defined(__GNUC__) || defined(__clang__) */
+	}
+
+	/**
+	 * Top up the prefetch ring with slots from the object scanner, prefetching the header of each
+	 * referent that may have to be copied or forwarded.
+	 * @param env The environment.
+	 * @param objectScanner The scanner for the object being scavenged
+	 * @param ring The prefetch ring
+	 * @return false if the object scanner has no more slots
+	 */
+	MMINLINE bool fillSlotPrefetchRing(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, SlotPrefetchRing *ring);
+
+	/**
+	 * Remove the oldest slot from a non-empty prefetch ring.
+	 * @param ring The prefetch ring
+	 * @return the address of the slot
+	 */
+	MMINLINE fomrobject_t *
+	popSlotPrefetchRing(SlotPrefetchRing *ring)
+	{
+		fomrobject_t *slotPtr = ring->slots[ring->head];
+		ring->head = (ring->head + 1) % MAXIMUM_SCAVENGER_PREFETCH_DISTANCE;
+		ring->count -= 1;
+		return slotPtr;
+	}
+
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
 
 	/**
@@ -447,6 +498,40 @@ public:
 	void returnEmptyCopyCachesToFreeList(MM_EnvironmentStandard *env);
 	MMINLINE void addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry);
 
+	/**
+	 * Make the thread's scan cache deque visible to other GC threads for the current (non-concurrent) cycle.
+	 * Does nothing if work stealing is not enabled.
+	 */
+	void activateScanCacheDeque(MM_EnvironmentStandard *env);
+	/**
+	 * Withdraw the thread's scan cache deque at the end of the cycle. The deque must be empty.
+	 */
+	void deactivateScanCacheDeque(MM_EnvironmentStandard *env);
+	/**
+	 * Try to steal a scan cache from the deques of other GC threads, starting with the thread following this one.
+	 * @return the stolen cache, or NULL if none could be stolen
+	 */
+	MM_CopyScanCacheStandard *stealScanCache(MM_EnvironmentStandard *env);
+	/**
+	 * Racy check for scan caches queued in any registered deque.
+	 * @return true if any deque appears to be non-empty
+	 */
+	bool isWorkAvailableInScanCacheDeques();
+	/**
+	 * @return approximate number of scan caches queued in all registered deques
+	 */
+	uintptr_t getApproximateScanCacheDequeEntryCount();
+
+	/**
+	 * Check for queued scan work in the scan list or (if work stealing is enabled) in any scan cache deque.
+	 * @return true if scan work appears to be available
+	 */
+	MMINLINE bool
+	isScanWorkQueued()
+	{
+		return (0 != _cachedEntryCount) || ((NULL != _scanCacheDeques) && isWorkAvailableInScanCacheDeques());
+	}
+
 	MMINLINE bool
 	isWorkAvailableInCacheWithCheck(MM_CopyScanCacheStandard *cache)
 	{
@@ -964,6 +1049,8 @@ public:
 		, _cycleState()
 		, _collectionStatistics()
 		, _cachedEntryCount(0)
+		, _scanCacheDeques(NULL)
+		, _scanCacheDequeCount(0)
 		, _cachesPerThread(0)
 		, _scanCacheMonitor(NULL)
 		, _freeCacheMonitor(NULL)
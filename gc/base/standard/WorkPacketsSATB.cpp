@@ -63,7 +63,7 @@ MM_WorkPacketsSATB::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
-	if (!_inUseBarrierPacketList.initialize(env)) {
+	if (!_inUseBarrierPacketList.initialize(env, true)) {
 		return false;
 	}
 
@@ -35,6 +35,13 @@ MM_AllocationStats::clear()
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhRefreshWasteBytes = 0;
+	_tlhFlushWasteBytes = 0;
+	_freeEntryCacheHits = 0;
+	_freeEntryCacheMisses = 0;
+	_freeEntryCacheRefills = 0;
+	_freeEntryCacheLockAcquisitions = 0;
+	_freeEntryCacheDiscardedBytes = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	_arrayletLeafAllocationCount = 0;
@@ -60,6 +67,13 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 	MM_AtomicOperations::add(&_tlhRequestedBytes, stats->_tlhRequestedBytes);
 	MM_AtomicOperations::add(&_tlhDiscardedBytes, stats->_tlhDiscardedBytes);
 	MM_AtomicOperations::add(&_tlhAllocatedReused, stats->_tlhAllocatedReused);
+	MM_AtomicOperations::add(&_tlhRefreshWasteBytes, stats->_tlhRefreshWasteBytes);
+	MM_AtomicOperations::add(&_tlhFlushWasteBytes, stats->_tlhFlushWasteBytes);
+	MM_AtomicOperations::add(&_freeEntryCacheHits, stats->_freeEntryCacheHits);
+	MM_AtomicOperations::add(&_freeEntryCacheMisses, stats->_freeEntryCacheMisses);
+	MM_AtomicOperations::add(&_freeEntryCacheRefills, stats->_freeEntryCacheRefills);
+	MM_AtomicOperations::add(&_freeEntryCacheLockAcquisitions, stats->_freeEntryCacheLockAcquisitions);
+	MM_AtomicOperations::add(&_freeEntryCacheDiscardedBytes, stats->_freeEntryCacheDiscardedBytes);
 	/* looping to set a maximum value in _tlhMaxAbandonedListSize */
 	for (
 			uintptr_t prevMax = _tlhMaxAbandonedListSize;
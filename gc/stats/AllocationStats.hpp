@@ -42,6 +42,13 @@ public:
 	uintptr_t _tlhRequestedBytes; 		/**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; 		/**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhRefreshWasteBytes; /**< The amount of memory left unused at refreshes, in TLH remainders too small to be reused. */
+	uintptr_t _tlhFlushWasteBytes; /**< The amount of memory left unused in TLHs when they were flushed. */
+	uintptr_t _freeEntryCacheHits; /**< Number of allocations satisfied by the free entry cache without taking the pool lock. */
+	uintptr_t _freeEntryCacheMisses; /**< Number of allocations the free entry cache could not satisfy from the entries it held. */
+	uintptr_t _freeEntryCacheRefills; /**< Number of batches of free entries taken from the pool. */
+	uintptr_t _freeEntryCacheLockAcquisitions; /**< Number of times the pool lock was taken on behalf of allocations eligible for the cache. */
+	uintptr_t _freeEntryCacheDiscardedBytes; /**< The amount of memory the free entry cache left as holes, too small to be cached. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	uintptr_t _arrayletLeafAllocationCount;	/**< Number of arraylet leaf allocations */
@@ -63,6 +70,23 @@ public:
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 	uintptr_t tlhBytesAllocated() { return _tlhAllocatedFresh - _tlhDiscardedBytes; }
 	uintptr_t tlhBytesAllocatedUsed() { return _tlhAllocatedUsed; }
+	/**
+	 * @return the average size of the TLHs requested by refreshes, 0 if there was no refresh
+	 */
+	uintptr_t tlhAverageRefreshSize()
+	{
+		uintptr_t refreshCount = _tlhRefreshCountFresh + _tlhRefreshCountReused;
+		return (0 == refreshCount) ? 0 : (_tlhRequestedBytes / refreshCount);
+	}
+	/**
+	 * Without the free entry cache every eligible allocation would have taken the pool lock once.
+	 * @return the number of pool lock acquisitions saved by the free entry cache
+	 */
+	uintptr_t freeEntryCacheLocksAvoided()
+	{
+		uintptr_t allocations = _freeEntryCacheHits + _freeEntryCacheMisses;
+		return (allocations > _freeEntryCacheLockAcquisitions) ? (allocations - _freeEntryCacheLockAcquisitions) : 0;
+	}
 	uintptr_t nontlhBytesAllocated() { return _allocationBytes; }
 #endif
 
@@ -96,6 +120,13 @@ public:
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhRefreshWasteBytes(0),
+		_tlhFlushWasteBytes(0),
+		_freeEntryCacheHits(0),
+		_freeEntryCacheMisses(0),
+		_freeEntryCacheRefills(0),
+		_freeEntryCacheLockAcquisitions(0),
+		_freeEntryCacheDiscardedBytes(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 		_arrayletLeafAllocationCount(0),
 		_arrayletLeafAllocationBytes(0),
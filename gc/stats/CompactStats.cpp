@@ -48,6 +48,18 @@ MM_CompactStats::clear()
 	_fixupEndTime = 0;
 	_rootFixupStartTime = 0;
 	_rootFixupEndTime = 0;
+
+	_concurrentEvacuateRanges = 0;
+	_concurrentEvacuateLiveBytes = 0;
+	_concurrentEvacuatedObjects = 0;
+	_concurrentEvacuatedBytes = 0;
+	_concurrentEvacuatedBarrierBytes = 0;
+	_concurrentEvacuatedFinalBytes = 0;
+	_concurrentEvacuatePinnedSlices = 0;
+
+	_partialCompactSubAreas = 0;
+	_partialCompactSkippedSubAreas = 0;
+	_partialCompactBudgetBytes = 0;
 };
 
 void
@@ -56,6 +68,16 @@ MM_CompactStats::merge(MM_CompactStats *statsToMerge)
 	_movedObjects += statsToMerge->_movedObjects;
 	_movedBytes += statsToMerge->_movedBytes;
 	_fixupObjects += statsToMerge->_fixupObjects;
+	_concurrentEvacuateRanges += statsToMerge->_concurrentEvacuateRanges;
+	_concurrentEvacuateLiveBytes += statsToMerge->_concurrentEvacuateLiveBytes;
+	_concurrentEvacuatedObjects += statsToMerge->_concurrentEvacuatedObjects;
+	_concurrentEvacuatedBytes += statsToMerge->_concurrentEvacuatedBytes;
+	_concurrentEvacuatedBarrierBytes += statsToMerge->_concurrentEvacuatedBarrierBytes;
+	_concurrentEvacuatedFinalBytes += statsToMerge->_concurrentEvacuatedFinalBytes;
+	_concurrentEvacuatePinnedSlices += statsToMerge->_concurrentEvacuatePinnedSlices;
+	_partialCompactSubAreas += statsToMerge->_partialCompactSubAreas;
+	_partialCompactSkippedSubAreas += statsToMerge->_partialCompactSkippedSubAreas;
+	_partialCompactBudgetBytes += statsToMerge->_partialCompactBudgetBytes;
 	/* merging time intervals is a little different than just creating a total since the sum of two time intervals, for our uses, is their union (as opposed to the sum of two time spans, which is their sum) */
 	_setupStartTime = (0 == _setupStartTime) ? statsToMerge->_setupStartTime : OMR_MIN(_setupStartTime, statsToMerge->_setupStartTime);
 	_setupEndTime = OMR_MAX(_setupEndTime, statsToMerge->_setupEndTime);
@@ -58,6 +58,18 @@ public:
 	uint64_t _fixupEndTime;
 	uint64_t _rootFixupStartTime;
 	uint64_t _rootFixupEndTime;
+
+	uintptr_t _concurrentEvacuateRanges; /**< number of address ranges selected this cycle for concurrent evacuation */
+	uintptr_t _concurrentEvacuateLiveBytes; /**< estimated live bytes in the ranges selected this cycle for concurrent evacuation */
+	uintptr_t _concurrentEvacuatedObjects; /**< objects copied by the concurrent evacuation this cycle completed */
+	uintptr_t _concurrentEvacuatedBytes; /**< bytes copied by the concurrent evacuation this cycle completed */
+	uintptr_t _concurrentEvacuatedBarrierBytes; /**< part of _concurrentEvacuatedBytes copied by mutators hitting the read barrier */
+	uintptr_t _concurrentEvacuatedFinalBytes; /**< part of _concurrentEvacuatedBytes copied in the pause that completed the evacuation */
+	uintptr_t _concurrentEvacuatePinnedSlices; /**< evacuation slices left (partially) in place because no copy space was found */
+
+	uintptr_t _partialCompactSubAreas; /**< sub areas compacted by a partial compaction, 0 if the whole heap was compacted */
+	uintptr_t _partialCompactSkippedSubAreas; /**< sub areas a partial compaction left in place (only fixed up) */
+	uintptr_t _partialCompactBudgetBytes; /**< live bytes a partial compaction expected to move within its pause target */
 		
 	/* Remember gc count on last compaction of heap */
 	uintptr_t _lastHeapCompaction;
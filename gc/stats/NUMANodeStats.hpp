@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(NUMANODESTATS_HPP_)
+#define NUMANODESTATS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+/* Number of NUMA nodes tracked individually, threads bound to higher nodes are accounted to the last one */
+#define OMR_GC_NUMA_NODE_STATS_MAX 16
+
+/**
+ * Per NUMA node throughput of the GC threads bound to each node, recorded when GC threads are NUMA-aware.
+ * @ingroup GC_Stats
+ */
+class MM_NUMANodeStats
+{
+public:
+	uintptr_t _threadCount[OMR_GC_NUMA_NODE_STATS_MAX]; /**< The number of GC threads bound to the node that took part */
+	uint64_t _workCount[OMR_GC_NUMA_NODE_STATS_MAX]; /**< The work completed by the threads of the node (packets fetched, or bytes copied) */
+	uint64_t _remoteCount[OMR_GC_NUMA_NODE_STATS_MAX]; /**< The work items the threads of the node took from the lists of other nodes */
+
+	void clear()
+	{
+		for (uintptr_t i = 0; i < OMR_GC_NUMA_NODE_STATS_MAX; i++) {
+			_threadCount[i] = 0;
+			_workCount[i] = 0;
+			_remoteCount[i] = 0;
+		}
+	}
+
+	void merge(MM_NUMANodeStats *statsToMerge)
+	{
+		for (uintptr_t i = 0; i < OMR_GC_NUMA_NODE_STATS_MAX; i++) {
+			_threadCount[i] += statsToMerge->_threadCount[i];
+			_workCount[i] += statsToMerge->_workCount[i];
+			_remoteCount[i] += statsToMerge->_remoteCount[i];
+		}
+	}
+
+	/**
+	 * Account the work of one GC thread to its node.
+	 *
+	 * @param nodeIndex the zero based index of the affinity leader the thread is bound to
+	 * @param work the work completed by the thread
+	 * @param remote the work items the thread took from the lists of other nodes
+	 */
+	MMINLINE void
+	recordThread(uintptr_t nodeIndex, uint64_t work, uint64_t remote)
+	{
+		uintptr_t slot = OMR_MIN(nodeIndex, OMR_GC_NUMA_NODE_STATS_MAX - 1);
+		_threadCount[slot] += 1;
+		_workCount[slot] += work;
+		_remoteCount[slot] += remote;
+	}
+
+	MM_NUMANodeStats()
+	{
+		clear();
+	}
+};
+
+#endif /* NUMANODESTATS_HPP_ */
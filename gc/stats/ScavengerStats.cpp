@@ -93,6 +93,14 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_copy_cachesize_sum(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
+	,_slotPrefetchScanCount(0)
+	,_slotPrefetchCount(0)
+	,_scanCacheDequePushCount(0)
+	,_scanCacheDequeOverflowCount(0)
+	,_scanCacheStealCount(0)
+	,_scanCacheStealFailedCount(0)
+	,_numaRemoteCacheCount(0)
+	,_numaNodeStats()
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	,_readObjectBarrierCopy(0)
 	,_readObjectBarrierUpdate(0)
@@ -196,6 +204,14 @@ MM_ScavengerStats::clear(bool firstIncrement)
 
 	_slotsCopied = 0;
 	_slotsScanned = 0;
+	_slotPrefetchScanCount = 0;
+	_slotPrefetchCount = 0;
+	_scanCacheDequePushCount = 0;
+	_scanCacheDequeOverflowCount = 0;
+	_scanCacheStealCount = 0;
+	_scanCacheStealFailedCount = 0;
+	_numaRemoteCacheCount = 0;
+	_numaNodeStats.clear();
 
 	_adjustedSyncStallTime = 0;
 	_notifyStallTime = 0;
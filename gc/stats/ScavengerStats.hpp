@@ -33,6 +33,7 @@ class MM_EnvironmentBase;
 #include "objectdescription.h"
 
 #include "Math.hpp"
+#include "NUMANodeStats.hpp"
 
 #define OMR_SCAVENGER_DISTANCE_BINS 32
 #define OMR_SCAVENGER_CACHESIZE_BINS 16
@@ -148,6 +149,14 @@ public:
 
 	uint64_t _slotsCopied; /**< The number of slots copied by the thread since _slotsScanned was last sampled and reset */
 	uint64_t _slotsScanned; /**< The number of slots scanned by the thread since _slotsCopied was last sampled and reset */
+	uint64_t _slotPrefetchScanCount; /**< The number of slots scanned with prefetch lookahead enabled */
+	uint64_t _slotPrefetchCount; /**< The number of referent headers prefetched ahead of copy/forward */
+	uint64_t _scanCacheDequePushCount; /**< The number of scan caches pushed to the thread's work-stealing deque */
+	uint64_t _scanCacheDequeOverflowCount; /**< The number of scan caches pushed to the scan list because the thread's deque was full */
+	uint64_t _scanCacheStealCount; /**< The number of scan caches stolen from other threads' deques */
+	uint64_t _scanCacheStealFailedCount; /**< The number of steal attempts from non-empty deques that lost a race */
+	uint64_t _numaRemoteCacheCount; /**< The number of caches taken from the cache lists or deques of another NUMA node */
+	MM_NUMANodeStats _numaNodeStats; /**< Bytes copied by the GC threads of each NUMA node */
 	
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	uint64_t _readObjectBarrierCopy; /**< Number of objects copied by read barrier */
@@ -34,6 +34,7 @@
 #include "modronbase.h"
 #include "modronopt.h"
 #include "AtomicOperations.hpp"
+#include "NUMANodeStats.hpp"
 
 /**
  * Storage for statistics relevant to a copy forward collector.
@@ -51,6 +52,11 @@ public:
 	uintptr_t _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
 	uint64_t _completeStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting for all other threads to complete working */
+	uintptr_t packetListContentionCount; /**< The number of packet list accesses that found a sublist busy (lock held or lost a compare-and-swap) */
+	uintptr_t packetFetchCount; /**< The number of packets fetched from the packet lists */
+	uint64_t packetFetchTime; /**< The time, in hi-res ticks, spent fetching packets from the packet lists */
+	uintptr_t packetFetchRemoteCount; /**< The number of packets fetched from sublists of another NUMA node */
+	MM_NUMANodeStats numaNodeStats; /**< Packets fetched by the GC threads of each NUMA node */
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 protected:
@@ -73,6 +79,11 @@ public:
 		workPacketsAcquired = 0;
 		workPacketsReleased = 0;
 		workPacketsExchanged = 0;
+		packetListContentionCount = 0;
+		packetFetchCount = 0;
+		packetFetchTime = 0;
+		packetFetchRemoteCount = 0;
+		numaNodeStats.clear();
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -91,6 +102,11 @@ public:
 		workPacketsAcquired += statsToMerge->workPacketsAcquired;
 		workPacketsReleased += statsToMerge->workPacketsReleased;
 		workPacketsExchanged += statsToMerge->workPacketsExchanged;
+		packetListContentionCount += statsToMerge->packetListContentionCount;
+		packetFetchCount += statsToMerge->packetFetchCount;
+		packetFetchTime += statsToMerge->packetFetchTime;
+		packetFetchRemoteCount += statsToMerge->packetFetchRemoteCount;
+		numaNodeStats.merge(&statsToMerge->numaNodeStats);
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -130,6 +146,17 @@ public:
 	{
 		return _workStallTime + _completeStallTime;
 	}
+
+	/**
+	 * Add time interval to packet fetch time.
+	 * Time is stored in raw format, converted to resolution at time of output
+	 */
+	MMINLINE void
+	addToPacketFetchTime(uint64_t startTime, uint64_t endTime)
+	{
+		packetFetchCount += 1;
+		packetFetchTime += (endTime - startTime);
+	}
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	MMINLINE bool getSTWWorkStackOverflowOccured()	{ return _stwWorkStackOverflowOccured; };
@@ -151,6 +178,11 @@ public:
 		,_completeStallCount(0)
 		,_workStallTime(0)
 		,_completeStallTime(0)
+		,packetListContentionCount(0)
+		,packetFetchCount(0)
+		,packetFetchTime(0)
+		,packetFetchRemoteCount(0)
+		,numaNodeStats()
 		,_stwWorkStackOverflowCount(0)
 		,_stwWorkStackOverflowOccured(false)
 		,_stwWorkpacketCountAtOverflow(0)
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#if !defined(VERBOSEBINARYEVENT_HPP_)
+#define VERBOSEBINARYEVENT_HPP_
+
+#include "omrcfg.h"
+#include "modronbase.h"
+
+#include "VerboseBinaryFormat.hpp"
+
+/**
+ * A single verbose GC event destined for binary writers.  Built on the stack by the verbose handlers
+ * and passed down the writer chain; string fields are kept as pointers and interned by each writer.
+ * @see VerboseBinaryFormat.hpp
+ */
+class MM_VerboseBinaryEvent
+{
+	/*
+	 * Data members
+	 */
+public:
+	VerboseBinaryEventType _type; /**< record type */
+	uint64_t _timestampMs; /**< wall clock time of the event */
+	uintptr_t _fieldCount; /**< number of valid entries in _fields */
+	uint64_t _fields[VERBOSE_BINARY_MAX_FIELDS]; /**< field values, in the order documented for _type */
+	const char *_strings[VERBOSE_BINARY_MAX_FIELDS]; /**< string value of each field, NULL for numeric fields */
+protected:
+private:
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Append a numeric field to the event.
+	 * @param value[in] the field value
+	 */
+	MMINLINE void
+	addField(uint64_t value)
+	{
+		if (_fieldCount < VERBOSE_BINARY_MAX_FIELDS) {
+			_fields[_fieldCount] = value;
+			_strings[_fieldCount] = NULL;
+			_fieldCount += 1;
+		}
+	}
+
+	/**
+	 * Append a string field to the event.  The string must remain valid until the event has been output.
+	 * @param value[in] the NUL terminated string
+	 */
+	MMINLINE void
+	addString(const char *value)
+	{
+		if (_fieldCount < VERBOSE_BINARY_MAX_FIELDS) {
+			_fields[_fieldCount] = 0;
+			_strings[_fieldCount] = (NULL == value) ? "" : value;
+			_fieldCount += 1;
+		}
+	}
+
+	MM_VerboseBinaryEvent(VerboseBinaryEventType type, uint64_t timestampMs)
+		: _type(type)
+		, _timestampMs(timestampMs)
+		, _fieldCount(0)
+	{}
+};
+
+#endif /* VERBOSEBINARYEVENT_HPP_ */
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+#include "omrcomp.h"
+
+/**
+ * @file
+ * On-disk layout of the binary verbose GC event stream written by MM_VerboseWriterFileLoggingBinary
+ * (-Xgc:binaryLogging) and read back by the perftest decoder.
+ *
+ * A file starts with a VerboseBinaryFileHeader followed by a sequence of records.  Each record starts
+ * with a VerboseBinaryRecordHeader whose size covers the whole record, so readers can skip record types
+ * they do not understand.  The header is followed by fieldCount 64-bit values.  Fields flagged in
+ * stringFieldMask hold the id of a string introduced by an earlier VERBOSE_BINARY_EVENT_STRING record;
+ * a later string record with the same id replaces the earlier definition.
+ * All values are written in the byte order of the producing machine, identified by byteOrderMark.
+ * Records are padded to a multiple of 8 bytes.
+ */
+
+#define VERBOSE_BINARY_MAGIC "OMRVGCB"
+#define VERBOSE_BINARY_MAGIC_LENGTH 8
+#define VERBOSE_BINARY_VERSION 1
+#define VERBOSE_BINARY_BYTE_ORDER_MARK 0x01020304
+#define VERBOSE_BINARY_MAX_FIELDS 16
+#define VERBOSE_BINARY_RECORD_ALIGNMENT 8
+
+/**
+ * Record types.  The fields of each record are listed in the order they are written.  Durations
+ * are in microseconds, sizes in bytes.  Fields marked (s) are string ids.
+ * New types and new trailing fields may be added without bumping the version, existing ones must not change.
+ */
+typedef enum VerboseBinaryEventType {
+	VERBOSE_BINARY_EVENT_STRING = 0, /**< id; followed by the NUL terminated string */
+	VERBOSE_BINARY_EVENT_CYCLE_START = 1, /**< id, type(s), contextid, intervalus */
+	VERBOSE_BINARY_EVENT_CYCLE_END = 2, /**< id, type(s), contextid */
+	VERBOSE_BINARY_EVENT_EXCLUSIVE_START = 3, /**< id, intervalus, responseus, idleus, threads */
+	VERBOSE_BINARY_EVENT_EXCLUSIVE_END = 4, /**< id, durationus */
+	VERBOSE_BINARY_EVENT_SYSTEM_GC_START = 5, /**< id, reason(s), intervalus */
+	VERBOSE_BINARY_EVENT_SYSTEM_GC_END = 6, /**< id */
+	VERBOSE_BINARY_EVENT_AF_START = 7, /**< id, bytesrequested, intervalus */
+	VERBOSE_BINARY_EVENT_AF_END = 8, /**< id, success */
+	VERBOSE_BINARY_EVENT_GC_START = 9, /**< id, type(s), contextid, free, total */
+	VERBOSE_BINARY_EVENT_GC_END = 10, /**< id, type(s), contextid, durationus, userus, systemus, stallus, activethreads, free, total */
+	VERBOSE_BINARY_EVENT_GC_OP = 11, /**< id, type(s), contextid, timeus */
+	VERBOSE_BINARY_EVENT_HEAP_RESIZE = 12, /**< id, type(s), space(s), amount, count, timeus, reason(s) */
+	VERBOSE_BINARY_EVENT_COUNT
+} VerboseBinaryEventType;
+
+typedef struct VerboseBinaryFileHeader {
+	char magic[VERBOSE_BINARY_MAGIC_LENGTH]; /**< VERBOSE_BINARY_MAGIC, NUL padded */
+	uint32_t byteOrderMark; /**< VERBOSE_BINARY_BYTE_ORDER_MARK as written by the producer */
+	uint32_t version; /**< VERBOSE_BINARY_VERSION of the producer */
+	uint32_t headerSize; /**< size of this header; the first record starts at this offset */
+	uint32_t reserved;
+	uint64_t startTimeMs; /**< wall clock time the file was opened, in milliseconds since the epoch */
+} VerboseBinaryFileHeader;
+
+typedef struct VerboseBinaryRecordHeader {
+	uint32_t size; /**< size of the whole record including this header and padding */
+	uint16_t type; /**< one of VerboseBinaryEventType */
+	uint16_t fieldCount; /**< number of 64-bit fields following the header */
+	uint32_t stringFieldMask; /**< bit n set when field n is a string id */
+	uint32_t reserved;
+	uint64_t timestampMs; /**< wall clock time of the event, in milliseconds since the epoch */
+} VerboseBinaryRecordHeader;
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
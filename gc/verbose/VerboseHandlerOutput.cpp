@@ -28,9 +28,17 @@
 #include "CollectionStatistics.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "Heap.hpp"
+#include "HeapCommitHelper.hpp"
 #include "HeapRegionManager.hpp"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "MemoryPoolSegregated.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
+#include "RegionPoolSegregated.hpp"
+#endif /* OMR_GC_SEGREGATED_HEAP */
 #include "ObjectAllocationInterface.hpp"
 #include "ParallelDispatcher.hpp"
+#include "VerboseBinaryEvent.hpp"
 #include "VerboseHandlerOutput.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -143,10 +151,21 @@ MM_VerboseHandlerOutput::writeVmArgs(MM_EnvironmentBase* env, MM_VerboseBuffer*
 	buffer->formatAndOutput(env, 1, "</vmargs>");
 }
 
+bool
+MM_VerboseHandlerOutput::hasTextWriters()
+{
+	return _manager->getWriterChain()->hasTextWriters();
+}
 
 uintptr_t
 MM_VerboseHandlerOutput::getTagTemplate(char *buf, uintptr_t bufsize, uint64_t wallTimeMs)
 {
+	if (!hasTextWriters()) {
+		/* binary writers build their records from the event data, not the tag */
+		buf[0] = '\0';
+		return 0;
+	}
+
 	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
 	uintptr_t bufPos = 0;
 	bufPos += omrstr_printf(buf, bufsize, "timestamp=\"");
@@ -161,6 +180,12 @@ MM_VerboseHandlerOutput::getTagTemplate(char *buf, uintptr_t bufsize, uint64_t w
 uintptr_t
 MM_VerboseHandlerOutput::getTagTemplate(char *buf, uintptr_t bufsize, uintptr_t id, uint64_t wallTimeMs)
 {
+	if (!hasTextWriters()) {
+		/* binary writers build their records from the event data, not the tag */
+		buf[0] = '\0';
+		return 0;
+	}
+
 	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
 	uintptr_t bufPos = 0;
 	bufPos += omrstr_printf(buf, bufsize, "id=\"%zu\" timestamp=\"", id);
@@ -175,6 +200,12 @@ MM_VerboseHandlerOutput::getTagTemplate(char *buf, uintptr_t bufsize, uintptr_t
 uintptr_t
 MM_VerboseHandlerOutput::getTagTemplate(char *buf, uintptr_t bufsize, uintptr_t id, uintptr_t contextId, uint64_t wallTimeMs)
 {
+	if (!hasTextWriters()) {
+		/* binary writers build their records from the event data, not the tag */
+		buf[0] = '\0';
+		return 0;
+	}
+
 	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
 	uintptr_t bufPos = 0;
 	bufPos += getTagTemplate(buf, bufsize, id, wallTimeMs);
@@ -186,6 +217,12 @@ MM_VerboseHandlerOutput::getTagTemplate(char *buf, uintptr_t bufsize, uintptr_t
 uintptr_t
 MM_VerboseHandlerOutput::getTagTemplate(char *buf, uintptr_t bufsize, uintptr_t id, const char *type, uintptr_t contextId, uint64_t wallTimeMs, const char *reasonForTermination)
 {
+	if (!hasTextWriters()) {
+		/* binary writers build their records from the event data, not the tag */
+		buf[0] = '\0';
+		return 0;
+	}
+
 	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
 	uintptr_t bufPos = 0;
 	bufPos += omrstr_printf(buf, bufsize, "id=\"%zu\" type=\"%s\" contextid=\"%zu\" timestamp=\"", id, type, contextId);
@@ -204,6 +241,12 @@ MM_VerboseHandlerOutput::getTagTemplate(char *buf, uintptr_t bufsize, uintptr_t
 uintptr_t
 MM_VerboseHandlerOutput::getTagTemplateWithOldType(char *buf, uintptr_t bufsize, uintptr_t id, const char *oldType, const char *newType, uintptr_t contextId, uint64_t wallTimeMs)
 {
+	if (!hasTextWriters()) {
+		/* binary writers build their records from the event data, not the tag */
+		buf[0] = '\0';
+		return 0;
+	}
+
 	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
 	uintptr_t bufPos = 0;
 	bufPos += omrstr_printf(buf, bufsize, "id=\"%zu\" oldtype=\"%s\" newtype=\"%s\" contextid=\"%zu\" timestamp=\"", id, oldType, newType, contextId);
@@ -218,6 +261,12 @@ MM_VerboseHandlerOutput::getTagTemplateWithOldType(char *buf, uintptr_t bufsize,
 uintptr_t
 MM_VerboseHandlerOutput::getTagTemplate(char *buf, uintptr_t bufsize, uintptr_t id, const char *type, uintptr_t contextId, uint64_t timeus, uint64_t wallTimeMs)
 {
+	if (!hasTextWriters()) {
+		/* binary writers build their records from the event data, not the tag */
+		buf[0] = '\0';
+		return 0;
+	}
+
 	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
 	uintptr_t bufPos = 0;
 	bufPos += omrstr_printf(buf, bufsize, "id=\"%zu\" type=\"%s\" timems=\"%llu.%03.3llu\" contextid=\"%zu\" timestamp=\"", id, type, timeus / 1000, timeus % 1000, contextId);
@@ -232,6 +281,12 @@ MM_VerboseHandlerOutput::getTagTemplate(char *buf, uintptr_t bufsize, uintptr_t
 uintptr_t
 MM_VerboseHandlerOutput::getTagTemplateWithDuration(char *buf, uintptr_t bufsize, uintptr_t id, const char *type, uintptr_t contextId, uint64_t durationus, uint64_t usertimeus, uint64_t cputimeus, uint64_t wallTimeMs, uint64_t stalltimeus)
 {
+	if (!hasTextWriters()) {
+		/* binary writers build their records from the event data, not the tag */
+		buf[0] = '\0';
+		return 0;
+	}
+
 	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
 	uintptr_t bufPos = 0;
 	bufPos += omrstr_printf(buf, bufsize, "id=\"%zu\" type=\"%s\" contextid=\"%zu\" durationms=\"%llu.%03.3llu\" usertimems=\"%llu.%03.3llu\" systemtimems=\"%llu.%03.3llu\" stalltimems=\"%llu.%03.3llu\" timestamp=\"",
@@ -343,6 +398,30 @@ MM_VerboseHandlerOutput::outputInitializedStanza(MM_EnvironmentBase *env, MM_Ver
 	}
 
 	buffer->formatAndOutput(env, 1, "<attribute name=\"packetListSplit\" value=\"%zu\" />", _extensions->packetListSplit);
+	buffer->formatAndOutput(env, 1, "<attribute name=\"packetListLockFree\" value=\"%s\" />", _extensions->packetListLockFree ? "true" : "false");
+	if (_extensions->backgroundHeapCommit) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"backgroundHeapCommit\" value=\"true\" />");
+	}
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	if (_extensions->tlhAdaptiveSizing) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"tlhWasteTargetPercent\" value=\"%zu\" />", _extensions->tlhWasteTargetPercent);
+		buffer->formatAndOutput(env, 1, "<attribute name=\"tlhAllocationHistoryWeight\" value=\"%.2f\" />", _extensions->tlhAllocationHistoryWeight);
+	}
+	if (_extensions->freeEntryCache) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"freeEntryCacheBatchSize\" value=\"%zu\" />", _extensions->freeEntryCacheBatchSize);
+	}
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+	if (_extensions->numaAwareGCThreads) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"numaAwareGCThreads\" value=\"%zu\" />", _extensions->_numaManager.getAffinityLeaderCount());
+	}
+#if defined(OMR_GC_MODRON_COMPACTION)
+	if (_extensions->concurrentCompact) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"concurrentCompactLiveThreshold\" value=\"%zu\" />", _extensions->concurrentCompactLiveThreshold);
+	}
+	if (_extensions->partialCompact) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"partialCompactPauseTarget\" value=\"%zu\" />", _extensions->partialCompactPauseTarget);
+	}
+#endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	buffer->formatAndOutput(env, 1, "<attribute name=\"cacheListSplit\" value=\"%zu\" />", _extensions->cacheListSplit);
 #endif /* OMR_GC_MODRON_SCAVENGER */
@@ -490,6 +569,13 @@ MM_VerboseHandlerOutput::handleCycleStart(J9HookInterface** hook, uintptr_t even
 		writer->formatAndOutput(env, 0, "<cycle-start %s intervalms=\"%llu.%03llu\" />", tagTemplate, deltaTime / 1000 , deltaTime % 1000);
 	}
 	writer->flush(env);
+
+	MM_VerboseBinaryEvent binaryEvent(VERBOSE_BINARY_EVENT_CYCLE_START, omrtime_current_time_millis());
+	binaryEvent.addField(id);
+	binaryEvent.addString(cycleType);
+	binaryEvent.addField(0 /* Needs context id */);
+	binaryEvent.addField(deltaTime);
+	writer->outputEvent(env, &binaryEvent);
 	exitAtomicReportingBlock();
 }
 
@@ -523,7 +609,8 @@ MM_VerboseHandlerOutput::handleCycleEnd(J9HookInterface** hook, uintptr_t eventN
 	const char* cycleType = getCurrentCycleType(env);
 	char tagTemplate[200];
 	char fixupTagTemplate[100];
-	getTagTemplate(tagTemplate, sizeof(tagTemplate), _manager->getIdAndIncrement(), cycleType, env->_cycleState->_verboseContextID, omrtime_current_time_millis());
+	uintptr_t id = _manager->getIdAndIncrement();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), id, cycleType, env->_cycleState->_verboseContextID, omrtime_current_time_millis());
 
 	enterAtomicReportingBlock();
 	if(hasCycleEndInnerStanzas()) {
@@ -541,6 +628,12 @@ MM_VerboseHandlerOutput::handleCycleEnd(J9HookInterface** hook, uintptr_t eventN
 	}
 
 	writer->flush(env);
+
+	MM_VerboseBinaryEvent binaryEvent(VERBOSE_BINARY_EVENT_CYCLE_END, omrtime_current_time_millis());
+	binaryEvent.addField(id);
+	binaryEvent.addString(cycleType);
+	binaryEvent.addField(env->_cycleState->_verboseContextID);
+	writer->outputEvent(env, &binaryEvent);
 	exitAtomicReportingBlock();
 }
 
@@ -598,7 +691,8 @@ MM_VerboseHandlerOutput::handleExclusiveStart(J9HookInterface** hook, uintptr_t
 	getThreadName(escapedLastResponderName,sizeof(escapedLastResponderName),lastResponder);
 
 	char tagTemplate[200];
-	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), omrtime_current_time_millis());
+	uintptr_t id = manager->getIdAndIncrement();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), id, omrtime_current_time_millis());
 	enterAtomicReportingBlock();
 	if (!deltaTimeSuccess) {
 		writer->formatAndOutput(env, 0, "<warning details=\"clock error detected, following timing may be inaccurate\" />");
@@ -608,6 +702,14 @@ MM_VerboseHandlerOutput::handleExclusiveStart(J9HookInterface** hook, uintptr_t
 			exclusiveAccessTime / 1000, exclusiveAccessTime % 1000, meanIdleTime / 1000, meanIdleTime % 1000, event->haltedThreads, (NULL == lastResponder ? NULL : lastResponder->_language_vmthread), escapedLastResponderName);
 	writer->formatAndOutput(env, 0, "</exclusive-start>");
 	writer->flush(env);
+
+	MM_VerboseBinaryEvent binaryEvent(VERBOSE_BINARY_EVENT_EXCLUSIVE_START, omrtime_current_time_millis());
+	binaryEvent.addField(id);
+	binaryEvent.addField(deltaTime);
+	binaryEvent.addField(exclusiveAccessTime);
+	binaryEvent.addField(meanIdleTime);
+	binaryEvent.addField(event->haltedThreads);
+	writer->outputEvent(env, &binaryEvent);
 	exitAtomicReportingBlock();
 }
 
@@ -627,7 +729,8 @@ MM_VerboseHandlerOutput::handleExclusiveEnd(J9HookInterface** hook, uintptr_t ev
 
 
 	char tagTemplate[200];
-	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), omrtime_current_time_millis());
+	uintptr_t id = manager->getIdAndIncrement();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), id, omrtime_current_time_millis());
 	enterAtomicReportingBlock();
 	if (!deltaTimeSuccess) {
 		writer->formatAndOutput(env, 0, "<warning details=\"clock error detected, following timing may be inaccurate\" />");
@@ -635,6 +738,11 @@ MM_VerboseHandlerOutput::handleExclusiveEnd(J9HookInterface** hook, uintptr_t ev
 	writer->formatAndOutput(env, 0, "<exclusive-end %s durationms=\"%llu.%03llu\" />", tagTemplate, deltaTime / 1000, deltaTime % 1000);
 	writer->formatAndOutput(env, 0, "");
 	writer->flush(env);
+
+	MM_VerboseBinaryEvent binaryEvent(VERBOSE_BINARY_EVENT_EXCLUSIVE_END, omrtime_current_time_millis());
+	binaryEvent.addField(id);
+	binaryEvent.addField(deltaTime);
+	writer->outputEvent(env, &binaryEvent);
 	writer->endOfCycle(env);
 	exitAtomicReportingBlock();
 }
@@ -658,13 +766,20 @@ MM_VerboseHandlerOutput::handleSystemGCStart(J9HookInterface** hook, uintptr_t e
 
 	manager->setLastSystemGCTime(currentTime);
 	char tagTemplate[200];
-	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), omrtime_current_time_millis());
+	uintptr_t id = manager->getIdAndIncrement();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), id, omrtime_current_time_millis());
 	enterAtomicReportingBlock();
 	if (!deltaTimeSuccess) {
 		writer->formatAndOutput(env, 0, "<warning details=\"clock error detected, following timing may be inaccurate\" />");
 	}	
 	writer->formatAndOutput(env, 0, "<sys-start reason=\"%s\" %s intervalms=\"%llu.%03llu\" />", getSystemGCReasonAsString(event->gcCode), tagTemplate, deltaTime / 1000 , deltaTime % 1000);
 	writer->flush(env);
+
+	MM_VerboseBinaryEvent binaryEvent(VERBOSE_BINARY_EVENT_SYSTEM_GC_START, omrtime_current_time_millis());
+	binaryEvent.addField(id);
+	binaryEvent.addString(getSystemGCReasonAsString(event->gcCode));
+	binaryEvent.addField(deltaTime);
+	writer->outputEvent(env, &binaryEvent);
 	exitAtomicReportingBlock();
 }
 
@@ -677,10 +792,15 @@ MM_VerboseHandlerOutput::handleSystemGCEnd(J9HookInterface** hook, uintptr_t eve
 	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
 	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 	char tagTemplate[200];
-	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), omrtime_current_time_millis());
+	uintptr_t id = manager->getIdAndIncrement();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), id, omrtime_current_time_millis());
 	enterAtomicReportingBlock();
 	writer->formatAndOutput(env, 0, "<sys-end %s />", tagTemplate);
 	writer->flush(env);
+
+	MM_VerboseBinaryEvent binaryEvent(VERBOSE_BINARY_EVENT_SYSTEM_GC_END, omrtime_current_time_millis());
+	binaryEvent.addField(id);
+	writer->outputEvent(env, &binaryEvent);
 	exitAtomicReportingBlock();
 }
 
@@ -721,17 +841,24 @@ MM_VerboseHandlerOutput::handleAllocationFailureStart(J9HookInterface** hook, ui
 	}	
 
 	const char *endOfTag = hasAllocationFailureStartInnerStanzas()? ">" : "/>";
+	uintptr_t id = manager->getIdAndIncrement();
 
 	if (gc_policy_gencon == _extensions->configurationOptions._gcPolicy) {
-		writer->formatAndOutput(env, 0, "<af-start id=\"%zu\" threadId=\"%p\" totalBytesRequested=\"%zu\" %s intervalms=\"%llu.%03llu\" type=\"%s\" %s", manager->getIdAndIncrement(), event->currentThread, event->requestedBytes, tagTemplate, deltaTime / 1000 , deltaTime % 1000, event->tenure? "tenure" : "nursery", endOfTag);
+		writer->formatAndOutput(env, 0, "<af-start id=\"%zu\" threadId=\"%p\" totalBytesRequested=\"%zu\" %s intervalms=\"%llu.%03llu\" type=\"%s\" %s", id, event->currentThread, event->requestedBytes, tagTemplate, deltaTime / 1000 , deltaTime % 1000, event->tenure? "tenure" : "nursery", endOfTag);
 	} else {
-		writer->formatAndOutput(env, 0, "<af-start id=\"%zu\" threadId=\"%p\" totalBytesRequested=\"%zu\" %s intervalms=\"%llu.%03llu\" %s", manager->getIdAndIncrement(), event->currentThread, event->requestedBytes, tagTemplate, deltaTime / 1000 , deltaTime % 1000, endOfTag);
+		writer->formatAndOutput(env, 0, "<af-start id=\"%zu\" threadId=\"%p\" totalBytesRequested=\"%zu\" %s intervalms=\"%llu.%03llu\" %s", id, event->currentThread, event->requestedBytes, tagTemplate, deltaTime / 1000 , deltaTime % 1000, endOfTag);
 	}
 	if (hasAllocationFailureStartInnerStanzas()) {
 		handleAllocationFailureStartInnerStanzas(hook, eventNum, eventData, 1);
 		writer->formatAndOutput(env, 0, "</af-start>");
 	}
 	writer->flush(env);
+
+	MM_VerboseBinaryEvent binaryEvent(VERBOSE_BINARY_EVENT_AF_START, omrtime_current_time_millis());
+	binaryEvent.addField(id);
+	binaryEvent.addField(event->requestedBytes);
+	binaryEvent.addField(deltaTime);
+	writer->outputEvent(env, &binaryEvent);
 	exitAtomicReportingBlock();
 }
 
@@ -768,7 +895,8 @@ MM_VerboseHandlerOutput::handleAllocationFailureEnd(J9HookInterface** hook, uint
 	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
 	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 	char tagTemplate[200];
-	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), omrtime_current_time_millis());
+	uintptr_t id = manager->getIdAndIncrement();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), id, omrtime_current_time_millis());
 
 	const bool succeeded = allocDescription->getAllocationSucceeded();
 	const char *successString = succeeded? "true" : "false";
@@ -790,6 +918,11 @@ MM_VerboseHandlerOutput::handleAllocationFailureEnd(J9HookInterface** hook, uint
 	}
 
 	writer->flush(env);
+
+	MM_VerboseBinaryEvent binaryEvent(VERBOSE_BINARY_EVENT_AF_END, omrtime_current_time_millis());
+	binaryEvent.addField(id);
+	binaryEvent.addField(succeeded ? 1 : 0);
+	writer->outputEvent(env, &binaryEvent);
 	exitAtomicReportingBlock();
 }
 
@@ -877,11 +1010,50 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		if (_extensions->tlhAdaptiveSizing) {
+			writer->formatAndOutput(env, 1, "<tlh-sizing refreshes=\"%zu\" averagesize=\"%zu\" refreshwastebytes=\"%zu\" flushwastebytes=\"%zu\" />",
+					systemStats->_tlhRefreshCountFresh + systemStats->_tlhRefreshCountReused,
+					systemStats->tlhAverageRefreshSize(), systemStats->_tlhRefreshWasteBytes, systemStats->_tlhFlushWasteBytes);
+		}
+		if (_extensions->freeEntryCache) {
+			writer->formatAndOutput(env, 1, "<free-entry-cache hits=\"%zu\" misses=\"%zu\" refills=\"%zu\" locksavoided=\"%zu\" discardedbytes=\"%zu\" />",
+					systemStats->_freeEntryCacheHits, systemStats->_freeEntryCacheMisses, systemStats->_freeEntryCacheRefills,
+					systemStats->freeEntryCacheLocksAvoided(), systemStats->_freeEntryCacheDiscardedBytes);
+		}
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
 	}
 
+	MM_HeapCommitHelper *commitHelper = _extensions->heap->getCommitHelper();
+	if (NULL != commitHelper) {
+		uintptr_t precommittedBytes = 0;
+		uintptr_t precommitUsedBytes = 0;
+		uintptr_t deferredDecommitBytes = 0;
+		commitHelper->getStats(&precommittedBytes, &precommitUsedBytes, &deferredDecommitBytes);
+		writer->formatAndOutput(env, 1, "<heap-commit precommittedbytes=\"%zu\" precommitusedbytes=\"%zu\" deferreddecommitbytes=\"%zu\" />",
+				precommittedBytes, precommitUsedBytes, deferredDecommitBytes);
+	}
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (_extensions->isSegregatedHeap() && (1 < _extensions->freeRegionRefillBatchSize)) {
+		MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *)_extensions->heap->getDefaultMemorySpace()->getDefaultMemorySubSpace()->getMemoryPool();
+		MM_FreeRegionRefillStats refillStats;
+		memoryPool->getFreeRegionRefillStats(&refillStats);
+		writer->formatAndOutput(env, 1, "<free-region-refill batches=\"%zu\" regions=\"%zu\" allocations=\"%zu\" />",
+				refillStats._refillCount, refillStats._regionsRefilled, refillStats._splitFreeListAllocationCount);
+	}
+
+	if (_extensions->isSegregatedHeap() && _extensions->segregatedLazySweep) {
+		MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *)_extensions->heap->getDefaultMemorySpace()->getDefaultMemorySubSpace()->getMemoryPool();
+		MM_RegionPoolSegregated *regionPool = memoryPool->getRegionPool();
+		writer->formatAndOutput(env, 1, "<lazy-sweep debtregions=\"%zu\" sweptregions=\"%zu\" />",
+				regionPool->getSweepDebtRegions(), regionPool->getLazySweptRegions());
+	}
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 	if(0 != _extensions->bytesAllocatedMost){
 		const char *dots = "";
 		char escapedThreadName[128];
@@ -910,12 +1082,21 @@ MM_VerboseHandlerOutput::handleGCStart(J9HookInterface** hook, uintptr_t eventNu
 	MM_CollectionStatistics *stats = (MM_CollectionStatistics *)event->stats;
 	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 	char tagTemplate[200];
-	getTagTemplate(tagTemplate, sizeof(tagTemplate), _manager->getIdAndIncrement(), getCurrentCycleType(env), env->_cycleState->_verboseContextID, omrtime_current_time_millis());
+	uintptr_t id = _manager->getIdAndIncrement();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), id, getCurrentCycleType(env), env->_cycleState->_verboseContextID, omrtime_current_time_millis());
 
 	enterAtomicReportingBlock();
 	writer->formatAndOutput(env, 0, "<gc-start %s>", tagTemplate);
 	outputMemoryInfo(env, _manager->getIndentLevel() + 1, stats);
 	writer->formatAndOutput(env, 0, "</gc-start>");
+
+	MM_VerboseBinaryEvent binaryEvent(VERBOSE_BINARY_EVENT_GC_START, omrtime_current_time_millis());
+	binaryEvent.addField(id);
+	binaryEvent.addString(getCurrentCycleType(env));
+	binaryEvent.addField(env->_cycleState->_verboseContextID);
+	binaryEvent.addField(stats->_totalFreeHeapSize);
+	binaryEvent.addField(stats->_totalHeapSize);
+	writer->outputEvent(env, &binaryEvent);
 	exitAtomicReportingBlock();
 
 	printAllocationStats(env);
@@ -947,7 +1128,8 @@ MM_VerboseHandlerOutput::handleGCEnd(J9HookInterface** hook, uintptr_t eventNum,
 	bool getStallTimeSuccessful = getTimeDeltaInMicroSeconds(&stallTimeInMicroseconds, 0, stats->_stallTime);
 
 	char tagTemplate[200];
-	getTagTemplateWithDuration(	tagTemplate, sizeof(tagTemplate), _manager->getIdAndIncrement(),
+	uintptr_t id = _manager->getIdAndIncrement();
+	getTagTemplateWithDuration(	tagTemplate, sizeof(tagTemplate), id,
 								getCurrentCycleType(env), env->_cycleState->_verboseContextID,
 								durationInMicroseconds, userTimeInMicroseconds, systemTimeInMicroseconds,
 								omrtime_current_time_millis(), stallTimeInMicroseconds);
@@ -961,6 +1143,19 @@ MM_VerboseHandlerOutput::handleGCEnd(J9HookInterface** hook, uintptr_t eventNum,
 	writer->formatAndOutput(env, 0, "<gc-end %s activeThreads=\"%zu\">", tagTemplate, activeThreads);
 	outputMemoryInfo(env, _manager->getIndentLevel() + 1, stats);
 	writer->formatAndOutput(env, 0, "</gc-end>");
+
+	MM_VerboseBinaryEvent binaryEvent(VERBOSE_BINARY_EVENT_GC_END, omrtime_current_time_millis());
+	binaryEvent.addField(id);
+	binaryEvent.addString(getCurrentCycleType(env));
+	binaryEvent.addField(env->_cycleState->_verboseContextID);
+	binaryEvent.addField(durationInMicroseconds);
+	binaryEvent.addField(userTimeInMicroseconds);
+	binaryEvent.addField(systemTimeInMicroseconds);
+	binaryEvent.addField(stallTimeInMicroseconds);
+	binaryEvent.addField(activeThreads);
+	binaryEvent.addField(stats->_totalFreeHeapSize);
+	binaryEvent.addField(stats->_totalHeapSize);
+	writer->outputEvent(env, &binaryEvent);
 	exitAtomicReportingBlock();
 }
 
@@ -1061,6 +1256,16 @@ MM_VerboseHandlerOutput::outputHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t
 
 	writer->formatAndOutput(env, indent, "<heap-resize id=\"%zu\" type=\"%s\" space=\"%s\" amount=\"%zu\" count=\"%zu\" timems=\"%llu.%03llu\" reason=\"%s\" %s />", id, resizeTypeName, getSubSpaceType(subSpaceType), resizeAmount, resizeCount, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000, reasonString, tagTemplate);
 	writer->flush(env);
+
+	MM_VerboseBinaryEvent binaryEvent(VERBOSE_BINARY_EVENT_HEAP_RESIZE, omrtime_current_time_millis());
+	binaryEvent.addField(id);
+	binaryEvent.addString(resizeTypeName);
+	binaryEvent.addString(getSubSpaceType(subSpaceType));
+	binaryEvent.addField(resizeAmount);
+	binaryEvent.addField(resizeCount);
+	binaryEvent.addField(timeInMicroSeconds);
+	binaryEvent.addString(reasonString);
+	writer->outputEvent(env, &binaryEvent);
 }
 
 void
@@ -1178,8 +1383,16 @@ MM_VerboseHandlerOutput::handleGCOPOuterStanzaStart(MM_EnvironmentBase* env, con
 	}
 
 	char tagTemplate[200];
-	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), type ,contextID, duration, omrtime_current_time_millis());
+	uintptr_t id = manager->getIdAndIncrement();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), id, type ,contextID, duration, omrtime_current_time_millis());
 	writer->formatAndOutput(env, 0, "<gc-op %s>", tagTemplate);
+
+	MM_VerboseBinaryEvent binaryEvent(VERBOSE_BINARY_EVENT_GC_OP, omrtime_current_time_millis());
+	binaryEvent.addField(id);
+	binaryEvent.addString(type);
+	binaryEvent.addField(contextID);
+	binaryEvent.addField(duration);
+	writer->outputEvent(env, &binaryEvent);
 }
 
 void
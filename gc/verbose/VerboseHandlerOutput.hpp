@@ -62,6 +62,13 @@ protected:
 	virtual bool getThreadName(char *buf, uintptr_t bufLen, OMR_VMThread *vmThread);
 	virtual void writeVmArgs(MM_EnvironmentBase* env, MM_VerboseBuffer* buffer);
 
+	/**
+	 * Determine whether any attached writer consumes formatted text.
+	 * Tag templates are only built when this is true.
+	 * @return true if at least one text writer is attached, false otherwise.
+	 */
+	bool hasTextWriters();
+
 	bool getTimeDeltaInMicroSeconds(uint64_t *timeInMicroSeconds, uint64_t startTime, uint64_t endTime)
 	{
 		if(endTime < startTime) {
@@ -35,9 +35,13 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_BINARY = 6,
+	VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS = 7
 } WriterType;
 
+class MM_VerboseBinaryEvent;
+
 /**
  * The base class for writers that do output for the verbose GC.
  * Actual writers subclass this.
@@ -69,6 +73,19 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string) = 0;
 
+	/**
+	 * Output a structured event.  Only writers that produce a binary stream need to implement this.
+	 * @param[in] env the current environment.
+	 * @param[in] event the event to output.
+	 */
+	virtual void outputEvent(MM_EnvironmentBase *env, MM_VerboseBinaryEvent *event) {}
+
+	/**
+	 * Determine whether the writer consumes the formatted text output.
+	 * @return true if outputString() should be called, false if the writer only consumes events.
+	 */
+	virtual bool isTextWriter() { return true; }
+
 	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations) = 0;
 
 	virtual void endOfCycle(MM_EnvironmentBase *env) = 0;
@@ -59,6 +59,10 @@ MM_VerboseWriterChain::formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent
 {
 	va_list args;
 
+	if (!hasTextWriters()) {
+		return;
+	}
+
 	va_start(args, format);
 	_buffer->formatAndOutputV(env, indent, format, args);
 	va_end(args);
@@ -69,12 +73,37 @@ MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
-		writer->outputString(env, _buffer->contents());
+		if (writer->isTextWriter()) {
+			writer->outputString(env, _buffer->contents());
+		}
 		writer = writer->getNextWriter();
 	}
 	_buffer->reset();
 }
 
+void
+MM_VerboseWriterChain::outputEvent(MM_EnvironmentBase *env, MM_VerboseBinaryEvent *event)
+{
+	MM_VerboseWriter* writer = _writers;
+	while (NULL != writer) {
+		writer->outputEvent(env, event);
+		writer = writer->getNextWriter();
+	}
+}
+
+bool
+MM_VerboseWriterChain::hasTextWriters()
+{
+	MM_VerboseWriter* writer = _writers;
+	while (NULL != writer) {
+		if (writer->isTextWriter()) {
+			return true;
+		}
+		writer = writer->getNextWriter();
+	}
+	return false;
+}
+
 void
 MM_VerboseWriterChain::tearDown(MM_EnvironmentBase* env)
 {
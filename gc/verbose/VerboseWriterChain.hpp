@@ -31,6 +31,7 @@
 
 #include "EnvironmentBase.hpp"
 
+class MM_VerboseBinaryEvent;
 class MM_VerboseBuffer;
 class MM_VerboseWriter;
 
@@ -54,6 +55,20 @@ public:
 	void formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent, const char *format, ...);
 	void flush(MM_EnvironmentBase *env);
 
+	/**
+	 * Pass a structured event to each of the writers in the chain.
+	 * @param env[in] the current thread
+	 * @param event[in] the event to output
+	 */
+	void outputEvent(MM_EnvironmentBase *env, MM_VerboseBinaryEvent *event);
+
+	/**
+	 * Determine whether any writer in the chain consumes formatted text.  When none does,
+	 * formatting is skipped entirely.
+	 * @return true if at least one writer is a text writer
+	 */
+	bool hasTextWriters();
+
 	/**
 	 * Add a new verbose writer to the list of active output writers.
 	 * @param writer[in] New writer to add to list.
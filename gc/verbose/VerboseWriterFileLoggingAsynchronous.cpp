@@ -0,0 +1,382 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrutil.h"
+
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+
+#include <string.h>
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLoggingBuffered(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS)
+	,_omrVM(env->getOmrVM())
+	,_ring(NULL)
+	,_ringSize(0)
+	,_reservePosition(0)
+	,_consumePosition(0)
+	,_blockOnOverflow(false)
+	,_droppedRecords(0)
+	,_droppedBytes(0)
+	,_reportedDroppedRecords(0)
+	,_monitor(NULL)
+	,_writerThread(NULL)
+	,_state(STATE_ERROR)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance: opens the file, allocates the
+ * ring buffer and starts the writer thread.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	_blockOnOverflow = extensions->asyncLoggingBlockOnOverflow;
+	_reservePosition = 0;
+	_consumePosition = 0;
+	_ringSize = VERBOSE_ASYNC_MINIMUM_BUFFER_SIZE;
+	while ((_ringSize < extensions->asyncLoggingBufferSize) && (0 == (_ringSize & ((uintptr_t)1 << ((sizeof(uintptr_t) * 8) - 2))))) {
+		_ringSize <<= 1;
+	}
+	_ring = (uint8_t *)extensions->getForge()->allocate(_ringSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _ring) {
+		return false;
+	}
+	memset(_ring, 0, _ringSize);
+
+	if (!MM_VerboseWriterFileLoggingBuffered::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_VerboseWriterFileLoggingAsynchronous::_monitor")) {
+		return false;
+	}
+
+	/* hold the monitor over start-up of the thread so that it cannot notify us of its start-up state before we wait */
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		writerThreadProc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _state) {
+			omrthread_monitor_wait(_monitor);
+		}
+	} else {
+		_state = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return STATE_ERROR != _state;
+}
+
+/**
+ * Stop the writer thread, once it has written everything queued, and free the ring buffer.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		omrthread_monitor_enter(_monitor);
+		while ((STATE_ERROR != _state) && (STATE_TERMINATED != _state)) {
+			_state = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify_all(_monitor);
+			omrthread_monitor_wait(_monitor);
+		}
+		omrthread_monitor_exit(_monitor);
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+		_writerThread = NULL;
+	}
+
+	if (NULL != _ring) {
+		env->getExtensions()->getForge()->free(_ring);
+		_ring = NULL;
+	}
+
+	MM_VerboseWriterFileLoggingBuffered::tearDown(env);
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsynchronous::writerThreadProc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)info;
+	writer->writerThreadEntryPoint();
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writerThreadEntryPoint()
+{
+	MM_EnvironmentBase env(_omrVM);
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+	bool unsynced = false;
+
+	omrthread_monitor_enter(_monitor);
+	_writerThread = omrthread_self();
+	_state = STATE_RUNNING;
+	omrthread_monitor_notify_all(_monitor);
+
+	for (;;) {
+		bool terminating = (STATE_TERMINATION_REQUESTED == _state);
+		omrthread_monitor_exit(_monitor);
+
+		bool wroteRecords = drain(&env);
+		if (wroteRecords) {
+			unsynced = true;
+		} else if (NULL != _logFileStream) {
+			/* caught up, report output dropped since the last record and push what the file stream buffered to the file */
+			if (reportDroppedRecords(&env) || unsynced) {
+				omrfilestream_sync(_logFileStream);
+			}
+			unsynced = false;
+		}
+
+		omrthread_monitor_enter(_monitor);
+		if (wroteRecords) {
+			/* wake anyone waiting for the buffer to drain */
+			omrthread_monitor_notify_all(_monitor);
+		} else if (terminating && (_consumePosition == _reservePosition)) {
+			break;
+		} else {
+			/* producers never notify, poll the ring buffer */
+			omrthread_monitor_wait_timed(_monitor, VERBOSE_ASYNC_IDLE_WAIT_MILLIS, 0);
+		}
+	}
+
+	_state = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::drain(MM_EnvironmentBase *env)
+{
+	bool wroteRecords = false;
+
+	while (_consumePosition != _reservePosition) {
+		uintptr_t position = _consumePosition;
+		RecordHeader *header = (RecordHeader *)(_ring + (position & (_ringSize - 1)));
+		uint32_t size = header->size;
+		if (0 == size) {
+			/* reserved, but the producer has not finished copying it in yet */
+			break;
+		}
+		MM_AtomicOperations::readBarrier();
+
+		switch (header->type) {
+		case RECORD_TEXT:
+			reportDroppedRecords(env);
+			MM_VerboseWriterFileLoggingBuffered::outputString(env, (const char *)(header + 1));
+			break;
+		case RECORD_END_OF_CYCLE:
+			/* report into the file the drops happened in, before it may be rotated */
+			if (NULL != _logFileStream) {
+				reportDroppedRecords(env);
+			}
+			MM_VerboseWriterFileLoggingBuffered::endOfCycle(env);
+			break;
+		case RECORD_CLOSE:
+			if (NULL != _logFileStream) {
+				reportDroppedRecords(env);
+			}
+			closeFile(env);
+			break;
+		default:
+			break;
+		}
+
+		/* free space must read as uncommitted to the writer thread when producers reuse it */
+		memset(header, 0, size);
+		MM_AtomicOperations::writeBarrier();
+		_consumePosition = position + size;
+		wroteRecords = true;
+	}
+
+	return wroteRecords;
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::reportDroppedRecords(MM_EnvironmentBase *env)
+{
+	uintptr_t droppedRecords = _droppedRecords;
+	if (droppedRecords == _reportedDroppedRecords) {
+		return false;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	char warning[256];
+	omrstr_printf(warning, sizeof(warning), "<warning details=\"asynchronous verbose log buffer full, %zu records (%zu bytes) dropped so far\" />\n", droppedRecords, (uintptr_t)_droppedBytes);
+	MM_VerboseWriterFileLoggingBuffered::outputString(env, warning);
+	_reportedDroppedRecords = droppedRecords;
+	return true;
+}
+
+uintptr_t
+MM_VerboseWriterFileLoggingAsynchronous::enqueue(uint32_t type, const char *data, uintptr_t length, bool mayDrop)
+{
+	/* text records carry their NUL terminator, the ring buffer is zero where no record is committed */
+	uintptr_t dataSize = (RECORD_TEXT == type) ? (length + 1) : length;
+	uintptr_t recordSize = MM_Math::roundToCeiling(VERBOSE_ASYNC_RECORD_ALIGNMENT, sizeof(RecordHeader) + dataSize);
+	uintptr_t mask = _ringSize - 1;
+
+	for (;;) {
+		uintptr_t reserve = _reservePosition;
+		uintptr_t contiguous = _ringSize - (reserve & mask);
+		uintptr_t padding = (contiguous < recordSize) ? contiguous : 0;
+
+		if ((reserve + padding + recordSize - _consumePosition) > _ringSize) {
+			if (mayDrop || (STATE_RUNNING != _state)) {
+				return 0;
+			}
+			omrthread_sleep(1);
+			continue;
+		}
+
+		if (reserve == MM_AtomicOperations::lockCompareExchange(&_reservePosition, reserve, reserve + padding + recordSize)) {
+			if (0 != padding) {
+				/* records do not wrap, skip to the start of the ring buffer */
+				RecordHeader *paddingHeader = (RecordHeader *)(_ring + (reserve & mask));
+				paddingHeader->type = RECORD_PADDING;
+				MM_AtomicOperations::writeBarrier();
+				paddingHeader->size = (uint32_t)padding;
+			}
+			RecordHeader *header = (RecordHeader *)(_ring + ((reserve + padding) & mask));
+			header->type = type;
+			if (0 != length) {
+				memcpy(header + 1, data, length);
+			}
+			MM_AtomicOperations::writeBarrier();
+			header->size = (uint32_t)recordSize;
+			return reserve + padding + recordSize;
+		}
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::waitForPosition(uintptr_t position)
+{
+	omrthread_monitor_enter(_monitor);
+	while ((STATE_RUNNING == _state) && ((intptr_t)(position - _consumePosition) > 0)) {
+		omrthread_monitor_notify_all(_monitor);
+		omrthread_monitor_wait_timed(_monitor, VERBOSE_ASYNC_IDLE_WAIT_MILLIS, 0);
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	if (isWriterThread() || (STATE_RUNNING != _state)) {
+		/* output of the writer thread itself, such as the header of a new file, or no thread to hand it to */
+		MM_VerboseWriterFileLoggingBuffered::outputString(env, string);
+		return;
+	}
+
+	/*
+	 * A record may not take more than half of the ring buffer, longer output is queued in pieces.
+	 * Only the first piece may be dropped: once it is queued the rest waits for room, so the log
+	 * never holds part of a string.
+	 */
+	uintptr_t maximumLength = (_ringSize / 2) - sizeof(RecordHeader) - VERBOSE_ASYNC_RECORD_ALIGNMENT;
+	uintptr_t length = strlen(string);
+	bool mayDrop = !_blockOnOverflow;
+	while (0 != length) {
+		uintptr_t pieceLength = OMR_MIN(length, maximumLength);
+		if (0 == enqueue(RECORD_TEXT, string, pieceLength, mayDrop)) {
+			if (mayDrop) {
+				MM_AtomicOperations::add(&_droppedRecords, 1);
+				MM_AtomicOperations::add(&_droppedBytes, length);
+			}
+			break;
+		}
+		string += pieceLength;
+		length -= pieceLength;
+		mayDrop = false;
+	}
+}
+
+/**
+ * File rotation happens on the writer thread, in order with the output queued before it.
+ * End of cycle markers are never dropped so that rotation stays in step with the cycles.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase *env)
+{
+	if (isWriterThread() || (STATE_RUNNING != _state)) {
+		MM_VerboseWriterFileLoggingBuffered::endOfCycle(env);
+		return;
+	}
+	enqueue(RECORD_END_OF_CYCLE, NULL, 0, false);
+}
+
+/**
+ * Write out everything queued so far and close the file.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeStream(MM_EnvironmentBase *env)
+{
+	if (isWriterThread() || (STATE_RUNNING != _state)) {
+		closeFile(env);
+		return;
+	}
+	uintptr_t position = enqueue(RECORD_CLOSE, NULL, 0, false);
+	if (0 != position) {
+		waitForPosition(position);
+	}
+}
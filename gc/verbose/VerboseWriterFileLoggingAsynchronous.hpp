@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLoggingBuffered.hpp"
+
+/* Records in the ring buffer start on this boundary, it must hold a RecordHeader */
+#define VERBOSE_ASYNC_RECORD_ALIGNMENT 8
+/* Smallest ring buffer accepted, smaller requests are rounded up */
+#define VERBOSE_ASYNC_MINIMUM_BUFFER_SIZE ((uintptr_t)64 * 1024)
+/* Time the writer thread sleeps between polls of an empty ring buffer */
+#define VERBOSE_ASYNC_IDLE_WAIT_MILLIS 10
+
+/**
+ * Output agent which directs verbosegc output to file from a dedicated low priority thread.
+ * GC threads copy formatted output into a lock-free ring buffer and return; the writer thread
+ * drains the buffer into the file, so slow file systems do not extend GC pauses.
+ * When the buffer is full output is dropped and counted, whole strings at a time, and a warning with the
+ * counts is written once the writer thread catches up or the file is rotated or closed.  With
+ * -Xgc:asyncLoggingOverflow=block the GC thread waits for the writer thread to make room instead.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLoggingBuffered
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	typedef enum {
+		RECORD_TEXT = 0, /**< NUL terminated output */
+		RECORD_PADDING, /**< unused space up to the end of the ring buffer */
+		RECORD_END_OF_CYCLE, /**< the writer chain was notified of the end of a cycle */
+		RECORD_CLOSE, /**< the stream was closed */
+	} RecordType;
+
+	/* Header of a record in the ring buffer, the record data follows it */
+	struct RecordHeader {
+		volatile uint32_t size; /**< size of the record including the header, 0 until the record is committed */
+		uint32_t type; /**< RecordType */
+	};
+
+	typedef enum {
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_RUNNING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED,
+	} WriterThreadState;
+
+	OMR_VM *_omrVM;
+	uint8_t *_ring; /**< ring buffer of records, zero filled where no record is committed */
+	uintptr_t _ringSize; /**< size of _ring, a power of two */
+	volatile uintptr_t _reservePosition; /**< end of the space reserved by producers, increases monotonically */
+	volatile uintptr_t _consumePosition; /**< start of the next record for the writer thread, increases monotonically */
+	bool _blockOnOverflow; /**< wait for room rather than drop output when the ring buffer is full */
+	volatile uintptr_t _droppedRecords; /**< output strings dropped because the ring buffer was full */
+	volatile uintptr_t _droppedBytes; /**< bytes of output dropped because the ring buffer was full */
+	uintptr_t _reportedDroppedRecords; /**< dropped strings already reported in the log, writer thread only */
+
+	omrthread_monitor_t _monitor; /**< thread start-up, shut-down and drain handshakes; producers never take it */
+	omrthread_t _writerThread;
+	volatile WriterThreadState _state;
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+	virtual void closeStream(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the number of output strings dropped because the ring buffer was full
+	 */
+	MMINLINE uintptr_t getDroppedRecords() { return _droppedRecords; }
+
+	/**
+	 * @return the number of bytes of output dropped because the ring buffer was full
+	 */
+	MMINLINE uintptr_t getDroppedBytes() { return _droppedBytes; }
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+private:
+	static int J9THREAD_PROC writerThreadProc(void *info);
+
+	/**
+	 * Main loop of the writer thread, returns when termination is requested and the ring buffer is empty.
+	 */
+	void writerThreadEntryPoint();
+
+	/**
+	 * Write out all committed records.  Writer thread only.
+	 * @return true if any record was written
+	 */
+	bool drain(MM_EnvironmentBase *env);
+
+	/**
+	 * Write a warning with the output dropped so far, unless it has already been reported.  Writer thread only.
+	 * @return true if a warning was written
+	 */
+	bool reportDroppedRecords(MM_EnvironmentBase *env);
+
+	/**
+	 * Copy a record into the ring buffer.
+	 * @param type[in] the RecordType
+	 * @param data[in] the record data, may be NULL when length is 0
+	 * @param length[in] number of bytes of data
+	 * @param mayDrop[in] true if the record is discarded rather than waited for when the ring buffer is full
+	 * @return the position following the record, or 0 if it was dropped
+	 */
+	uintptr_t enqueue(uint32_t type, const char *data, uintptr_t length, bool mayDrop);
+
+	/**
+	 * Wait until the writer thread has consumed the ring buffer up to position.
+	 */
+	void waitForPosition(uintptr_t position);
+
+	MMINLINE bool isWriterThread() { return omrthread_self() == _writerThread; }
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
@@ -0,0 +1,246 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
+
+#include "GCExtensionsBase.hpp"
+#include "EnvironmentBase.hpp"
+#include "Math.hpp"
+#include "VerboseBinaryEvent.hpp"
+#include "VerboseBinaryFormat.hpp"
+
+#include <string.h>
+
+MM_VerboseWriterFileLoggingBinary::MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_BINARY)
+	,_logFileStream(NULL)
+	,_stringCount(0)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingBinary instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingBinary.
+ */
+MM_VerboseWriterFileLoggingBinary *
+MM_VerboseWriterFileLoggingBinary::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingBinary *agent = (MM_VerboseWriterFileLoggingBinary *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingBinary), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingBinary(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingBinary instance.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	return MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingBinary.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::tearDown(MM_EnvironmentBase *env)
+{
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens the file to log output to and writes the binary file header.
+ * Every file starts with an empty string table so that rotated files can be decoded on their own.
+ * The initialized stanza has no binary representation, so printInitializedHeader is ignored.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	int32_t openFlags =  EsOpenWrite | EsOpenCreate | _manager->fileOpenMode(env);
+
+	_logFileStream = omrfilestream_open(filenameToOpen, openFlags, 0666);
+	if(NULL == _logFileStream) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileStream = omrfilestream_open(filenameToOpen, openFlags, 0666);
+		if (NULL == _logFileStream) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	VerboseBinaryFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, VERBOSE_BINARY_MAGIC, sizeof(VERBOSE_BINARY_MAGIC));
+	header.byteOrderMark = VERBOSE_BINARY_BYTE_ORDER_MARK;
+	header.version = VERBOSE_BINARY_VERSION;
+	header.headerSize = sizeof(header);
+	header.startTimeMs = (uint64_t)omrtime_current_time_millis();
+	omrfilestream_write(_logFileStream, &header, sizeof(header));
+
+	_stringCount = 0;
+
+	return true;
+}
+
+/**
+ * Closes the file being logged to.  The binary stream has no footer.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(NULL != _logFileStream) {
+		omrfilestream_close(_logFileStream);
+		_logFileStream = NULL;
+	}
+}
+
+/**
+ * Formatted text is not part of the binary stream.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	/* No implementation */
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::outputEvent(MM_EnvironmentBase *env, MM_VerboseBinaryEvent *event)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(NULL == _logFileStream) {
+		/* See MM_VerboseWriterFileLoggingBuffered::outputString(); retry the open once before dropping the event */
+		openFile(env);
+		if(NULL == _logFileStream) {
+			return;
+		}
+	}
+
+	uint64_t record[(sizeof(VerboseBinaryRecordHeader) / sizeof(uint64_t)) + VERBOSE_BINARY_MAX_FIELDS];
+	VerboseBinaryRecordHeader *header = (VerboseBinaryRecordHeader *)record;
+	uint64_t *fields = record + (sizeof(VerboseBinaryRecordHeader) / sizeof(uint64_t));
+	uint32_t stringFieldMask = 0;
+
+	/* string definitions must precede the record referring to them */
+	for (uintptr_t i = 0; i < event->_fieldCount; i++) {
+		if (NULL != event->_strings[i]) {
+			fields[i] = internString(env, event->_strings[i], event->_timestampMs);
+			stringFieldMask |= ((uint32_t)1 << i);
+		} else {
+			fields[i] = event->_fields[i];
+		}
+	}
+
+	header->size = (uint32_t)(sizeof(VerboseBinaryRecordHeader) + (event->_fieldCount * sizeof(uint64_t)));
+	header->type = (uint16_t)event->_type;
+	header->fieldCount = (uint16_t)event->_fieldCount;
+	header->stringFieldMask = stringFieldMask;
+	header->reserved = 0;
+	header->timestampMs = event->_timestampMs;
+	omrfilestream_write(_logFileStream, record, header->size);
+}
+
+/**
+ * Find the id of a string in the current file, defining it first if it has not been seen yet.
+ * Strings are the static type and reason names used by the verbose handlers, so only the pointer is retained.
+ * Once the table is full, strings not already in it are not retained: they are all given the id
+ * VERBOSE_BINARY_STRING_TABLE_SIZE, and a string record redefining that id is written before every use.
+ * @return the string id
+ */
+uint64_t
+MM_VerboseWriterFileLoggingBinary::internString(MM_EnvironmentBase *env, const char *string, uint64_t timestampMs)
+{
+	for (uintptr_t i = 0; i < _stringCount; i++) {
+		if ((_stringTable[i] == string) || (0 == strcmp(_stringTable[i], string))) {
+			return i;
+		}
+	}
+
+	uintptr_t id = _stringCount;
+	if (id < VERBOSE_BINARY_STRING_TABLE_SIZE) {
+		_stringTable[id] = string;
+		_stringCount += 1;
+	}
+	writeStringRecord(env, id, string, timestampMs);
+	return id;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::writeStringRecord(MM_EnvironmentBase *env, uint64_t id, const char *string, uint64_t timestampMs)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	static const char padding[VERBOSE_BINARY_RECORD_ALIGNMENT] = { 0 };
+	uintptr_t length = strlen(string) + 1;
+	uintptr_t paddedLength = MM_Math::roundToCeiling(VERBOSE_BINARY_RECORD_ALIGNMENT, length);
+
+	VerboseBinaryRecordHeader header;
+	header.size = (uint32_t)(sizeof(header) + sizeof(id) + paddedLength);
+	header.type = VERBOSE_BINARY_EVENT_STRING;
+	header.fieldCount = 1;
+	header.stringFieldMask = 0;
+	header.reserved = 0;
+	header.timestampMs = timestampMs;
+
+	omrfilestream_write(_logFileStream, &header, sizeof(header));
+	omrfilestream_write(_logFileStream, &id, sizeof(id));
+	omrfilestream_write(_logFileStream, string, length);
+	if (paddedLength > length) {
+		omrfilestream_write(_logFileStream, padding, paddedLength - length);
+	}
+}
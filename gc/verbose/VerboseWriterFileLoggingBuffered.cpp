@@ -31,8 +31,8 @@
 
 #include <string.h>
 
-MM_VerboseWriterFileLoggingBuffered::MM_VerboseWriterFileLoggingBuffered(MM_EnvironmentBase *env, MM_VerboseManager *manager)
-	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_BUFFERED)
+MM_VerboseWriterFileLoggingBuffered::MM_VerboseWriterFileLoggingBuffered(MM_EnvironmentBase *env, MM_VerboseManager *manager, WriterType type)
+	:MM_VerboseWriterFileLogging(env, manager, type)
 	,_logFileStream(NULL)
 {
 	/* No implementation */
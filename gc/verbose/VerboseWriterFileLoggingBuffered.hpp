@@ -37,8 +37,8 @@ class MM_VerboseWriterFileLoggingBuffered : public MM_VerboseWriterFileLogging
 	 */
 public:
 protected:
-private:
 	OMRFileStream *_logFileStream; /**< the filestream being written to */
+private:
 
 	/*
 	 * Function members
@@ -49,15 +49,15 @@ public:
 	virtual void outputString(MM_EnvironmentBase *env, const char* string);
 
 protected:
-	MM_VerboseWriterFileLoggingBuffered(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+	MM_VerboseWriterFileLoggingBuffered(MM_EnvironmentBase *env, MM_VerboseManager *manager, WriterType type = VERBOSE_WRITER_FILE_LOGGING_BUFFERED);
 
 	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
-
-private:
 	virtual void tearDown(MM_EnvironmentBase *env);
 
 	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
 	void closeFile(MM_EnvironmentBase *env);
+
+private:
 };
 
 #endif /* VERBOSEWRITERFILELOGGINGBUFFERED_HPP_ */
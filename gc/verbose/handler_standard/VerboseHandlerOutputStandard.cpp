@@ -30,6 +30,7 @@
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "NUMANodeStats.hpp"
 #include "VerboseHandlerOutputStandard.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -280,6 +281,19 @@ MM_VerboseHandlerOutputStandard::handleGCOPStanza(MM_EnvironmentBase* env, const
 	writer->flush(env);
 }
 
+void
+MM_VerboseHandlerOutputStandard::outputNUMANodeStats(MM_EnvironmentBase *env, MM_NUMANodeStats *stats)
+{
+	MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+
+	for (uintptr_t node = 0; node < OMR_GC_NUMA_NODE_STATS_MAX; node++) {
+		if (0 != stats->_threadCount[node]) {
+			writer->formatAndOutput(env, 1, "<numa-node index=\"%zu\" threads=\"%zu\" work=\"%llu\" remote=\"%llu\" />",
+					node, stats->_threadCount[node], stats->_workCount[node], stats->_remoteCount[node]);
+		}
+	}
+}
+
 void
 MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
 {
@@ -298,6 +312,20 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
 
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+	if (0 != workPacketStats->packetFetchCount) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		writer->formatAndOutput(env, 1, "<packet-lists lockfree=\"%s\" fetched=\"%zu\" fetchus=\"%llu\" contended=\"%zu\" />",
+				extensions->packetListLockFree ? "true" : "false", workPacketStats->packetFetchCount,
+				omrtime_hires_delta(0, workPacketStats->packetFetchTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+				workPacketStats->packetListContentionCount);
+	}
+	if (extensions->numaAwareGCThreads) {
+		outputNUMANodeStats(env, &workPacketStats->numaNodeStats);
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
 	handleMarkEndInternal(env, eventData);
 
 	handleGCOPOuterStanzaEnd(env);
@@ -377,6 +405,19 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
 	}
 
+	if ((0 != compactStats->_concurrentEvacuateRanges) || (0 != compactStats->_concurrentEvacuatedObjects) || (0 != compactStats->_concurrentEvacuatePinnedSlices)) {
+		writer->formatAndOutput(env, 1, "<concurrent-compact-info ranges=\"%zu\" livebytes=\"%zu\" evacuatedobjects=\"%zu\" evacuatedbytes=\"%zu\" barrierbytes=\"%zu\" finalbytes=\"%zu\" pinnedslices=\"%zu\" />",
+				compactStats->_concurrentEvacuateRanges, compactStats->_concurrentEvacuateLiveBytes,
+				compactStats->_concurrentEvacuatedObjects, compactStats->_concurrentEvacuatedBytes,
+				compactStats->_concurrentEvacuatedBarrierBytes, compactStats->_concurrentEvacuatedFinalBytes,
+				compactStats->_concurrentEvacuatePinnedSlices);
+	}
+
+	if (0 != compactStats->_partialCompactSubAreas) {
+		writer->formatAndOutput(env, 1, "<partial-compact-info subareas=\"%zu\" skippedsubareas=\"%zu\" budgetbytes=\"%zu\" />",
+				compactStats->_partialCompactSubAreas, compactStats->_partialCompactSkippedSubAreas, compactStats->_partialCompactBudgetBytes);
+	}
+
 	handleCompactEndInternal(env, eventData);
 
 	handleGCOPOuterStanzaEnd(env);
@@ -431,6 +472,21 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
 
+	if (0 != scavengerStats->_slotPrefetchScanCount) {
+		writer->formatAndOutput(env, 1, "<scavenger-prefetch distance=\"%zu\" slots=\"%llu\" prefetched=\"%llu\" />",
+				extensions->scavengerPrefetchDistance, scavengerStats->_slotPrefetchScanCount, scavengerStats->_slotPrefetchCount);
+	}
+
+	if (extensions->scavengerWorkStealing) {
+		writer->formatAndOutput(env, 1, "<scavenger-work-stealing pushed=\"%llu\" overflowed=\"%llu\" stolen=\"%llu\" failedsteals=\"%llu\" />",
+				scavengerStats->_scanCacheDequePushCount, scavengerStats->_scanCacheDequeOverflowCount,
+				scavengerStats->_scanCacheStealCount, scavengerStats->_scanCacheStealFailedCount);
+	}
+
+	if (extensions->numaAwareGCThreads) {
+		outputNUMANodeStats(env, &scavengerStats->_numaNodeStats);
+	}
+
 	handleScavengeEndInternal(env, eventData);
 	
 	if(0 != scavengerStats->_tenureExpandedCount) {
@@ -881,6 +937,10 @@ MM_VerboseHandlerOutputStandard::hasOutputMemoryInfoInnerStanza()
 void
 MM_VerboseHandlerOutputStandard::outputMemType(MM_EnvironmentBase* env, uintptr_t indent, const char* type, uintptr_t free, uintptr_t total, uint32_t tenureFragmentation, uintptr_t microFragment, uintptr_t macroFragment)
 {
+	if (!hasTextWriters()) {
+		return;
+	}
+
 	char memInfoBuffer[INITIAL_BUFFER_SIZE] = "";
 	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
 
@@ -925,7 +985,7 @@ MM_VerboseHandlerOutputStandard::outputMemoryInfoInnerStanza(MM_EnvironmentBase
 		writer->formatAndOutput(env, indent, "</mem>");
 	}
 
-	if (stats->_loaEnabled) {
+	if (stats->_loaEnabled && hasTextWriters()) {
 		char tenureMemInfoBuffer[INITIAL_BUFFER_SIZE] = "";
 		uintptr_t bufPos = 0;
 		OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
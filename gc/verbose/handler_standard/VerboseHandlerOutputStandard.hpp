@@ -31,6 +31,7 @@
 
 class MM_CollectionStatistics;
 class MM_EnvironmentBase;
+class MM_NUMANodeStats;
 
 class MM_VerboseHandlerOutputStandard : public MM_VerboseHandlerOutput
 {
@@ -61,6 +62,13 @@ protected:
 
 	void handleGCOPStanza(MM_EnvironmentBase* env, const char *type, uintptr_t contextID, uint64_t duration, bool deltaTimeSuccess);
 
+	/**
+	 * Output the throughput of the GC threads of each NUMA node that took part in a collection phase.
+	 * @param[IN] env the current environment
+	 * @param[IN] stats the per node statistics of the phase
+	 */
+	void outputNUMANodeStats(MM_EnvironmentBase *env, MM_NUMANodeStats *stats);
+
 	virtual bool hasOutputMemoryInfoInnerStanza();
 	virtual void outputMemoryInfoInnerStanzaInternal(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
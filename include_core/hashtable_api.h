@@ -199,6 +199,107 @@ hashTableRemove(J9HashTable *table, void *entry);
 void *
 hashTableStartDo(J9HashTable *table,  J9HashTableState *handle);
 
+/* ---------------- concurrenthashtable.c ---------------- */
+
+/**
+* @brief Copy an entry into the table unless an equal entry is present, locking only its bucket
+* @param *table
+* @param *entry
+* @return void *	the existing or added entry, NULL on allocation failure
+*/
+void *
+concurrentHashTableAdd(J9ConcurrentHashTable *table, void *entry);
+
+
+/**
+* @brief Enter a read section, in which entries returned by the table stay readable
+* @param *table
+* @return uintptr_t	the section to pass to concurrentHashTableExit()
+*/
+uintptr_t
+concurrentHashTableEnter(J9ConcurrentHashTable *table);
+
+
+/**
+* @brief Leave a read section
+* @param *table
+* @param section
+* @return void
+*/
+void
+concurrentHashTableExit(J9ConcurrentHashTable *table, uintptr_t section);
+
+
+/**
+* @brief Find an entry, locking only to link its bucket the first time it is used after growth
+* @param *table
+* @param *entry
+* @return void *	the entry, valid until the caller leaves its read section, or NULL if not found
+*/
+void *
+concurrentHashTableFind(J9ConcurrentHashTable *table, void *entry);
+
+
+/**
+* @brief Free the table; no other thread may be using it
+* @param *table
+* @return void
+*/
+void
+concurrentHashTableFree(J9ConcurrentHashTable *table);
+
+
+/**
+* @brief
+* @param *table
+* @return uintptr_t
+*/
+uintptr_t
+concurrentHashTableGetCount(J9ConcurrentHashTable *table);
+
+
+/**
+* @brief Create a concurrent hash table with lock-free lookups and incremental growth
+* @param *portLibrary
+* @param *tableName
+* @param tableSize
+* @param entrySize
+* @param memoryCategory
+* @param hashFn
+* @param hashEqualFn
+* @param *functionUserData
+* @return J9ConcurrentHashTable *
+*/
+J9ConcurrentHashTable *
+concurrentHashTableNew(
+	OMRPortLibrary *portLibrary,
+	const char *tableName,
+	uint32_t tableSize,
+	uint32_t entrySize,
+	uint32_t memoryCategory,
+	J9HashTableHashFn hashFn,
+	J9HashTableEqualFn hashEqualFn,
+	void *functionUserData);
+
+
+/**
+* @brief Free removed entries and replaced bucket arrays which no read section can still reach
+* @param *table
+* @return void
+*/
+void
+concurrentHashTableReclaim(J9ConcurrentHashTable *table);
+
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return uint32_t	0 on success, 1 if the entry was not found
+*/
+uint32_t
+concurrentHashTableRemove(J9ConcurrentHashTable *table, void *entry);
+
 
 
 #ifdef __cplusplus
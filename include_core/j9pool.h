@@ -84,6 +84,7 @@ typedef struct J9Pool {
 #define POOL_NO_ZERO  8
 #define POOL_ROUND_TO_PAGE_SIZE  16
 #define POOL_USES_HOLES  32
+#define POOL_CONCURRENT  64
 #define POOL_NEVER_FREE_PUDDLES  2
 #define POOL_ALLOC_TYPE_PUDDLE  1
 #define POOL_ALWAYS_KEEP_SORTED  4
@@ -105,6 +106,23 @@ typedef struct J9PoolState {
 
 #define POOLSTATE_FOLLOW_NEXT_POINTERS  1
 
+/*
+ * @ddr_namespace: map_to_type=J9PoolMagazine
+ */
+
+#define J9POOL_MAGAZINE_SIZE  32
+
+/**
+ * Cache of free elements owned by a single thread, used with POOL_CONCURRENT pools.
+ * Elements held in a magazine are reserved for the owner and are not visible to
+ * pool iteration, but are counted by pool_numElements() until the magazine returns
+ * them. A zero-initialized magazine is empty.
+ */
+typedef struct J9PoolMagazine {
+	uintptr_t count;
+	void *elements[J9POOL_MAGAZINE_SIZE];
+} J9PoolMagazine;
+
 #define pool_state J9PoolState
 
 #define J9POOLPUDDLE_FIRSTFREESLOT(parm) SRP_GET((parm)->firstFreeSlot, uintptr_t*)
@@ -132,6 +132,79 @@ typedef struct J9HashTableState {
 	uintptr_t flags;
 } J9HashTableState;
 
+/**
+ * Concurrent hash table node. The entry data immediately follows the node header.
+ * All the nodes of a table are kept in a single list sorted by order key, the bit
+ * reversed hash, so that growing the table never moves a node. Nodes are never modified
+ * once published, except for the next pointer of a predecessor being redirected around
+ * a removed node.
+ */
+typedef struct J9ConcurrentHashTableNode {
+	struct J9ConcurrentHashTableNode *volatile next;
+	struct J9ConcurrentHashTableNode *retiredNext;
+	uintptr_t orderKey;
+} J9ConcurrentHashTableNode;
+
+/**
+ * Concurrent hash table bucket. The bucket node marks where the nodes of the bucket start
+ * in the list, and its lock serializes the updates of the nodes up to the next bucket node.
+ * Bucket nodes have even order keys, entry nodes odd ones.
+ */
+typedef struct J9ConcurrentHashTableBucket {
+	struct J9ConcurrentHashTableNode node;
+	volatile uintptr_t lock;
+} J9ConcurrentHashTableBucket;
+
+/**
+ * Concurrent hash table bucket array. A NULL head is a bucket which has not been linked
+ * into the list yet, its nodes are reached from the bucket it splits from.
+ */
+typedef struct J9ConcurrentHashTableBuckets {
+	struct J9ConcurrentHashTableBuckets *retiredNext;
+	uintptr_t size;
+	struct J9ConcurrentHashTableBucket *volatile heads[1];
+} J9ConcurrentHashTableBuckets;
+
+/**
+ * Read section state of a thread. Only written by that thread, each reader has a cache line of its own.
+ */
+typedef struct J9ConcurrentHashTableReader {
+	struct J9ConcurrentHashTableReader *next;
+	void *allocation;
+	volatile uintptr_t epoch;	/* epoch when the outermost read section in progress was entered, 0 if none */
+	uintptr_t depth;	/* number of nested read sections in progress */
+	volatile uintptr_t inUse;	/* non-zero while the reader belongs to a thread */
+} J9ConcurrentHashTableReader;
+
+/**
+ * Concurrent hash table. Every thread inside a read section holds the epoch it entered in
+ * its reader. Advancing the epoch moves the retired nodes and bucket arrays into limbo,
+ * and frees the previous limbo lists once no reader holds an epoch from before they were
+ * moved there.
+ */
+typedef struct J9ConcurrentHashTable {
+	const char *tableName;
+	struct OMRPortLibrary *portLibrary;
+	uint32_t entrySize;
+	uint32_t nodeSize;
+	uint32_t memoryCategory;
+	uintptr_t (*hashFn)(void *key, void *userData) ;
+	uintptr_t (*hashEqualFn)(void *leftKey, void *rightKey, void *userData) ;
+	void *functionUserData;
+	struct J9ConcurrentHashTableBuckets *volatile buckets;
+	volatile uintptr_t numberOfNodes;
+	struct J9ConcurrentHashTableNode *volatile retiredNodes;
+	struct J9ConcurrentHashTableBuckets *volatile retiredBuckets;
+	struct J9ConcurrentHashTableReader *volatile readers;
+	uintptr_t readerKey;	/* omrthread_tls_key_t of the calling thread's reader */
+	volatile uintptr_t unslottedReaders;	/* read sections in progress in threads which have no reader */
+	volatile uintptr_t epoch;
+	volatile uintptr_t reclaiming;
+	uintptr_t limboEpoch;
+	struct J9ConcurrentHashTableNode *limboNodes;
+	struct J9ConcurrentHashTableBuckets *limboBuckets;
+} J9ConcurrentHashTable;
+
 #ifdef __cplusplus
 }
 #endif
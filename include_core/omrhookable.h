@@ -66,6 +66,8 @@ typedef struct J9HookInterface {
 #define J9HOOK_ERR_DISABLED  -1
 #define J9HOOK_ERR_NOMEM  -2
 #define J9HOOK_ERR_INVALID_AGENT_ID  -3
+#define J9HOOK_TAG_RATE_LIMITED  0x04000000
+#define J9HOOK_TAG_SAMPLED  0x08000000
 #define J9HOOK_TAG_REVERSE_ORDER  0x10000000
 #define J9HOOK_TAG_AGENT_ID  0x20000000
 #define J9HOOK_TAG_COUNTED  0x40000000
@@ -108,6 +110,12 @@ typedef struct J9CommonHookInterface {
 	struct OMRPortLibrary *portLib;		/* for accessing PortLibrary  */
 	uint64_t threshold4Trace;			/* the threshold for triggering tracepoint */
 	uintptr_t eventSize;				/* how many events supported by this hook interface */
+	struct J9HookListenerArray * volatile *listeners;	/* listener array of each event read by dispatch, NULL if the event has no listeners */
+	struct J9HookListenerArray *retiredListeners;	/* replaced listener arrays, newest first, freed once no dispatch can be reading them */
+	volatile uintptr_t dispatchEpoch;	/* advanced by every publication of a listener array, never 0 */
+	omrthread_tls_key_t dispatchSlotKey;	/* key of the calling thread's J9HookDispatchSlot */
+	struct J9Pool *dispatchSlots;	/* J9HookDispatchSlot of every thread which has dispatched an event */
+	volatile uintptr_t unslottedDispatches;	/* dispatches in progress by threads which could not be given a slot */
 } J9CommonHookInterface;
 
 
@@ -124,8 +132,38 @@ typedef struct J9HookRecord {
 	uintptr_t count;
 	uintptr_t id;
 	uintptr_t agentID;
+	uintptr_t samplingPeriod;			/* deliver every Nth event to the listener, 0 to deliver every event */
+	volatile uintptr_t samplingCount;	/* events seen by a sampled listener */
+	uintptr_t rateLimit;				/* deliver at most this many events per second, 0 for no limit */
+	volatile uint64_t rateLimitWindow;	/* second of the current rate limit window (high 32 bits) and events delivered in it (low 32 bits) */
 } J9HookRecord;
 
+/* copy of a valid J9HookRecord taken when the listener array of its event was published */
+typedef struct J9HookListener {
+	struct J9HookRecord *record;
+	uintptr_t id;						/* the record's id when copied, the listener is stale once the id changes */
+	J9HookFunction function;
+	const char *callsite;
+	void *userData;
+	uintptr_t samplingPeriod;
+	uintptr_t rateLimit;
+} J9HookListener;
+
+/* listeners of an event in dispatch order. Never modified once published, registration replaces the whole array */
+typedef struct J9HookListenerArray {
+	struct J9HookListenerArray *retiredNext;	/* next retired array, once this array has been replaced */
+	uintptr_t retiredEpoch;	/* dispatch epoch when this array was replaced */
+	uintptr_t count;
+	J9HookListener listeners[1];
+} J9HookListenerArray;
+
+/* dispatch state of one thread. Only written by the owning thread, each slot has a cache line of its own */
+typedef struct J9HookDispatchSlot {
+	volatile uintptr_t epoch;	/* dispatch epoch when the outermost dispatch in progress started, 0 if none is in progress */
+	uintptr_t depth;	/* number of nested dispatches in progress */
+	volatile uintptr_t inUse;	/* non-zero while the slot belongs to a thread */
+} J9HookDispatchSlot;
+
 
 /* magic hooks supported by every hook interface */
 
@@ -103,6 +103,13 @@ or omrthread priority value.
 #define J9THREAD_LIB_FLAG_DESTROY_MUTEX_ON_MONITOR_FREE  0x400000
 #define J9THREAD_LIB_FLAG_ENABLE_CPU_MONITOR  0x800000
 #define J9THREAD_LIB_FLAG_NO_DEFAULT_AFFINITY  0x1000000
+#define J9THREAD_LIB_FLAG_FUTEX_MONITORS_ENABLED  0x2000000
+#define J9THREAD_LIB_FLAG_ADAPT_SPIN_TUNING_ENABLED  0x4000000
+
+/* Three-tier monitors on Linux can block on a futex instead of the monitor mutex, see omrthread_lib_control */
+#if defined(LINUX) && defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS)
+#define OMR_THR_FUTEX_MONITORS
+#endif /* defined(LINUX) && defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) */
 
 #define J9THREAD_LIB_YIELD_ALGORITHM_SCHED_YIELD  0
 #define J9THREAD_LIB_YIELD_ALGORITHM_CONSTANT_USLEEP  2
@@ -112,6 +119,13 @@ or omrthread priority value.
 #define OMRTHREAD_MINIMUM_WAKE_THREADS 1
 #define OMRTHREAD_IGNORE_SPIN_THREAD_BOUND 0
 
+/* Default hold time, in timebase ticks, up to which adaptive spin tuning grows a monitor's spin budget */
+#define OMRTHREAD_ADAPT_SPIN_TUNE_HOLDTIME 2000
+/* Default ratio of the park-immediately hold time to the tuning hold time, used when adaptSpinHoldtime is not set */
+#define OMRTHREAD_ADAPT_SPIN_TUNE_PARK_RATIO 32
+/* Default ceiling of a tuned spin budget, as a multiple of defaultMonitorSpinCount3 */
+#define OMRTHREAD_ADAPT_SPIN_TUNE_MAX_RATIO 8
+
 #include "thread_api.h"
 
 
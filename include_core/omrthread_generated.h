@@ -199,6 +199,13 @@ typedef struct J9ThreadMonitorTracing {
 	uint64_t holdtime_avg;
 	uintptr_t volatile holdtime_count;
 	uintptr_t enter_pause_count;
+#if defined(OMR_THR_ADAPTIVE_SPIN)
+	uint64_t adapt_holdtime;
+	uintptr_t adapt_spin_count;
+	uintptr_t adapt_grow_count;
+	uintptr_t adapt_shrink_count;
+	uintptr_t adapt_park_count;
+#endif /* OMR_THR_ADAPTIVE_SPIN */
 #endif /* OMR_THR_JLM_HOLD_TIMES */
 } J9ThreadMonitorTracing;
 
@@ -290,6 +297,7 @@ typedef struct J9ThreadAbstractMonitor {
 #define J9THREAD_MONITOR_IGNORE_ENTER  0x4000000
 #define J9THREAD_MONITOR_SLOW_ENTER  0x8000000
 #define J9THREAD_MONITOR_TRY_ENTER_SPIN  0x10000000
+#define J9THREAD_MONITOR_FUTEX  0x20000000
 #define J9THREAD_MONITOR_SPINLOCK_UNOWNED  0
 #define J9THREAD_MONITOR_SPINLOCK_OWNED  1
 #define J9THREAD_MONITOR_SPINLOCK_EXCEEDED  2
@@ -46,6 +46,7 @@ extern "C" {
 #define UT_SUFFIX_KEYWORD             "SUFFIX"
 #define UT_LIBPATH_KEYWORD            "LIBPATH"
 #define UT_BUFFERS_KEYWORD            "BUFFERS"
+#define UT_MAPPED_FILE_KEYWORD        "MAPPEDFILE"
 #define UT_MINIMAL_KEYWORD            "MINIMAL"
 #define UT_MAXIMAL_KEYWORD            "MAXIMAL"
 #define UT_COUNT_KEYWORD              "COUNT"
@@ -142,6 +142,37 @@ void
 pool_removeElement(J9Pool *aPool, void *anElement);
 
 
+/**
+* @brief
+* @param *aPool
+* @param *magazine
+* @return void *
+*/
+void *
+pool_newElementConcurrent(J9Pool *aPool, J9PoolMagazine *magazine);
+
+
+/**
+* @brief
+* @param *aPool
+* @param *magazine
+* @param *anElement
+* @return void
+*/
+void
+pool_removeElementConcurrent(J9Pool *aPool, J9PoolMagazine *magazine, void *anElement);
+
+
+/**
+* @brief
+* @param *aPool
+* @param *magazine
+* @return void
+*/
+void
+pool_flushMagazine(J9Pool *aPool, J9PoolMagazine *magazine);
+
+
 /**
 * @brief
 * @param *aPool
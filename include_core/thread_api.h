@@ -51,6 +51,15 @@ extern "C" {
 #define J9THREAD_RWMUTEX_FAIL	 	 1
 #define J9THREAD_RWMUTEX_WOULDBLOCK -1
 
+/* omrthread_rwmutex_init flags */
+#define J9THREAD_RWMUTEX_READER_BIASED	0x1 /* readers count in per-thread slots; writers revoke the bias */
+
+#define J9THREAD_POOL_OK		0
+#define J9THREAD_POOL_FAIL		1
+
+/* omrthread_pool_create flags */
+#define J9THREAD_POOL_NUMA_AWARE	0x1 /* spread workers over the NUMA nodes and steal from the local node first */
+
 /* Define conversions for units of time used in thrprof.c */
 #define SEC_TO_NANO_CONVERSION_CONSTANT		(1000 * 1000 * 1000)
 #define MICRO_TO_NANO_CONVERSION_CONSTANT	1000
@@ -311,6 +320,135 @@ omrthread_rwmutex_init(omrthread_rwmutex_t *handle, uintptr_t flags, const char
 BOOLEAN
 omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex);
 
+/* ---------------- omrthreadpool.c ---------------- */
+
+/**
+* @struct
+*/
+struct OMRThreadPool;
+
+/**
+*@typedef
+*/
+typedef struct OMRThreadPool *omrthread_pool_t;
+
+/**
+* @struct
+*/
+struct OMRThreadWaitGroup;
+
+/**
+*@typedef
+*/
+typedef struct OMRThreadWaitGroup *omrthread_waitgroup_t;
+
+/**
+*@typedef
+*/
+typedef void (*omrthread_pool_task_t)(void *taskArg);
+
+/**
+* @brief
+* @param handle
+* @param workerCount
+* @param priority
+* @param flags
+* @param name
+* @return intptr_t
+*/
+intptr_t
+omrthread_pool_create(omrthread_pool_t *handle, uintptr_t workerCount, omrthread_prio_t priority, uintptr_t flags, const char *name);
+
+/**
+* @brief
+* @param pool
+* @return void
+*/
+void
+omrthread_pool_destroy(omrthread_pool_t pool);
+
+/**
+* @brief
+* @param pool
+* @param task
+* @param taskArg
+* @param group
+* @return intptr_t
+*/
+intptr_t
+omrthread_pool_submit(omrthread_pool_t pool, omrthread_pool_task_t task, void *taskArg, omrthread_waitgroup_t group);
+
+/**
+* @brief
+* @param pool
+* @param task
+* @param taskArgs
+* @param count
+* @param group
+* @return intptr_t
+*/
+intptr_t
+omrthread_pool_submit_batch(omrthread_pool_t pool, omrthread_pool_task_t task, void **taskArgs, uintptr_t count, omrthread_waitgroup_t group);
+
+/**
+* @brief
+* @param pool
+* @param group
+* @return void
+*/
+void
+omrthread_pool_wait(omrthread_pool_t pool, omrthread_waitgroup_t group);
+
+/**
+* @brief
+* @param pool
+* @return uintptr_t
+*/
+uintptr_t
+omrthread_pool_get_worker_count(omrthread_pool_t pool);
+
+/**
+* @brief
+* @param handle
+* @param name
+* @return intptr_t
+*/
+intptr_t
+omrthread_waitgroup_init(omrthread_waitgroup_t *handle, const char *name);
+
+/**
+* @brief
+* @param group
+* @return void
+*/
+void
+omrthread_waitgroup_destroy(omrthread_waitgroup_t group);
+
+/**
+* @brief
+* @param group
+* @param count
+* @return void
+*/
+void
+omrthread_waitgroup_add(omrthread_waitgroup_t group, uintptr_t count);
+
+/**
+* @brief
+* @param group
+* @return void
+*/
+void
+omrthread_waitgroup_done(omrthread_waitgroup_t group);
+
+/**
+* @brief
+* @param group
+* @return void
+*/
+void
+omrthread_waitgroup_wait(omrthread_waitgroup_t group);
+
 /* ---------------- omrthreadpriority.c ---------------- */
 
 /**
@@ -645,6 +783,13 @@ omrthread_lib_clear_flags(uintptr_t flags);
 #define J9THREAD_LIB_CONTROL_USE_REALTIME_SCHEDULING_DISABLED ((uintptr_t) 0)
 #endif /* defined(LINUX) || defined(OSX) */
 
+/* Monitors initialized while enabled block on a futex; existing monitors are unaffected.
+ * Fails with -1 unless OMR_THR_FUTEX_MONITORS is defined.
+ */
+#define J9THREAD_LIB_CONTROL_USE_FUTEX_MONITORS "use_futex_monitors"
+#define J9THREAD_LIB_CONTROL_USE_FUTEX_MONITORS_ENABLED ((uintptr_t) J9THREAD_LIB_FLAG_FUTEX_MONITORS_ENABLED)
+#define J9THREAD_LIB_CONTROL_USE_FUTEX_MONITORS_DISABLED ((uintptr_t) 0)
+
 /**
 * @brief Control the thread library.
 * @param key
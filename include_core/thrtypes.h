@@ -129,6 +129,8 @@ typedef struct J9ThreadLibrary {
 	uintptr_t adaptSpinSlowPercent;
 	uintptr_t adaptSpinSampleStopCount;
 	uintptr_t adaptSpinSampleCountStopRatio;
+	uintptr_t adaptSpinTuneHoldtime;
+	uintptr_t adaptSpinTuneMaxSpinCount3;
 #endif /* OMR_THR_ADAPTIVE_SPIN */
 	OMRMemCategory threadLibraryCategory;
 	OMRMemCategory nativeStackCategory;
@@ -44,6 +44,7 @@ extern "C" {
 #define UT_FASTPATH                   17
 #define UT_TRACE_INTERNAL             0
 #define UT_TRACE_EXTERNAL             1
+#define UT_TRACE_MAPPED               2
 #define UT_STRUCT_ALIGN               4
 #define UT_TRACE_BUFFER_NAME          "UTTB"
 #define UT_TRACE_HEADER_NAME          "UTTH"
@@ -215,7 +216,7 @@ typedef struct UtTraceSection {
 	UtDataHeader header; /* Eyecatcher, version etc        */
 	uint64_t startPlatform; /* Platform timer                 */
 	uint64_t startSystem; /* Time relative 1/1/1970         */
-	int32_t type; /* Internal / External trace      */
+	int32_t type; /* Internal / External / Mapped    */
 	int32_t generations; /* Number of generations          */
 	int32_t pointerSize; /* Size in bytes of a pointer     */
 } UtTraceSection;
@@ -62,8 +62,19 @@ extern "C" {
 
 #define UT_NORMAL_BUFFER              0
 
+#define UT_DEFAULT_MAPPED_FILE_SIZE   (4 * 1024 * 1024)
+#define UT_MINIMUM_MAPPED_BUFFERS     2
+#define UT_MAPPED_BUFFER_ALIGN        8
+
+/* Layout of a mapped trace file: the trace file header, then the OMR_TraceBuffers, each aligned */
+#define UT_MAPPED_HEADER_SIZE(headerLength) \
+	((((uintptr_t)(headerLength) + UT_MAPPED_BUFFER_ALIGN - 1) / UT_MAPPED_BUFFER_ALIGN) * UT_MAPPED_BUFFER_ALIGN)
+#define UT_MAPPED_BUFFER_STRIDE(bufferSize) \
+	(((offsetof(OMR_TraceBuffer, record) + (uintptr_t)(bufferSize) + UT_MAPPED_BUFFER_ALIGN - 1) / UT_MAPPED_BUFFER_ALIGN) * UT_MAPPED_BUFFER_ALIGN)
+
 #define UT_TRC_BUFFER_FULL            0x00000001 /* indicates a buffer that has been published */
 #define UT_TRC_BUFFER_NEW             0x20000000 /* indicates an empty new buffer in use by a thread. cleared when buffer is written to. */
+#define UT_TRC_BUFFER_PUBLISHING      0x40000000 /* indicates a full buffer being passed to subscribers. cleared when the buffer is released. */
 #define UT_TRC_BUFFER_ACTIVE          0x80000000 /* indicates a buffer in use by a thread */
 
 /*
@@ -226,8 +237,8 @@ struct OMR_TraceGlobal {
 	char                       *serviceInfo;            /* Service information             */
 	char                       *traceFormatSpec;        /* Printf template filespec        */
 	OMR_TraceThread            *lastPrint;              /* OMR_TraceThread for last print     */
-	OMR_TraceBuffer            *freeQueue;              /* Free buffer queue               */
-	omrthread_monitor_t         freeQueueLock;          /* lock for free queue */
+	OMR_TraceBuffer * volatile  freeQueue;              /* Free buffer queue, pushed lock-free */
+	omrthread_monitor_t         freeQueueLock;          /* serializes pops from the free queue */
 	UtTraceCfg                 *config;                 /* Trace selection cmds link/list  */
 	UtTraceFileHdr             *traceHeader;            /* Trace file header               */
 	UtComponentList            *componentList;          /* registered or configured component */
@@ -243,6 +254,14 @@ struct OMR_TraceGlobal {
 	omrthread_monitor_t         bufferPoolLock;         /* Lock for buffer pool. Do not allow tracepoints while locking, holding, or releasing this monitor. */
 	J9Pool                     *threadPool;             /* Pool for allocating all UtThreadData */
 	omrthread_monitor_t         threadPoolLock;         /* Lock for thread pool. Do not allow tracepoints while locking, holding, or releasing this monitor. */
+	char                       *mappedFileName;         /* Memory mapped trace file, NULL if trace buffers are not mapped */
+	uint64_t                    mappedFileSize;         /* Requested size of the memory mapped trace file */
+	intptr_t                    mappedFileDescriptor;   /* Open handle of the memory mapped trace file */
+	J9MmapHandle               *mappedFileHandle;       /* Mapping of the memory mapped trace file */
+	uint8_t                    *mappedBuffers;          /* First trace buffer in the mapping */
+	uintptr_t                   mappedBufferStride;     /* Distance between trace buffers in the mapping */
+	uint32_t                    mappedBufferCount;      /* Number of trace buffers in the mapping, 0 if there is no mapping */
+	volatile uint32_t           mappedBufferCursor;     /* Next trace buffer in the mapping to try to claim */
 };
 
 /*
@@ -535,6 +554,49 @@ omr_error_t releaseTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf
  */
 OMR_TraceBuffer *recycleTraceBuffer(OMR_TraceThread *currentThr);
 
+/**
+ * @brief Create the memory mapped trace file and map it.
+ *
+ * Trace buffers are then claimed from the file in turn, oldest first, instead of
+ * being allocated from the buffer pool. Tracepoints written to them persist in the
+ * file without being copied, including when the process crashes.
+ *
+ * @pre The trace options have been processed.
+ * @return an OMR error code
+ */
+omr_error_t openMappedTraceFile(void);
+
+/**
+ * @brief Unmap and close the memory mapped trace file, if there is one.
+ * @param[in] global The trace global data. OMR_TRACEGLOBAL() might not be usable.
+ */
+void closeMappedTraceFile(OMR_TraceGlobal *global);
+
+/**
+ * @brief Claim the next unused trace buffer in the memory mapped trace file.
+ *
+ * Buffers held by a thread or still being published are not claimed.
+ *
+ * @return a trace buffer, or NULL if there is no mapped file or all of its buffers are in use
+ */
+OMR_TraceBuffer *claimMappedTraceBuffer(void);
+
+/**
+ * @brief Return a trace buffer to the memory mapped trace file.
+ *
+ * The buffer keeps its contents until it is claimed again.
+ *
+ * @param[in] buf The trace buffer to release. Must be a mapped trace buffer.
+ */
+void releaseMappedTraceBuffer(OMR_TraceBuffer *buf);
+
+/**
+ * @brief Determine whether a trace buffer lies in the memory mapped trace file.
+ * @param[in] buf The trace buffer.
+ * @return TRUE if buf was claimed from the memory mapped trace file, FALSE otherwise
+ */
+BOOLEAN isMappedTraceBuffer(OMR_TraceBuffer *buf);
+
 /*
  * =============================================================================
  * Externs
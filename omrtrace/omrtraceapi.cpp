@@ -91,6 +91,12 @@ omr_trc_startup(OMR_VM *omrVM, const OMR_TraceLanguageInterface *languageIntf, c
 		}
 	}
 
+	rc = openMappedTraceFile();
+	if (OMR_ERROR_NONE != rc) {
+		omrtty_printf("omr_trc_startup: failed to map trace file, rc=%d\n", rc);
+		goto done;
+	}
+
 	omrVM->_trcEngine = newTrcEngine;
 done:
 	return rc;
@@ -280,6 +286,9 @@ postForkCleanupBuffers(OMR_TraceThread *thr)
 		thr->trcBuf = NULL;
 	}
 	pool_clear(OMR_TRACEGLOBAL(bufferPool));
+
+	/* The mapped trace file belongs to the parent, the child traces to pooled buffers. */
+	closeMappedTraceFile(omrTraceGlobal);
 }
 
 void
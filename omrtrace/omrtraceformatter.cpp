@@ -23,6 +23,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <stddef.h>
+#include <stdlib.h>
 
 #include "omrtraceformat.h"
 #include "omrtrace_internal.h"
@@ -46,6 +47,7 @@ struct UtTracePointIterator {
 	int32_t isCircularBuffer;
 	int32_t iteratorHasWrapped;
 	char *tempBuffForWrappedTP;
+	int32_t bufferIsMapped;
 	int32_t processingIncompleteDueToPartialTracePoint;
 	uint32_t longTracePointLength;
 	uint32_t numberOfBytesInPlatformUDATA;
@@ -66,8 +68,15 @@ struct UtTraceFileIterator {
 	OMRPortLibrary *portLib;
 	intptr_t traceFileHandle;
 	intptr_t currentPosition;
+	J9MmapHandle *mappedFile;
+	OMR_TraceBuffer **mappedBuffers;
+	uint32_t mappedBufferCount;
+	uint32_t nextMappedBuffer;
 };
 
+static omr_error_t mapTraceFile(UtTraceFileIterator *iterator);
+static int compareMappedTraceBuffers(const void *left, const void *right);
+
 omr_error_t
 omr_trc_getTraceFileIterator(OMRPortLibrary *portLib, char *fileName, UtTraceFileIterator **iteratorPtr,
 							 FormatStringCallback getFormatStringFn)
@@ -145,6 +154,18 @@ omr_trc_getTraceFileIterator(OMRPortLibrary *portLib, char *fileName, UtTraceFil
 	iterator->currentPosition = bytesRead;
 	iterator->portLib = OMRPORTLIB;
 	iterator->traceFileHandle = traceFileHandle;
+	iterator->mappedFile = NULL;
+	iterator->mappedBuffers = NULL;
+	iterator->mappedBufferCount = 0;
+	iterator->nextMappedBuffer = 0;
+
+	if (UT_TRACE_MAPPED == iterator->traceSection->type) {
+		omr_error_t rc = mapTraceFile(iterator);
+		if (OMR_ERROR_NONE != rc) {
+			omr_trc_freeTraceFileIterator(iterator);
+			return rc;
+		}
+	}
 
 	*iteratorPtr = iterator;
 
@@ -152,6 +173,74 @@ omr_trc_getTraceFileIterator(OMRPortLibrary *portLib, char *fileName, UtTraceFil
 
 }
 
+/**
+ * Map a trace file written through memory mapped trace buffers and list the buffers
+ * that hold trace data, oldest first. The buffers are formatted in place; the mapping
+ * is copy on write because parsing a tracepoint briefly terminates its module name.
+ */
+static omr_error_t
+mapTraceFile(UtTraceFileIterator *iterator)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(iterator->portLib);
+	const uintptr_t headerSize = UT_MAPPED_HEADER_SIZE(iterator->header->header.length);
+	const uintptr_t stride = UT_MAPPED_BUFFER_STRIDE(iterator->header->bufferSize);
+
+	iterator->mappedFile = omrmmap_map_file(iterator->traceFileHandle, 0, 0, NULL, OMRPORT_MMAP_FLAG_COPYONWRITE, OMRMEM_CATEGORY_TRACE);
+	if (NULL == iterator->mappedFile) {
+		return OMR_ERROR_FILE_UNAVAILABLE;
+	}
+	if (iterator->mappedFile->size < headerSize) {
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	const uintptr_t bufferCount = (iterator->mappedFile->size - headerSize) / stride;
+	if (0 == bufferCount) {
+		return OMR_ERROR_NONE;
+	}
+	iterator->mappedBuffers = (OMR_TraceBuffer **)omrmem_allocate_memory(bufferCount * sizeof(OMR_TraceBuffer *), OMRMEM_CATEGORY_TRACE);
+	if (NULL == iterator->mappedBuffers) {
+		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+
+	/* Skip buffers that were never claimed, and buffers caught in the middle of being reset. */
+	uint8_t *buffers = (uint8_t *)iterator->mappedFile->pointer + headerSize;
+	for (uintptr_t i = 0; i < bufferCount; i++) {
+		OMR_TraceBuffer *buffer = (OMR_TraceBuffer *)(buffers + (i * stride));
+		const int32_t firstEntry = buffer->record.firstEntry;
+		const int32_t nextEntry = buffer->record.nextEntry;
+
+		if ((firstEntry > (int32_t)offsetof(UtTraceRecord, threadName))
+			&& (nextEntry > firstEntry)
+			&& (nextEntry < iterator->header->bufferSize)
+		) {
+			iterator->mappedBuffers[iterator->mappedBufferCount] = buffer;
+			iterator->mappedBufferCount += 1;
+		}
+	}
+	qsort(iterator->mappedBuffers, iterator->mappedBufferCount, sizeof(OMR_TraceBuffer *), compareMappedTraceBuffers);
+
+	UT_DBGOUT_CHECKED(2, ("<UT> mapTraceFile: %u of %zu mapped buffers hold trace data\n", iterator->mappedBufferCount, bufferCount));
+
+	return OMR_ERROR_NONE;
+}
+
+/**
+ * Order mapped trace buffers by the time they were claimed.
+ */
+static int
+compareMappedTraceBuffers(const void *left, const void *right)
+{
+	const uint64_t leftSequence = (*(OMR_TraceBuffer * const *)left)->record.wrapSequence;
+	const uint64_t rightSequence = (*(OMR_TraceBuffer * const *)right)->record.wrapSequence;
+
+	if (leftSequence < rightSequence) {
+		return -1;
+	} else if (leftSequence > rightSequence) {
+		return 1;
+	}
+	return 0;
+}
+
 /**
  * This frees a trace file iterator and closes the associated trace file.
  * Any UtTracePointIterators returned by this UtTraceFileIterator must be
@@ -162,6 +251,12 @@ omr_trc_freeTraceFileIterator(UtTraceFileIterator *iter)
 {
 	if (NULL != iter) {
 		OMRPORT_ACCESS_FROM_OMRPORT(iter->portLib);
+		if (NULL != iter->mappedBuffers) {
+			omrmem_free_memory(iter->mappedBuffers);
+		}
+		if (NULL != iter->mappedFile) {
+			omrmmap_unmap_file(iter->mappedFile);
+		}
 		omrfile_close(iter->traceFileHandle);
 		if (NULL != iter->header) {
 			omrmem_free_memory(iter->header);
@@ -195,27 +290,40 @@ omr_trc_getTracePointIteratorForNextBuffer(UtTraceFileIterator *fileIterator, Ut
 		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
 	}
 
-	iterator->buffer = (OMR_TraceBuffer *)omrmem_allocate_memory(
-			fileIterator->header->bufferSize + offsetof(OMR_TraceBuffer, record), OMRMEM_CATEGORY_TRACE);
-	if (iterator->buffer == NULL) {
-		UT_DBGOUT_CHECKED(1, ("<UT> trcGetTracePointIteratorForBuffer cannot allocate iterator's buffer\n"));
-		omrmem_free_memory(iterator);
-		*bufferIteratorPtr = NULL;
-		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
-	}
-
-	/* set up the iterator */
-	bytesRead = omrfile_read(fileIterator->traceFileHandle, &iterator->buffer->record, fileIterator->header->bufferSize);
-	if (fileIterator->header->bufferSize != bytesRead) {
-		omrmem_free_memory(iterator->buffer);
-		omrmem_free_memory(iterator);
-		*bufferIteratorPtr = NULL;
-		if (-1 == bytesRead) {
-			/* End of file, not an error! */
+	if (NULL != fileIterator->mappedFile) {
+		/* format the buffers of a mapped trace file where they are */
+		if (fileIterator->nextMappedBuffer >= fileIterator->mappedBufferCount) {
+			omrmem_free_memory(iterator);
+			*bufferIteratorPtr = NULL;
 			return OMR_ERROR_NONE;
-		} else {
-			/* Unexpectedly reached the end of the file. */
-			return OMR_ERROR_INTERNAL;
+		}
+		iterator->buffer = fileIterator->mappedBuffers[fileIterator->nextMappedBuffer];
+		iterator->bufferIsMapped = TRUE;
+		fileIterator->nextMappedBuffer += 1;
+	} else {
+		iterator->buffer = (OMR_TraceBuffer *)omrmem_allocate_memory(
+				fileIterator->header->bufferSize + offsetof(OMR_TraceBuffer, record), OMRMEM_CATEGORY_TRACE);
+		if (iterator->buffer == NULL) {
+			UT_DBGOUT_CHECKED(1, ("<UT> trcGetTracePointIteratorForBuffer cannot allocate iterator's buffer\n"));
+			omrmem_free_memory(iterator);
+			*bufferIteratorPtr = NULL;
+			return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+		iterator->bufferIsMapped = FALSE;
+
+		/* set up the iterator */
+		bytesRead = omrfile_read(fileIterator->traceFileHandle, &iterator->buffer->record, fileIterator->header->bufferSize);
+		if (fileIterator->header->bufferSize != bytesRead) {
+			omrmem_free_memory(iterator->buffer);
+			omrmem_free_memory(iterator);
+			*bufferIteratorPtr = NULL;
+			if (-1 == bytesRead) {
+				/* End of file, not an error! */
+				return OMR_ERROR_NONE;
+			} else {
+				/* Unexpectedly reached the end of the file. */
+				return OMR_ERROR_INTERNAL;
+			}
 		}
 	}
 
@@ -235,7 +343,8 @@ omr_trc_getTracePointIteratorForNextBuffer(UtTraceFileIterator *fileIterator, Ut
 	spanPlatform = iterator->endPlatform - iterator->startPlatform;
 	spanSystem = iterator->endSystem - iterator->startSystem;
 
-	iterator->timeConversion = spanPlatform / spanSystem;
+	/* a file formatted within a millisecond of the trace starting, as a mapped file can be, spans no system time */
+	iterator->timeConversion = (0 == spanSystem) ? 0 : (spanPlatform / spanSystem);
 	if (iterator->timeConversion == 0) {
 		/* this will be used as the divisor in formatting time stamps */
 		iterator->timeConversion = 1;
@@ -246,7 +355,10 @@ omr_trc_getTracePointIteratorForNextBuffer(UtTraceFileIterator *fileIterator, Ut
 #else
 	iterator->isBigEndian = TRUE;
 #endif
-	iterator->isCircularBuffer = TRUE;
+	/* Mapped trace buffers are never wrapped in place, a thread moves on to the next buffer in the file
+	 * when one fills. Anything past the end of the data is left over from an earlier use of the buffer.
+	 */
+	iterator->isCircularBuffer = !iterator->bufferIsMapped;
 	iterator->iteratorHasWrapped = FALSE;
 	iterator->processingIncompleteDueToPartialTracePoint = FALSE;
 	iterator->longTracePointLength = 0;
@@ -284,7 +396,9 @@ omr_trc_freeTracePointIterator(UtTracePointIterator *iter)
 {
 	if (iter != NULL) {
 		OMRPORT_ACCESS_FROM_OMRPORT(iter->portLib);
-		omrmem_free_memory(iter->buffer);
+		if (!iter->bufferIsMapped) {
+			omrmem_free_memory(iter->buffer);
+		}
 		UT_DBGOUT_CHECKED(2, ("<UT> trcFreeTracePointIterator freeing iterator %p\n", iter));
 		omrmem_free_memory(iter);
 	}
@@ -231,7 +231,17 @@ getTrcBuf(OMR_TraceThread *thr, OMR_TraceBuffer *oldBuf, int bufferType)
 		/* Null the thread reference as there's no guarantee it's valid after this point */
 		oldBuf->thr = NULL;
 
-		if (OMR_TRACEGLOBAL(traceInCore)) {
+		if (isMappedTraceBuffer(oldBuf)) {
+			/*
+			 *  The full buffer stays in the mapped file, move on to the next one
+			 */
+			if (OMR_TRACEGLOBAL(traceInCore)) {
+				thr->trcBuf = NULL;
+				releaseMappedTraceBuffer(oldBuf);
+			} else {
+				publishTraceBuffer(thr, oldBuf);
+			}
+		} else if (OMR_TRACEGLOBAL(traceInCore)) {
 			/*
 			 *  Incore trace mode so reuse existing buffer, wrapping to the top
 			 */
@@ -244,9 +254,13 @@ getTrcBuf(OMR_TraceThread *thr, OMR_TraceBuffer *oldBuf, int bufferType)
 	}
 
 	/*
-	 * Reuse buffer if there is one
+	 * Take the next buffer in the mapped trace file if there is one,
+	 * otherwise reuse buffer if there is one
 	 */
-	trcBuf = recycleTraceBuffer(thr);
+	trcBuf = claimMappedTraceBuffer();
+	if (trcBuf == NULL) {
+		trcBuf = recycleTraceBuffer(thr);
+	}
 
 	/*
 	 *  If no buffers, try to obtain one
@@ -373,8 +387,10 @@ copyToBuffer(OMR_TraceThread *thr,
 		while (remainder > 0) {
 			*trcBuf = getTrcBuf(thr, *trcBuf, bufferType);
 			if (*trcBuf != NULL) {
-				/* we're about to copy stuff into it so mark the buffer as not new so it can be queued */
-				VM_AtomicSupport::bitAndU32((volatile uint32_t *)(&(*trcBuf)->flags), ~UT_TRC_BUFFER_NEW);
+				/* we're about to copy stuff into it so mark the buffer as not new so it can be queued.
+				 * No atomic is needed, only the thread that owns an active buffer modifies its flags.
+				 */
+				(*trcBuf)->flags &= ~UT_TRC_BUFFER_NEW;
 				(*trcBuf)->thr = thr;
 
 				/* we need to update p and bufLeft irrespective of what happens next */
@@ -678,8 +694,12 @@ traceV(OMR_TraceThread *thr, UtModuleInfo *modInfo, uint32_t traceId, const char
 		return;
 	}
 
+	/*
+	 *  Only this thread modifies the flags of its active buffer, so the
+	 *  tracepoint fast path needs no atomics
+	 */
 	if (trcBuf->flags & UT_TRC_BUFFER_NEW) {
-		VM_AtomicSupport::bitAndU32((volatile uint32_t *)(&trcBuf->flags), ~UT_TRC_BUFFER_NEW);
+		trcBuf->flags &= ~UT_TRC_BUFFER_NEW;
 		trcBuf->thr = thr;
 	}
 	lastSequence = (int32_t)(trcBuf->record.sequence >> 32);
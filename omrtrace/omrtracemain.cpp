@@ -387,6 +387,8 @@ freeTrace(void)
 		global->serviceInfo = NULL;
 	}
 
+	closeMappedTraceFile(global);
+
 	if (NULL != global->traceHeader) {
 		omrmem_free_memory(global->traceHeader);
 		global->traceHeader = NULL;
@@ -499,6 +501,7 @@ initializeTrace(OMR_VM *vm, const char *datDir, const OMR_TraceLanguageInterface
 
 	tempGbl.dynamicBuffers = TRUE;
 	tempGbl.bufferSize = UT_DEFAULT_BUFFERSIZE;
+	tempGbl.mappedFileDescriptor = -1;
 
 	/* Make the trace functions available to the rest of OMR */
 	/* OMRTODO Remove this. GC uses it to register the module.
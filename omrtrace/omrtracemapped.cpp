@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <stddef.h>
+#include <string.h>
+
+#include "AtomicSupport.hpp"
+
+#include "omrtrace_internal.h"
+
+omr_error_t
+openMappedTraceFile(void)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(OMR_TRACEGLOBAL(portLibrary));
+	const char *fileName = OMR_TRACEGLOBAL(mappedFileName);
+
+	if (NULL == fileName) {
+		return OMR_ERROR_NONE;
+	}
+
+	/* The trace file header goes at the start of the file, the same as for trace files written by
+	 * subscribers, followed by the trace buffers in the layout they have in memory.
+	 */
+	omr_error_t rc = initTraceHeader();
+	if (OMR_ERROR_NONE != rc) {
+		return rc;
+	}
+	UtTraceFileHdr *traceHeader = OMR_TRACEGLOBAL(traceHeader);
+	const uintptr_t headerSize = UT_MAPPED_HEADER_SIZE(traceHeader->header.length);
+	const uintptr_t stride = UT_MAPPED_BUFFER_STRIDE(OMR_TRACEGLOBAL(bufferSize));
+	uint64_t bufferCount = 0;
+	if (OMR_TRACEGLOBAL(mappedFileSize) > headerSize) {
+		bufferCount = (OMR_TRACEGLOBAL(mappedFileSize) - headerSize) / stride;
+	}
+	if (bufferCount < UT_MINIMUM_MAPPED_BUFFERS) {
+		bufferCount = UT_MINIMUM_MAPPED_BUFFERS;
+	} else if (bufferCount > UINT32_MAX) {
+		bufferCount = UINT32_MAX;
+	}
+	const uintptr_t fileSize = (uintptr_t)(headerSize + (bufferCount * stride));
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		UT_DBGOUT(1, ("<UT> Unable to open mapped trace file %s\n", fileName));
+		return OMR_ERROR_FILE_UNAVAILABLE;
+	}
+	if (0 != omrfile_set_length(fd, (int64_t)fileSize)) {
+		UT_DBGOUT(1, ("<UT> Unable to extend mapped trace file %s to %zu bytes\n", fileName, fileSize));
+		omrfile_close(fd);
+		return OMR_ERROR_FILE_UNAVAILABLE;
+	}
+	J9MmapHandle *handle = omrmmap_map_file(fd, 0, fileSize, fileName, OMRPORT_MMAP_FLAG_WRITE | OMRPORT_MMAP_FLAG_SHARED, OMRMEM_CATEGORY_TRACE);
+	if (NULL == handle) {
+		UT_DBGOUT(1, ("<UT> Unable to map trace file %s\n", fileName));
+		omrfile_close(fd);
+		return OMR_ERROR_FILE_UNAVAILABLE;
+	}
+
+	/* The extended file reads as zeros, so every trace buffer starts out unclaimed and empty. */
+	uint8_t *mapping = (uint8_t *)handle->pointer;
+	memcpy(mapping, traceHeader, traceHeader->header.length);
+	((UtTraceSection *)(mapping + traceHeader->traceStart))->type = UT_TRACE_MAPPED;
+
+	OMR_TRACEGLOBAL(mappedFileDescriptor) = fd;
+	OMR_TRACEGLOBAL(mappedFileHandle) = handle;
+	OMR_TRACEGLOBAL(mappedBuffers) = mapping + headerSize;
+	OMR_TRACEGLOBAL(mappedBufferStride) = stride;
+	OMR_TRACEGLOBAL(mappedBufferCursor) = 0;
+	VM_AtomicSupport::writeBarrier();
+	OMR_TRACEGLOBAL(mappedBufferCount) = (uint32_t)bufferCount;
+
+	UT_DBGOUT(1, ("<UT> Mapped trace file %s with %u buffers of %d bytes\n", fileName, (uint32_t)bufferCount, OMR_TRACEGLOBAL(bufferSize)));
+	return OMR_ERROR_NONE;
+}
+
+void
+closeMappedTraceFile(OMR_TraceGlobal *global)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(global->portLibrary);
+
+	if (NULL != global->mappedFileHandle) {
+		global->mappedBufferCount = 0;
+		omrmmap_msync(global->mappedFileHandle->pointer, global->mappedFileHandle->size, OMRPORT_MMAP_SYNC_WAIT);
+		omrmmap_unmap_file(global->mappedFileHandle);
+		omrfile_close(global->mappedFileDescriptor);
+		global->mappedFileHandle = NULL;
+		global->mappedBuffers = NULL;
+		global->mappedFileDescriptor = -1;
+	}
+
+	if (NULL != global->mappedFileName) {
+		omrmem_free_memory(global->mappedFileName);
+		global->mappedFileName = NULL;
+	}
+}
+
+OMR_TraceBuffer *
+claimMappedTraceBuffer(void)
+{
+	const uint32_t bufferCount = OMR_TRACEGLOBAL(mappedBufferCount);
+
+	/* Take the buffers in turn so that the one claimed is the one holding the oldest data.
+	 * Buffers still held by other threads, or still being read by subscribers, are skipped.
+	 */
+	for (uint32_t attempt = 0; attempt < bufferCount; attempt++) {
+		const uint32_t index = (VM_AtomicSupport::addU32(&OMR_TRACEGLOBAL(mappedBufferCursor), 1) - 1) % bufferCount;
+		OMR_TraceBuffer *buf = (OMR_TraceBuffer *)(OMR_TRACEGLOBAL(mappedBuffers) + (index * OMR_TRACEGLOBAL(mappedBufferStride)));
+		const uint32_t oldFlags = buf->flags;
+
+		if (0 == (oldFlags & (UT_TRC_BUFFER_ACTIVE | UT_TRC_BUFFER_PUBLISHING))) {
+			if (oldFlags == VM_AtomicSupport::lockCompareExchangeU32(&buf->flags, oldFlags, UT_TRC_BUFFER_ACTIVE | UT_TRC_BUFFER_NEW)) {
+				return buf;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+void
+releaseMappedTraceBuffer(OMR_TraceBuffer *buf)
+{
+	const uint32_t oldFlags = buf->flags;
+	uint32_t newFlags = 0;
+
+	if ((oldFlags & UT_TRC_BUFFER_FULL) || ((oldFlags & UT_TRC_BUFFER_ACTIVE) && !(oldFlags & UT_TRC_BUFFER_NEW))) {
+		newFlags = UT_TRC_BUFFER_FULL;
+	}
+	buf->next = NULL;
+	buf->thr = NULL;
+
+	/* Another thread may claim the buffer as soon as it is neither active nor being published. */
+	VM_AtomicSupport::writeBarrier();
+	buf->flags = newFlags;
+}
+
+BOOLEAN
+isMappedTraceBuffer(OMR_TraceBuffer *buf)
+{
+	const uint8_t *mappedBuffers = OMR_TRACEGLOBAL(mappedBuffers);
+
+	return (NULL != mappedBuffers)
+		&& ((uint8_t *)buf >= mappedBuffers)
+		&& ((uint8_t *)buf < (mappedBuffers + (OMR_TRACEGLOBAL(mappedBufferCount) * OMR_TRACEGLOBAL(mappedBufferStride))));
+}
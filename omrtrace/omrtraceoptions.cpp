@@ -61,6 +61,7 @@ static omr_error_t setException(OMR_TraceThread *thr, const char *value, BOOLEAN
 static omr_error_t setOutput(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
 #endif /* OMR_ALLOW_OUTPUT_OPTION */
 static omr_error_t setBuffers(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
+static omr_error_t setMappedFile(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
 static omr_error_t setSuspendResumeCount(OMR_TraceThread *thr, const char *value, int32_t resume, BOOLEAN atRuntime);
 static omr_error_t processSuspendOption(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
 static omr_error_t processResumeOption(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime);
@@ -94,6 +95,7 @@ const OMR_TraceOption UTE_OPTIONS[] = {
 	{UT_OUTPUT_KEYWORD, FALSE, setOutput},
 #endif /* OMR_ALLOW_OUTPUT_OPTION */
 	{UT_BUFFERS_KEYWORD, TRUE, setBuffers}, /* Not all buffers functions are exposed - but are controlled in the set function*/
+	{UT_MAPPED_FILE_KEYWORD, FALSE, setMappedFile},
 	{UT_SUSPEND_KEYWORD, TRUE, processSuspendOption},
 	{UT_RESUME_KEYWORD, TRUE, processResumeOption},
 	{UT_RESUME_COUNT_KEYWORD, TRUE, processResumeOption},
@@ -140,13 +142,18 @@ addTraceCmd(OMR_TraceThread *thr, const char *cmd, const char *value, BOOLEAN at
 	return rc;
 }
 
+/*******************************************************************************
+ * name        - parseMemorySize
+ * description - Parse a size option value of the form nnn, nnnk or nnnm
+ * parameters  - string value, length of the value, the parsed size, option name, atRuntime
+ * returns     - UTE return code
+ ******************************************************************************/
 static omr_error_t
-parseBufferSize(const char *const str, const int argSize, BOOLEAN atRuntime)
+parseMemorySize(const char *const str, const int argSize, int64_t *size, const char *optionName, BOOLEAN atRuntime)
 {
 	/* It's either invalid input or a number with an optional suffix
 	 * Find the position of the first digit and non-digit character.
 	 */
-	int32_t newBufferSize;
 	intptr_t firstNonDigit = -1;
 	intptr_t firstDigit = -1;
 	const char *p = str;
@@ -168,7 +175,7 @@ parseBufferSize(const char *const str, const int argSize, BOOLEAN atRuntime)
 	/* The only valid place for a non-digit is the final character */
 	if (firstNonDigit != -1) {
 		if (firstNonDigit == (argSize - 1) && firstDigit != -1) {
-			int multiplier = 1;
+			int64_t multiplier = 1;
 			switch (j9_cmdla_toupper(str[argSize - 1])) {
 			case 'K':
 				multiplier = 1024;
@@ -177,26 +184,39 @@ parseBufferSize(const char *const str, const int argSize, BOOLEAN atRuntime)
 				multiplier = 1024 * 1024;
 				break;
 			default:
-				reportCommandLineError(atRuntime, "Unrecognised suffix %c specified for buffer size", str[argSize - 1]);
+				reportCommandLineError(atRuntime, "Unrecognised suffix %c specified for %s size", str[argSize - 1], optionName);
 				return OMR_ERROR_ILLEGAL_ARGUMENT;
 			}
 
-			newBufferSize = atoi(str) * multiplier;
+			*size = atoi(str) * multiplier;
 		} else {
 			/* Invalid */
-			reportCommandLineError(atRuntime, "Invalid option for -Xtrace:buffers - \"%s\"", str);
+			reportCommandLineError(atRuntime, "Invalid option for -Xtrace:%s - \"%s\"", optionName, str);
 			return OMR_ERROR_ILLEGAL_ARGUMENT;
 		}
 	} else {
 		/* The string contains no non-digits */
-		newBufferSize = atoi(str);
+		*size = atoi(str);
+	}
+
+	return OMR_ERROR_NONE;
+}
+
+static omr_error_t
+parseBufferSize(const char *const str, const int argSize, BOOLEAN atRuntime)
+{
+	int64_t newBufferSize = 0;
+	omr_error_t rc = parseMemorySize(str, argSize, &newBufferSize, "buffers", atRuntime);
+
+	if (OMR_ERROR_NONE != rc) {
+		return rc;
 	}
 
 	if (newBufferSize < UT_MINIMUM_BUFFERSIZE) {
-		reportCommandLineError(atRuntime, "Specified buffer size %d bytes is too small. Minimum is %d bytes.", newBufferSize, UT_MINIMUM_BUFFERSIZE);
+		reportCommandLineError(atRuntime, "Specified buffer size %d bytes is too small. Minimum is %d bytes.", (int32_t)newBufferSize, UT_MINIMUM_BUFFERSIZE);
 		return OMR_ERROR_ILLEGAL_ARGUMENT;
 	} else {
-		OMR_TRACEGLOBAL(bufferSize) = newBufferSize;
+		OMR_TRACEGLOBAL(bufferSize) = (int32_t)newBufferSize;
 	}
 
 	return OMR_ERROR_NONE;
@@ -271,6 +291,75 @@ end:
 	return rc;
 }
 
+/*******************************************************************************
+ * name        - setMappedFile
+ * description - Allocate trace buffers in a memory mapped file
+ * parameters  - thr, string value of the property (filename[,nnnk|nnnm]), atRuntime
+ * returns     - UTE return code
+ ******************************************************************************/
+static omr_error_t
+setMappedFile(OMR_TraceThread *thr, const char *value, BOOLEAN atRuntime)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+	const int numberOfArgs = getParmNumber(value);
+	int64_t fileSize = UT_DEFAULT_MAPPED_FILE_SIZE;
+	char *fileName = NULL;
+	int argSize = 0;
+	const char *startOfThisArg = NULL;
+
+	OMRPORT_ACCESS_FROM_OMRPORT(OMR_TRACEGLOBAL(portLibrary));
+
+	if ((NULL == value) || (numberOfArgs < 1) || (numberOfArgs > 2)) {
+		reportCommandLineError(atRuntime, "-Xtrace:mappedfile expects a file name and an optional file size.");
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+
+	startOfThisArg = getPositionalParm(1, value, &argSize);
+	if (0 == argSize) {
+		reportCommandLineError(atRuntime, "Empty file name passed to -Xtrace:mappedfile");
+		return OMR_ERROR_ILLEGAL_ARGUMENT;
+	}
+	fileName = (char *)omrmem_allocate_memory(argSize + 1, OMRMEM_CATEGORY_TRACE);
+	if (NULL == fileName) {
+		UT_DBGOUT(1, ("<UT> Out of memory in setMappedFile\n"));
+		return OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+	strncpy(fileName, startOfThisArg, argSize);
+	fileName[argSize] = '\0';
+
+	if (2 == numberOfArgs) {
+		char sizeBuffer[32];
+
+		startOfThisArg = getPositionalParm(2, value, &argSize);
+		if ((0 == argSize) || (argSize >= (int)sizeof(sizeBuffer))) {
+			reportCommandLineError(atRuntime, "Invalid file size passed to -Xtrace:mappedfile");
+			rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+			goto end;
+		}
+		strncpy(sizeBuffer, startOfThisArg, argSize);
+		sizeBuffer[argSize] = '\0';
+		rc = parseMemorySize(sizeBuffer, argSize, &fileSize, "mappedfile", atRuntime);
+		if (OMR_ERROR_NONE != rc) {
+			goto end;
+		}
+	}
+
+	if (NULL != OMR_TRACEGLOBAL(mappedFileName)) {
+		omrmem_free_memory(OMR_TRACEGLOBAL(mappedFileName));
+	}
+	OMR_TRACEGLOBAL(mappedFileName) = fileName;
+	OMR_TRACEGLOBAL(mappedFileSize) = (uint64_t)fileSize;
+	fileName = NULL;
+
+	UT_DBGOUT(1, ("<UT> Mapped trace file: %s, %lld bytes\n", OMR_TRACEGLOBAL(mappedFileName), fileSize));
+
+end:
+	if (NULL != fileName) {
+		omrmem_free_memory(fileName);
+	}
+	return rc;
+}
+
 /*******************************************************************************
  * name        - setMinimal
  * description - Set the minimal trace options
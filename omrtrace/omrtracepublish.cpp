@@ -25,6 +25,8 @@
 #include "omrtrace_internal.h"
 #include "thread_api.h"
 
+static void pushFreeTraceBuffer(OMR_TraceBuffer *buf);
+
 omr_error_t
 publishTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 {
@@ -45,7 +47,10 @@ publishTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 
 	/* only publish a buffer if data has been written to it */
 	if ((bufFlags & UT_TRC_BUFFER_ACTIVE) && !(bufFlags & UT_TRC_BUFFER_NEW)) {
-		const uint32_t newFlags = (bufFlags & (~(UT_TRC_BUFFER_ACTIVE | UT_TRC_BUFFER_NEW))) | UT_TRC_BUFFER_FULL;
+		/* Keep the buffer from being claimed by another thread until the subscribers are done with
+		 * it and it has been released.
+		 */
+		const uint32_t newFlags = (bufFlags & (~(UT_TRC_BUFFER_ACTIVE | UT_TRC_BUFFER_NEW))) | UT_TRC_BUFFER_FULL | UT_TRC_BUFFER_PUBLISHING;
 		/* CAS is not needed because flags is modified only by the thread that owns the buffer */
 		buf->flags = newFlags;
 
@@ -97,10 +102,14 @@ releaseTraceBuffer(OMR_TraceThread *currentThr, OMR_TraceBuffer *buf)
 		buf->thr->trcBuf = NULL;
 	}
 
-	omrthread_monitor_enter(OMR_TRACEGLOBAL(freeQueueLock));
-	buf->next = OMR_TRACEGLOBAL(freeQueue);
-	OMR_TRACEGLOBAL(freeQueue) = buf;
-	omrthread_monitor_exit(OMR_TRACEGLOBAL(freeQueueLock));
+	if (isMappedTraceBuffer(buf)) {
+		/* the buffer goes back to the mapped trace file, not the free queue */
+		releaseMappedTraceBuffer(buf);
+		decrementRecursionCounter(currentThr);
+		return OMR_ERROR_NONE;
+	}
+
+	pushFreeTraceBuffer(buf);
 
 	decrementRecursionCounter(currentThr);
 	return OMR_ERROR_NONE;
@@ -111,14 +120,43 @@ recycleTraceBuffer(OMR_TraceThread *currentThr)
 {
 	incrementRecursionCounter(currentThr);
 
+	/* Pops are serialized by freeQueueLock while pushes stay lock-free. The head can then only
+	 * change under a pop by buffers being pushed on top of it, which the compare-and-swap detects;
+	 * it cannot be popped and pushed again in the meantime (ABA), as that takes a second pop.
+	 */
 	omrthread_monitor_enter(OMR_TRACEGLOBAL(freeQueueLock));
 	OMR_TraceBuffer *recycledBuf = OMR_TRACEGLOBAL(freeQueue);
-	if (recycledBuf) {
-		OMR_TRACEGLOBAL(freeQueue) = recycledBuf->next;
-		recycledBuf->next = NULL;
+	while (NULL != recycledBuf) {
+		OMR_TraceBuffer *result = (OMR_TraceBuffer *)VM_AtomicSupport::lockCompareExchange((volatile uintptr_t *)&OMR_TRACEGLOBAL(freeQueue), (uintptr_t)recycledBuf, (uintptr_t)recycledBuf->next);
+		if (result == recycledBuf) {
+			recycledBuf->next = NULL;
+			break;
+		}
+		recycledBuf = result;
 	}
 	omrthread_monitor_exit(OMR_TRACEGLOBAL(freeQueueLock));
 
 	decrementRecursionCounter(currentThr);
 	return recycledBuf;
 }
+
+/**
+ * Push a free buffer onto the free queue. Pushing is safe with a
+ * compare-and-swap because the buffer being pushed is owned by the caller.
+ *
+ * @param[in] buf the buffer to push
+ */
+static void
+pushFreeTraceBuffer(OMR_TraceBuffer *buf)
+{
+	OMR_TraceBuffer *oldHead = OMR_TRACEGLOBAL(freeQueue);
+
+	for (;;) {
+		buf->next = oldHead;
+		OMR_TraceBuffer *result = (OMR_TraceBuffer *)VM_AtomicSupport::lockCompareExchange((volatile uintptr_t *)&OMR_TRACEGLOBAL(freeQueue), (uintptr_t)oldHead, (uintptr_t)buf);
+		if (result == oldHead) {
+			break;
+		}
+		oldHead = result;
+	}
+}
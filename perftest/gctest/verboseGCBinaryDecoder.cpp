@@ -0,0 +1,235 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <string.h>
+#include <map>
+#include <string>
+
+#include "verboseGCBinaryDecoder.hpp"
+
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseManagerBase.hpp"
+
+/**
+ * How a binary record maps back onto the XML verbose GC format.
+ */
+typedef struct BinaryEventDescription {
+	const char *elementName; /**< element name in the XML verbose log */
+	const char *fieldNames[VERBOSE_BINARY_MAX_FIELDS]; /**< attribute name of each field */
+	uint32_t microsecondFieldMask; /**< fields printed as milliseconds with three decimals */
+	uint32_t booleanFieldMask; /**< fields printed as true/false */
+	const char *childName; /**< nested element holding the trailing fields, or NULL */
+	uintptr_t childFirstField; /**< index of the first field written to childName */
+} BinaryEventDescription;
+
+/* indexed by VerboseBinaryEventType; field order documented in VerboseBinaryFormat.hpp */
+static const BinaryEventDescription eventDescriptions[VERBOSE_BINARY_EVENT_COUNT] = {
+	{ "string", { "id" }, 0, 0, NULL, 0 },
+	{ "cycle-start", { "id", "type", "contextid", "intervalms" }, 0x8, 0, NULL, 0 },
+	{ "cycle-end", { "id", "type", "contextid" }, 0, 0, NULL, 0 },
+	{ "exclusive-start", { "id", "intervalms", "timems", "idlems", "threads" }, 0xE, 0, "response-info", 2 },
+	{ "exclusive-end", { "id", "durationms" }, 0x2, 0, NULL, 0 },
+	{ "sys-start", { "id", "reason", "intervalms" }, 0x4, 0, NULL, 0 },
+	{ "sys-end", { "id" }, 0, 0, NULL, 0 },
+	{ "af-start", { "id", "totalBytesRequested", "intervalms" }, 0x4, 0, NULL, 0 },
+	{ "af-end", { "id", "success" }, 0, 0x2, NULL, 0 },
+	{ "gc-start", { "id", "type", "contextid", "free", "total" }, 0, 0, "mem-info", 3 },
+	{ "gc-end", { "id", "type", "contextid", "durationms", "usertimems", "systemtimems", "stalltimems", "activeThreads", "free", "total" }, 0x78, 0, "mem-info", 8 },
+	{ "gc-op", { "id", "type", "contextid", "timems" }, 0x8, 0, NULL, 0 },
+	{ "heap-resize", { "id", "type", "space", "amount", "count", "timems", "reason" }, 0x20, 0, NULL, 0 },
+};
+
+static bool
+readFileHeader(FILE *input, VerboseBinaryFileHeader *header)
+{
+	return (1 == fread(header, sizeof(*header), 1, input))
+		&& (0 == memcmp(header->magic, VERBOSE_BINARY_MAGIC, sizeof(VERBOSE_BINARY_MAGIC)));
+}
+
+static void
+formatTimestamp(OMRPortLibrary *portLibrary, char *buf, uintptr_t bufsize, uint64_t wallTimeMs)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uintptr_t bufPos = 0;
+	bufPos += omrstr_ftime(buf, bufsize, VERBOSEGC_DATE_FORMAT_PRE_MS, wallTimeMs);
+	bufPos += omrstr_printf(buf + bufPos, bufsize - bufPos, "%03llu", wallTimeMs % 1000);
+	omrstr_ftime(buf + bufPos, bufsize - bufPos, VERBOSEGC_DATE_FORMAT_POST_MS, wallTimeMs);
+}
+
+static void
+formatField(char *buf, size_t bufsize, const BinaryEventDescription *description, uintptr_t index, uint32_t stringFieldMask, uint64_t value, std::map<uint64_t, std::string> &strings)
+{
+	uint32_t bit = (uint32_t)1 << index;
+	if (0 != (stringFieldMask & bit)) {
+		snprintf(buf, bufsize, "%s", strings[value].c_str());
+	} else if (0 != (description->microsecondFieldMask & bit)) {
+		snprintf(buf, bufsize, "%llu.%03llu", (unsigned long long)(value / 1000), (unsigned long long)(value % 1000));
+	} else if (0 != (description->booleanFieldMask & bit)) {
+		snprintf(buf, bufsize, "%s", (0 != value) ? "true" : "false");
+	} else {
+		snprintf(buf, bufsize, "%llu", (unsigned long long)value);
+	}
+}
+
+static void
+outputXML(FILE *output, const BinaryEventDescription *description, const VerboseBinaryRecordHeader *header, const uint64_t *fields, const char *timestamp, std::map<uint64_t, std::string> &strings)
+{
+	char value[256];
+	uintptr_t childFirstField = header->fieldCount;
+	if ((NULL != description->childName) && (description->childFirstField < header->fieldCount)) {
+		childFirstField = description->childFirstField;
+	}
+
+	fprintf(output, "<%s", description->elementName);
+	for (uintptr_t i = 0; i < childFirstField; i++) {
+		const char *name = (NULL != description->fieldNames[i]) ? description->fieldNames[i] : "field";
+		formatField(value, sizeof(value), description, i, header->stringFieldMask, fields[i], strings);
+		fprintf(output, " %s=\"%s\"", name, value);
+	}
+	fprintf(output, " timestamp=\"%s\"", timestamp);
+
+	if (childFirstField < header->fieldCount) {
+		fprintf(output, ">\n  <%s", description->childName);
+		for (uintptr_t i = childFirstField; i < header->fieldCount; i++) {
+			const char *name = (NULL != description->fieldNames[i]) ? description->fieldNames[i] : "field";
+			formatField(value, sizeof(value), description, i, header->stringFieldMask, fields[i], strings);
+			fprintf(output, " %s=\"%s\"", name, value);
+		}
+		fprintf(output, " />\n</%s>\n", description->elementName);
+	} else {
+		fprintf(output, " />\n");
+	}
+}
+
+static void
+outputCSV(FILE *output, const BinaryEventDescription *description, const VerboseBinaryRecordHeader *header, const uint64_t *fields, const char *timestamp, std::map<uint64_t, std::string> &strings)
+{
+	char value[256];
+	for (uintptr_t i = 1; i < header->fieldCount; i++) {
+		const char *name = (NULL != description->fieldNames[i]) ? description->fieldNames[i] : "field";
+		formatField(value, sizeof(value), description, i, header->stringFieldMask, fields[i], strings);
+		fprintf(output, "%s,%s,%llu,%s,%s\n", description->elementName, timestamp, (unsigned long long)fields[0], name, value);
+	}
+}
+
+bool
+isVerboseGCBinaryFile(const char *fileName)
+{
+	VerboseBinaryFileHeader header;
+	bool result = false;
+	FILE *input = fopen(fileName, "rb");
+	if (NULL != input) {
+		result = readFileHeader(input, &header);
+		fclose(input);
+	}
+	return result;
+}
+
+int32_t
+decodeVerboseGCBinary(OMRPortLibrary *portLibrary, const char *fileName, FILE *output, bool csv)
+{
+	int32_t rc = 0;
+	VerboseBinaryFileHeader fileHeader;
+	VerboseBinaryRecordHeader header;
+	uint64_t fields[VERBOSE_BINARY_MAX_FIELDS];
+	std::map<uint64_t, std::string> strings;
+	uintptr_t skippedRecords = 0;
+	char timestamp[64];
+
+	FILE *input = fopen(fileName, "rb");
+	if (NULL == input) {
+		fprintf(stderr, "Failed to open %s\n", fileName);
+		return -1;
+	}
+
+	if (!readFileHeader(input, &fileHeader)) {
+		fprintf(stderr, "%s is not a binary verbose GC log\n", fileName);
+		rc = -1;
+		goto done;
+	}
+	if (VERBOSE_BINARY_BYTE_ORDER_MARK != fileHeader.byteOrderMark) {
+		fprintf(stderr, "%s was written on a machine with a different byte order\n", fileName);
+		rc = -1;
+		goto done;
+	}
+	if (VERBOSE_BINARY_VERSION < fileHeader.version) {
+		fprintf(stderr, "%s has version %u, newer than the supported version %u; unknown records are skipped\n", fileName, fileHeader.version, VERBOSE_BINARY_VERSION);
+	}
+	fseek(input, fileHeader.headerSize, SEEK_SET);
+
+	if (csv) {
+		fprintf(output, "event,timestamp,id,field,value\n");
+	} else {
+		formatTimestamp(portLibrary, timestamp, sizeof(timestamp), fileHeader.startTimeMs);
+		fprintf(output, "<?xml version=\"1.0\" ?>\n\n<verbosegc version=\"binary-%u\" timestamp=\"%s\">\n\n", fileHeader.version, timestamp);
+	}
+
+	while (1 == fread(&header, sizeof(header), 1, input)) {
+		size_t fieldBytes = header.fieldCount * sizeof(uint64_t);
+		if ((VERBOSE_BINARY_MAX_FIELDS < header.fieldCount)
+			|| ((sizeof(header) + fieldBytes) > header.size)
+			|| ((0 != fieldBytes) && (1 != fread(fields, fieldBytes, 1, input)))
+		) {
+			fprintf(stderr, "Malformed record at offset %ld in %s\n", ftell(input), fileName);
+			rc = -1;
+			break;
+		}
+		size_t payloadBytes = header.size - sizeof(header) - fieldBytes;
+
+		if (VERBOSE_BINARY_EVENT_STRING == header.type) {
+			std::string value(payloadBytes, '\0');
+			if ((0 != payloadBytes) && (1 != fread(&value[0], payloadBytes, 1, input))) {
+				fprintf(stderr, "Truncated string record in %s\n", fileName);
+				rc = -1;
+				break;
+			}
+			value.resize(strlen(value.c_str()));
+			strings[fields[0]] = value;
+			continue;
+		}
+
+		fseek(input, (long)payloadBytes, SEEK_CUR);
+		if ((VERBOSE_BINARY_EVENT_COUNT <= header.type) || (0 == header.fieldCount)) {
+			skippedRecords += 1;
+			continue;
+		}
+
+		formatTimestamp(portLibrary, timestamp, sizeof(timestamp), header.timestampMs);
+		if (csv) {
+			outputCSV(output, &eventDescriptions[header.type], &header, fields, timestamp, strings);
+		} else {
+			outputXML(output, &eventDescriptions[header.type], &header, fields, timestamp, strings);
+		}
+	}
+
+	if (!csv) {
+		fprintf(output, "\n</verbosegc>\n");
+	}
+	if (0 != skippedRecords) {
+		fprintf(stderr, "Skipped %zu records of unknown type in %s\n", (size_t)skippedRecords, fileName);
+	}
+
+done:
+	fclose(input);
+	return rc;
+}
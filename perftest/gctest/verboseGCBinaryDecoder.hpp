@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#if !defined(VERBOSEGCBINARYDECODER_HPP_)
+#define VERBOSEGCBINARYDECODER_HPP_
+
+#include <stdio.h>
+
+#include "omrport.h"
+
+/**
+ * Determine whether a file starts with the binary verbose GC file header (-Xgc:binaryLogging).
+ * @param fileName[in] the file to check
+ * @return true if the file is a binary verbose GC log
+ */
+bool isVerboseGCBinaryFile(const char *fileName);
+
+/**
+ * Convert a binary verbose GC log to the XML verbose GC format or to CSV.
+ * The XML output uses the element and attribute names of the XML verbose log so it can be
+ * analyzed with the same xpath queries.  The CSV output has one row per event field:
+ * event,timestamp,id,field,value
+ * @param portLibrary[in] the port library
+ * @param fileName[in] the binary log to decode
+ * @param output[in] the stream to write to
+ * @param csv[in] true to write CSV, false to write XML
+ * @return 0 on success, non-zero if the file could not be read or is malformed
+ */
+int32_t decodeVerboseGCBinary(OMRPortLibrary *portLibrary, const char *fileName, FILE *output, bool csv);
+
+#endif /* VERBOSEGCBINARYDECODER_HPP_ */
@@ -33,6 +33,8 @@
 #include "omrport.h"
 #include "omrthread.h"
 
+#include "verboseGCBinaryDecoder.hpp"
+
 const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
 const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
 const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
@@ -43,7 +45,12 @@ const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
 double getAvg(std::vector<double> v);
 void analyze(char* fileName, OMRPortLibrary portLibrary);
 
-int main(void)
+/**
+ * With no arguments, analyze every VerboseGC* XML log in the current directory.
+ * With "-decode <file> [-csv] [-o <output>]", convert a binary verbose GC log (-Xgc:binaryLogging)
+ * to XML, or to CSV, on stdout or the given output file.
+ */
+int main(int argc, char **argv)
 {
 	int32_t totalFiles = 0;
 	intptr_t rc = 0;
@@ -66,6 +73,42 @@ int main(void)
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
 
+	if ((argc > 1) && (0 == strcmp(argv[1], "-decode"))) {
+		const char *inputFileName = NULL;
+		const char *outputFileName = NULL;
+		bool csv = false;
+		for (int i = 2; i < argc; i++) {
+			if (0 == strcmp(argv[i], "-csv")) {
+				csv = true;
+			} else if ((0 == strcmp(argv[i], "-o")) && ((i + 1) < argc)) {
+				outputFileName = argv[++i];
+			} else {
+				inputFileName = argv[i];
+			}
+		}
+		if (NULL == inputFileName) {
+			fprintf(stderr, "usage: %s -decode <binary verbose GC log> [-csv] [-o <output file>]\n", argv[0]);
+			rc = -1;
+		} else {
+			FILE *output = stdout;
+			if (NULL != outputFileName) {
+				output = fopen(outputFileName, "w");
+			}
+			if (NULL == output) {
+				fprintf(stderr, "Failed to open %s\n", outputFileName);
+				rc = -1;
+			} else {
+				rc = decodeVerboseGCBinary(&portLibrary, inputFileName, output, csv);
+				if (stdout != output) {
+					fclose(output);
+				}
+			}
+		}
+		portLibrary.port_shutdown_library(&portLibrary);
+		omrthread_detach(NULL);
+		return (int)rc;
+	}
+
 	rcFile = handle = omrfile_findfirst(SRC_DIR, resultBuffer);
 
 	if(rcFile == (uintptr_t)-1) {
@@ -74,7 +117,7 @@ int main(void)
 	}
 
 	while ((uintptr_t)-1 != rcFile) {
-		if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
+		if ((strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) && !isVerboseGCBinaryFile(resultBuffer)) {
 			analyze(resultBuffer, portLibrary);
 			totalFiles++;
 			/* Clean up verbose log file */
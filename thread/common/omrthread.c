@@ -79,6 +79,11 @@ static void unblock_spinlock_threads(omrthread_t self, omrthread_monitor_t monit
 #endif /* !defined(OMR_THR_MCS_LOCKS) */
 #endif /* OMR_THR_THREE_TIER_LOCKING */
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+static intptr_t monitor_enter_futex(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable);
+static void monitor_release_futex(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN monitorLocked);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 static intptr_t init_threadParam(char *name, uintptr_t *pDefault);
 static intptr_t init_spinParameters(omrthread_library_t lib);
 
@@ -480,6 +485,18 @@ omrthread_lib_control(const char *key, uintptr_t value)
 	}
 #endif /* defined(LINUX) || defined(OSX) */
 
+	if (0 == strcmp(J9THREAD_LIB_CONTROL_USE_FUTEX_MONITORS, key)) {
+#if defined(OMR_THR_FUTEX_MONITORS)
+		if (J9THREAD_LIB_CONTROL_USE_FUTEX_MONITORS_ENABLED == value) {
+			omrthread_lib_set_flags(J9THREAD_LIB_FLAG_FUTEX_MONITORS_ENABLED);
+			rc = 0;
+		} else if (J9THREAD_LIB_CONTROL_USE_FUTEX_MONITORS_DISABLED == value) {
+			omrthread_lib_clear_flags(J9THREAD_LIB_FLAG_FUTEX_MONITORS_ENABLED);
+			rc = 0;
+		}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+	}
+
 	return rc;
 }
 
@@ -648,6 +665,17 @@ init_spinParameters(omrthread_library_t lib)
 	if (init_threadParam("adaptSpinSampleCountStopRatio", &lib->adaptSpinSampleCountStopRatio)) {
 		return -1;
 	}
+
+	lib->adaptSpinTuneHoldtime = OMRTHREAD_ADAPT_SPIN_TUNE_HOLDTIME;
+	if (init_threadParam("adaptSpinTuneHoldtime", &lib->adaptSpinTuneHoldtime)) {
+		return -1;
+	}
+
+	/* 0 means OMRTHREAD_ADAPT_SPIN_TUNE_MAX_RATIO times defaultMonitorSpinCount3 */
+	lib->adaptSpinTuneMaxSpinCount3 = 0;
+	if (init_threadParam("adaptSpinTuneMaxSpinCount3", &lib->adaptSpinTuneMaxSpinCount3)) {
+		return -1;
+	}
 #endif
 
 #if (defined(OMR_THR_YIELD_ALG))
@@ -3747,6 +3775,11 @@ monitor_init(omrthread_monitor_t monitor, uintptr_t flags, omrthread_library_t l
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 	monitor->spinThreads = 0;
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (OMR_ARE_ALL_BITS_SET(lib->flags, J9THREAD_LIB_FLAG_FUTEX_MONITORS_ENABLED)) {
+		monitor->flags |= J9THREAD_MONITOR_FUTEX;
+	}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 
 	ASSERT(monitor->spinCount1 != 0);
 	ASSERT(monitor->spinCount2 != 0);
@@ -3991,6 +4024,12 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 	ASSERT(monitor->owner != self);
 	ASSERT(FREE_TAG != monitor->count);
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX)) {
+		return monitor_enter_futex(self, monitor, isAbortable);
+	}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 	while (1) {
 #if defined(OMR_THR_MCS_LOCKS)
 		if (0 == omrthread_mcs_lock(self, monitor, mcsNode, (blockedCount != 0)))
@@ -4154,6 +4193,127 @@ unblock_spinlock_threads(omrthread_t self, omrthread_monitor_t monitor)
 
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) */
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+/**
+ * Enter a futex monitor.
+ *
+ * The spinlock word doubles as the futex: UNOWNED, OWNED, or EXCEEDED when
+ * the owner may have to wake someone on exit. Once spinning fails the thread
+ * marks the word EXCEEDED and sleeps on it, so contended hand-off doesn't go
+ * through the monitor mutex. Abortable entries still block on their condition
+ * under the monitor mutex so that omrthread_abort() can wake them.
+ *
+ * @param[in] self current thread
+ * @param[in] monitor monitor to enter
+ * @param[in] isAbortable SET_ABORTABLE if omrthread_abort() may interrupt the entry
+ * @return 0 on success, J9THREAD_INTERRUPTED_MONITOR_ENTER otherwise
+ */
+static intptr_t
+monitor_enter_futex(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable)
+{
+	BOOLEAN blocked = FALSE;
+
+	if (0 != omrthread_spinlock_acquire(self, monitor)) {
+		blocked = TRUE;
+		if (SET_ABORTABLE == isAbortable) {
+			MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER_THREE_TIER1);
+			while (1) {
+				THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER2);
+				if (self->flags & J9THREAD_FLAG_ABORTED) {
+					self->flags &= ~J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+					self->monitor = 0;
+					THREAD_UNLOCK(self);
+					MONITOR_UNLOCK(monitor);
+					return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+				}
+				self->flags |= J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+				self->monitor = monitor;
+				THREAD_UNLOCK(self);
+
+				/* Queue before marking the word so that an owner which sees EXCEEDED also sees this thread. */
+				threadEnqueue(&monitor->blocking, self);
+				issueReadWriteBarrier();
+				if (J9THREAD_MONITOR_SPINLOCK_UNOWNED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED)) {
+					threadDequeue(&monitor->blocking, self);
+					break;
+				}
+				OMROSCOND_WAIT(self->condition, monitor->mutex);
+					break;
+				OMROSCOND_WAIT_LOOP();
+				threadDequeue(&monitor->blocking, self);
+			}
+			MONITOR_UNLOCK(monitor);
+		} else {
+			THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER2);
+			self->flags |= J9THREAD_FLAG_BLOCKED;
+			self->monitor = monitor;
+			THREAD_UNLOCK(self);
+
+			/* Keep taking the lock as EXCEEDED so that threads still sleeping are woken by our exit. */
+			while (J9THREAD_MONITOR_SPINLOCK_UNOWNED != omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED)) {
+				omrthread_futex_wait(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED);
+			}
+		}
+	}
+
+	monitor->owner = self;
+	monitor->count = 1;
+	ASSERT(monitor->spinlockState != J9THREAD_MONITOR_SPINLOCK_UNOWNED);
+
+	/* We now own the monitor */
+	self->lockedmonitorcount++;
+
+	if ((self->monitor != 0) || (SET_ABORTABLE == isAbortable)) {
+		THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER3);
+		self->flags &= ~J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+		self->monitor = 0;
+
+		if (SET_ABORTABLE == isAbortable) {
+			/* Check for abort that may have occurred after we got the monitor. */
+			if (self->flags & J9THREAD_FLAG_ABORTED) {
+				THREAD_UNLOCK(self);
+				monitor_exit(self, monitor);
+				return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+			}
+		}
+		THREAD_UNLOCK(self);
+	}
+
+	UPDATE_JLM_MON_ENTER(self, monitor, !IS_RECURSIVE_ENTER, blocked);
+
+	ASSERT(!(self->flags & J9THREAD_FLAG_BLOCKED));
+	ASSERT(0 == self->monitor);
+
+	return 0;
+}
+
+/**
+ * Release the spinlock word of a futex monitor.
+ *
+ * If the word was EXCEEDED, wake one futex sleeper, then any threads parked on
+ * their condition in the blocking queue (notified waiters and abortable entries).
+ *
+ * @param[in] self current thread
+ * @param[in] monitor monitor being released
+ * @param[in] monitorLocked TRUE if the caller already owns the monitor's mutex
+ */
+static void
+monitor_release_futex(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN monitorLocked)
+{
+	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+		omrthread_futex_wake(monitor, 1);
+		issueReadWriteBarrier();
+		if (monitorLocked) {
+			unblock_spinlock_threads(self, monitor);
+		} else if (NULL != monitor->blocking) {
+			MONITOR_LOCK(monitor, CALLER_MONITOR_EXIT1);
+			unblock_spinlock_threads(self, monitor);
+			MONITOR_UNLOCK(monitor);
+		}
+	}
+}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 
 
 /**
@@ -4357,6 +4517,12 @@ monitor_exit(omrthread_t self, omrthread_monitor_t monitor)
 		}
 		MONITOR_UNLOCK(monitor);
 #else /* defined(OMR_THR_MCS_LOCKS) */
+#if defined(OMR_THR_FUTEX_MONITORS)
+		if (OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX)) {
+			monitor_release_futex(self, monitor, FALSE);
+			return 0;
+		}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 		omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
  		MONITOR_LOCK(monitor, CALLER_MONITOR_EXIT1);
@@ -4625,10 +4791,17 @@ monitor_wait_original(omrthread_t self, omrthread_monitor_t monitor,
 		NOTIFY_WRAPPER(nextThread);
 	}
 #else /* defined(OMR_THR_MCS_LOCKS) */
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX)) {
+		monitor_release_futex(self, monitor, TRUE);
+	} else
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
-	omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
-	if (0 == monitor->spinThreads) {
-		unblock_spinlock_threads(self, monitor);
+	{
+		omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
+		if (0 == monitor->spinThreads) {
+			unblock_spinlock_threads(self, monitor);
+		}
 	}
 #else /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
 	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
@@ -4893,10 +5066,17 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 		NOTIFY_WRAPPER(nextThread);
 	}
 #else /* defined(OMR_THR_MCS_LOCKS) */
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX)) {
+		monitor_release_futex(self, monitor, TRUE);
+	} else
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
-	omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
-	if (0 == monitor->spinThreads) {
-		unblock_spinlock_threads(self, monitor);
+	{
+		omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
+		if (0 == monitor->spinThreads) {
+			unblock_spinlock_threads(self, monitor);
+		}
 	}
 #else /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
 	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
@@ -31,6 +31,7 @@
 #include "omrthread.h"
 #include "threaddef.h"
 #include "thread_internal.h"
+#include "ut_j9thr.h"
 
 /*
  * This file should be compiled only if OMR_THR_JLM is #defined.
@@ -192,6 +193,13 @@ jlm_adaptive_spin_init(void)
 		adaptiveFlags |= J9THREAD_LIB_FLAG_JLM_SLOW_SAMPLING_ENABLED;
 	}
 
+#if defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_JLM_HOLD_TIMES)
+	/* Tuning learns from sampled hold times, so it needs hold time sampling too */
+	if (0 != *(uintptr_t *)omrthread_global("adaptSpinTuneEnable")) {
+		adaptiveFlags |= J9THREAD_LIB_FLAG_JLM_HOLDTIME_SAMPLING_ENABLED | J9THREAD_LIB_FLAG_ADAPT_SPIN_TUNING_ENABLED;
+	}
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_JLM_HOLD_TIMES) */
+
 #if defined(OMR_THR_CUSTOM_SPIN_OPTIONS)
 	if (0 != *(uintptr_t *)omrthread_global("customAdaptSpinEnabled")) {
 		adaptiveFlags |= J9THREAD_LIB_FLAG_CUSTOM_ADAPTIVE_SPIN_ENABLED;
@@ -215,6 +223,91 @@ jlm_adaptive_spin_init(void)
 
 	return 0;
 }
+
+#if defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_JLM_HOLD_TIMES)
+/**
+ * Learn a monitor's spin budget (spinCount3) from its sampled hold times.
+ *
+ * A recent-weighted average of the hold time selects one of three behaviours:
+ * - above the park hold time (adaptSpinHoldtime, or a multiple of adaptSpinTuneHoldtime
+ *   when that is not set) spinning is disabled and contending threads block immediately;
+ * - up to adaptSpinTuneHoldtime, an enter that still had to block doubles the budget,
+ *   up to adaptSpinTuneMaxSpinCount3, so short critical sections converge to spinning only;
+ * - in between, an enter that still had to block halves the budget.
+ *
+ * Called on a sampled exit while the monitor is still owned, so the spin counts
+ * and tuning state are only updated by one thread at a time.
+ *
+ * @param[in] self the current thread, which owns the monitor
+ * @param[in] monitor the monitor being exited
+ * @param[in] holdTime the hold time just measured
+ * @return none
+ */
+void
+jlm_adaptive_spin_tune(omrthread_t self, omrthread_monitor_t monitor, uint64_t holdTime)
+{
+	omrthread_library_t lib = self->library;
+	J9ThreadMonitorTracing *tracing = monitor->tracing;
+	uint64_t avgHoldtime = tracing->adapt_holdtime;
+	uint64_t parkHoldtime = lib->adaptSpinHoldtime;
+	uintptr_t maxSpinCount3 = lib->adaptSpinTuneMaxSpinCount3;
+	uintptr_t spinCount3 = tracing->adapt_spin_count;
+	uintptr_t newSpinCount3 = 0;
+	BOOLEAN spinDisabled = OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_DISABLE_SPINNING);
+
+	/* Weight each new sample by 1/8 so the budget follows changes in behaviour */
+	if (0 == avgHoldtime) {
+		avgHoldtime = holdTime;
+	} else {
+		avgHoldtime = avgHoldtime - (avgHoldtime >> 3) + (holdTime >> 3);
+	}
+	tracing->adapt_holdtime = avgHoldtime;
+
+	if (0 == parkHoldtime) {
+		parkHoldtime = (uint64_t)lib->adaptSpinTuneHoldtime * OMRTHREAD_ADAPT_SPIN_TUNE_PARK_RATIO;
+	}
+	if (0 == maxSpinCount3) {
+		maxSpinCount3 = lib->defaultMonitorSpinCount3 * OMRTHREAD_ADAPT_SPIN_TUNE_MAX_RATIO;
+	}
+	if (0 == spinCount3) {
+		/* First sample: start from the monitor's current budget */
+		spinCount3 = spinDisabled ? lib->defaultMonitorSpinCount3 : monitor->spinCount3;
+	}
+
+	if (avgHoldtime > parkHoldtime) {
+		if (!spinDisabled) {
+			monitor->flags |= J9THREAD_MONITOR_DISABLE_SPINNING;
+			DISABLE_RAW_MONITOR_SPIN(self, monitor);
+			tracing->adapt_park_count += 1;
+		}
+		newSpinCount3 = spinCount3;
+	} else {
+		newSpinCount3 = spinCount3;
+		if (OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_SLOW_ENTER)) {
+			if (avgHoldtime <= lib->adaptSpinTuneHoldtime) {
+				newSpinCount3 = OMR_MIN(spinCount3 * 2, maxSpinCount3);
+				if (newSpinCount3 > spinCount3) {
+					tracing->adapt_grow_count += 1;
+				}
+			} else if (spinCount3 > 1) {
+				newSpinCount3 = spinCount3 / 2;
+				tracing->adapt_shrink_count += 1;
+			}
+		}
+
+		if (spinDisabled) {
+			monitor->flags &= ~J9THREAD_MONITOR_DISABLE_SPINNING;
+			ENABLE_RAW_MONITOR_SPIN(self, monitor);
+			monitor->spinCount3 = newSpinCount3;
+		} else if (newSpinCount3 != monitor->spinCount3) {
+			Trc_THR_Adapt_TuneSpinning((IS_OBJECT_MONITOR(monitor) ? "object" : "system"), monitor,
+				monitor->spinCount3, newSpinCount3, avgHoldtime);
+			monitor->spinCount3 = newSpinCount3;
+		}
+	}
+	tracing->adapt_spin_count = newSpinCount3;
+}
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_JLM_HOLD_TIMES) */
 #endif /* OMR_THR_ADAPTIVE_SPIN */
 
 
@@ -0,0 +1,710 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup Thread
+ * @brief Work-stealing thread pool and wait groups
+ */
+
+#include <string.h>
+
+#include "threaddef.h"
+#include "thread_internal.h"
+#include "omrutilbase.h"
+
+#undef  ASSERT
+#define ASSERT(x) /**/
+
+#define POOL_DEQUE_INITIAL_CAPACITY 64
+
+typedef struct OMRThreadPoolTask {
+	omrthread_pool_task_t function;
+	void *taskArg;
+	struct OMRThreadWaitGroup *group;
+} OMRThreadPoolTask;
+
+/*
+ * Each worker owns a deque of tasks. The owner pushes and pops at the tail while
+ * idle workers steal from the head. Deques are guarded by their own lock so that
+ * submitters and thieves only contend on the deque they touch.
+ */
+typedef struct OMRThreadPoolWorker {
+	struct OMRThreadPool *pool;
+	omrthread_t thread;
+	omrthread_monitor_t lock;
+	OMRThreadPoolTask *tasks;
+	uintptr_t capacity;
+	volatile uintptr_t head;
+	volatile uintptr_t tail;
+	uintptr_t index;
+	uintptr_t numaNode;
+	volatile uintptr_t idle;
+} OMRThreadPoolWorker;
+
+typedef struct OMRThreadPool {
+	OMRThreadPoolWorker *workers;
+	uintptr_t workerCount;
+	uintptr_t flags;
+	omrthread_tls_key_t workerKey;
+	volatile uintptr_t pendingTasks;
+	volatile uintptr_t idleWorkers;
+	volatile uintptr_t submitCursor;
+	volatile uintptr_t shutdown;
+} OMRThreadPool;
+
+typedef struct OMRThreadWaitGroup {
+	omrthread_monitor_t monitor;
+	volatile uintptr_t pending;
+} OMRThreadWaitGroup;
+
+static int J9THREAD_PROC poolWorkerMain(void *arg);
+static intptr_t pushTasks(OMRThreadPoolWorker *worker, omrthread_pool_task_t task, void **taskArgs, void *taskArg, uintptr_t count, OMRThreadWaitGroup *group);
+static BOOLEAN popTask(OMRThreadPoolWorker *worker, OMRThreadPoolTask *task);
+static BOOLEAN stealTask(OMRThreadPoolWorker *victim, OMRThreadPoolTask *task);
+static BOOLEAN takeTask(OMRThreadPool *pool, OMRThreadPoolWorker *self, OMRThreadPoolTask *task);
+static void runTask(OMRThreadPoolTask *task);
+static void wakeWorkers(OMRThreadPool *pool, uintptr_t count);
+static void idleWorker(OMRThreadPool *pool, OMRThreadPoolWorker *worker);
+static void freePool(OMRThreadPool *pool);
+
+/**
+ * Create a thread pool and start its workers.
+ *
+ * Workers are created with the given priority. With J9THREAD_POOL_NUMA_AWARE set in
+ * flags, and NUMA available, workers are bound round-robin to the NUMA nodes and
+ * prefer to steal work from workers on their own node. Idle workers park until
+ * work is submitted.
+ *
+ * @param[out] handle pointer to a omrthread_pool_t to be set to point to the new pool
+ * @param[in] workerCount number of worker threads, must be at least 1
+ * @param[in] priority priority of the worker threads
+ * @param[in] flags J9THREAD_POOL_* flags
+ * @param[in] name name of the worker threads and pool locks
+ * @return J9THREAD_POOL_OK on success, J9THREAD_POOL_FAIL otherwise
+ *
+ * @see omrthread_pool_destroy
+ */
+intptr_t
+omrthread_pool_create(omrthread_pool_t *handle, uintptr_t workerCount, omrthread_prio_t priority, uintptr_t flags, const char *name)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	OMRThreadPool *pool = NULL;
+	uintptr_t maxNode = 0;
+	uintptr_t i = 0;
+	omrthread_attr_t attr = NULL;
+
+	ASSERT(handle);
+	if (0 == workerCount) {
+		return J9THREAD_POOL_FAIL;
+	}
+
+	pool = (OMRThreadPool *)omrthread_allocate_memory(lib, sizeof(OMRThreadPool), OMRMEM_CATEGORY_THREADS);
+	if (NULL == pool) {
+		return J9THREAD_POOL_FAIL;
+	}
+	memset(pool, 0, sizeof(OMRThreadPool));
+	pool->flags = flags;
+
+	if (0 != omrthread_tls_alloc(&pool->workerKey)) {
+		omrthread_free_memory(lib, pool);
+		return J9THREAD_POOL_FAIL;
+	}
+
+	pool->workers = (OMRThreadPoolWorker *)omrthread_allocate_memory(lib, workerCount * sizeof(OMRThreadPoolWorker), OMRMEM_CATEGORY_THREADS);
+	if (NULL == pool->workers) {
+		freePool(pool);
+		return J9THREAD_POOL_FAIL;
+	}
+	memset(pool->workers, 0, workerCount * sizeof(OMRThreadPoolWorker));
+
+	if (J9THREAD_POOL_NUMA_AWARE == (flags & J9THREAD_POOL_NUMA_AWARE)) {
+		maxNode = omrthread_numa_get_max_node();
+	}
+
+	for (i = 0; i < workerCount; i++) {
+		OMRThreadPoolWorker *worker = &pool->workers[i];
+
+		worker->pool = pool;
+		worker->index = i;
+		worker->numaNode = (0 == maxNode) ? 0 : ((i % maxNode) + 1);
+		worker->capacity = POOL_DEQUE_INITIAL_CAPACITY;
+		worker->tasks = (OMRThreadPoolTask *)omrthread_allocate_memory(lib, worker->capacity * sizeof(OMRThreadPoolTask), OMRMEM_CATEGORY_THREADS);
+		if (NULL == worker->tasks) {
+			freePool(pool);
+			return J9THREAD_POOL_FAIL;
+		}
+		if (0 != omrthread_monitor_init_with_name(&worker->lock, 0, (char *)name)) {
+			omrthread_free_memory(lib, worker->tasks);
+			freePool(pool);
+			return J9THREAD_POOL_FAIL;
+		}
+		/* only fully initialized workers are counted, so freePool() releases exactly those */
+		pool->workerCount += 1;
+	}
+
+	if (J9THREAD_SUCCESS != omrthread_attr_init(&attr)) {
+		freePool(pool);
+		return J9THREAD_POOL_FAIL;
+	}
+	omrthread_attr_set_name(&attr, name);
+	omrthread_attr_set_priority(&attr, priority);
+	omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE);
+
+	for (i = 0; i < pool->workerCount; i++) {
+		OMRThreadPoolWorker *worker = &pool->workers[i];
+
+		/* Start suspended so the thread handle is set before any submitter may unpark it */
+		if (J9THREAD_SUCCESS != omrthread_create_ex(&worker->thread, &attr, TRUE, poolWorkerMain, worker)) {
+			uintptr_t started = i;
+
+			omrthread_attr_destroy(&attr);
+			pool->shutdown = 1;
+			wakeWorkers(pool, started);
+			for (i = 0; i < started; i++) {
+				omrthread_join(pool->workers[i].thread);
+			}
+			freePool(pool);
+			return J9THREAD_POOL_FAIL;
+		}
+		if (0 != worker->numaNode) {
+			omrthread_numa_set_node_affinity(worker->thread, &worker->numaNode, 1, 0);
+		}
+		omrthread_resume(worker->thread);
+	}
+	omrthread_attr_destroy(&attr);
+
+	*handle = pool;
+	return J9THREAD_POOL_OK;
+}
+
+/**
+ * Destroy a thread pool.
+ *
+ * Tasks that have already been submitted are run before the workers exit.
+ * This call returns once every worker thread has been joined.
+ *
+ * @note No task may be submitted to the pool once this has been called.
+ *
+ * @param[in] pool the pool to destroy
+ *
+ * @see omrthread_pool_create
+ */
+void
+omrthread_pool_destroy(omrthread_pool_t pool)
+{
+	uintptr_t i = 0;
+
+	ASSERT(pool);
+	pool->shutdown = 1;
+	wakeWorkers(pool, pool->workerCount);
+
+	for (i = 0; i < pool->workerCount; i++) {
+		omrthread_join(pool->workers[i].thread);
+	}
+
+	freePool(pool);
+}
+
+/**
+ * Submit a task to a thread pool.
+ *
+ * A task submitted by one of the pool's workers is queued on that worker's own deque;
+ * otherwise workers are chosen round-robin.
+ *
+ * @param[in] pool the pool to run the task
+ * @param[in] task the function to run
+ * @param[in] taskArg the argument passed to task
+ * @param[in] group wait group to signal when the task completes, or NULL
+ * @return J9THREAD_POOL_OK on success, J9THREAD_POOL_FAIL if the task could not be queued
+ *
+ * @see omrthread_pool_wait
+ */
+intptr_t
+omrthread_pool_submit(omrthread_pool_t pool, omrthread_pool_task_t task, void *taskArg, omrthread_waitgroup_t group)
+{
+	OMRThreadPoolWorker *worker = (OMRThreadPoolWorker *)omrthread_tls_get(omrthread_self(), pool->workerKey);
+
+	if (0 != pool->shutdown) {
+		return J9THREAD_POOL_FAIL;
+	}
+	if (NULL == worker) {
+		worker = &pool->workers[addAtomic(&pool->submitCursor, 1) % pool->workerCount];
+	}
+	if (NULL != group) {
+		omrthread_waitgroup_add(group, 1);
+	}
+	if (J9THREAD_POOL_OK != pushTasks(worker, task, NULL, taskArg, 1, group)) {
+		if (NULL != group) {
+			omrthread_waitgroup_done(group);
+		}
+		return J9THREAD_POOL_FAIL;
+	}
+	wakeWorkers(pool, 1);
+	return J9THREAD_POOL_OK;
+}
+
+/**
+ * Submit the same task for each of a set of arguments.
+ *
+ * The tasks are split into one slice per worker so each deque lock is only taken once,
+ * and as many idle workers as needed are unparked.
+ *
+ * @param[in] pool the pool to run the tasks
+ * @param[in] task the function to run
+ * @param[in] taskArgs array of count arguments, one per task
+ * @param[in] count number of tasks to submit
+ * @param[in] group wait group to signal as each task completes, or NULL
+ * @return J9THREAD_POOL_OK on success, J9THREAD_POOL_FAIL if the tasks could not all be queued.
+ * Tasks queued before a failure still run.
+ *
+ * @see omrthread_pool_wait
+ */
+intptr_t
+omrthread_pool_submit_batch(omrthread_pool_t pool, omrthread_pool_task_t task, void **taskArgs, uintptr_t count, omrthread_waitgroup_t group)
+{
+	uintptr_t workerCount = pool->workerCount;
+	uintptr_t slice = (count + workerCount - 1) / workerCount;
+	uintptr_t first = addAtomic(&pool->submitCursor, workerCount);
+	uintptr_t submitted = 0;
+	uintptr_t i = 0;
+
+	if (0 != pool->shutdown) {
+		return J9THREAD_POOL_FAIL;
+	}
+	if (NULL != group) {
+		omrthread_waitgroup_add(group, count);
+	}
+	for (i = 0; (i < workerCount) && (submitted < count); i++) {
+		OMRThreadPoolWorker *worker = &pool->workers[(first + i) % workerCount];
+		uintptr_t sliceCount = OMR_MIN(slice, count - submitted);
+
+		if (J9THREAD_POOL_OK != pushTasks(worker, task, &taskArgs[submitted], NULL, sliceCount, group)) {
+			break;
+		}
+		submitted += sliceCount;
+	}
+	if (NULL != group) {
+		for (i = submitted; i < count; i++) {
+			omrthread_waitgroup_done(group);
+		}
+	}
+	wakeWorkers(pool, submitted);
+	return (submitted == count) ? J9THREAD_POOL_OK : J9THREAD_POOL_FAIL;
+}
+
+/**
+ * Wait for every task counted by a wait group to complete.
+ *
+ * Rather than blocking straight away, the caller runs queued tasks until there are
+ * none left, so a worker may wait on tasks it has submitted itself.
+ *
+ * @param[in] pool the pool running the tasks
+ * @param[in] group the wait group to wait on
+ */
+void
+omrthread_pool_wait(omrthread_pool_t pool, omrthread_waitgroup_t group)
+{
+	OMRThreadPoolWorker *self = (OMRThreadPoolWorker *)omrthread_tls_get(omrthread_self(), pool->workerKey);
+	OMRThreadPoolTask task;
+
+	while ((0 != group->pending) && takeTask(pool, self, &task)) {
+		runTask(&task);
+	}
+	omrthread_waitgroup_wait(group);
+}
+
+/**
+ * Get the number of worker threads in a thread pool.
+ *
+ * @param[in] pool the pool
+ * @return number of workers
+ */
+uintptr_t
+omrthread_pool_get_worker_count(omrthread_pool_t pool)
+{
+	return pool->workerCount;
+}
+
+/**
+ * Create a wait group. A wait group counts outstanding work and lets threads wait
+ * for that count to drop to zero.
+ *
+ * @param[out] handle pointer to a omrthread_waitgroup_t to be set to point to the new wait group
+ * @param[in] name name of the wait group's monitor
+ * @return J9THREAD_POOL_OK on success, J9THREAD_POOL_FAIL otherwise
+ *
+ * @see omrthread_waitgroup_destroy
+ */
+intptr_t
+omrthread_waitgroup_init(omrthread_waitgroup_t *handle, const char *name)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	OMRThreadWaitGroup *group = (OMRThreadWaitGroup *)omrthread_allocate_memory(lib, sizeof(OMRThreadWaitGroup), OMRMEM_CATEGORY_THREADS);
+
+	if (NULL == group) {
+		return J9THREAD_POOL_FAIL;
+	}
+	group->pending = 0;
+	if (0 != omrthread_monitor_init_with_name(&group->monitor, 0, (char *)name)) {
+		omrthread_free_memory(lib, group);
+		return J9THREAD_POOL_FAIL;
+	}
+
+	ASSERT(handle);
+	*handle = group;
+	return J9THREAD_POOL_OK;
+}
+
+/**
+ * Destroy a wait group.
+ *
+ * @note The wait group must not have any outstanding work or waiters.
+ *
+ * @param[in] group the wait group to destroy
+ *
+ * @see omrthread_waitgroup_init
+ */
+void
+omrthread_waitgroup_destroy(omrthread_waitgroup_t group)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+
+	ASSERT(0 == group->pending);
+	omrthread_monitor_destroy(group->monitor);
+	omrthread_free_memory(lib, group);
+}
+
+/**
+ * Add to the count of outstanding work in a wait group.
+ *
+ * @param[in] group the wait group
+ * @param[in] count the amount to add
+ */
+void
+omrthread_waitgroup_add(omrthread_waitgroup_t group, uintptr_t count)
+{
+	addAtomic(&group->pending, count);
+}
+
+/**
+ * Mark one unit of work in a wait group as complete, waking the waiters once
+ * none is left.
+ *
+ * @param[in] group the wait group
+ */
+void
+omrthread_waitgroup_done(omrthread_waitgroup_t group)
+{
+	ASSERT(0 != group->pending);
+	if (0 == subtractAtomic(&group->pending, 1)) {
+		omrthread_monitor_enter(group->monitor);
+		omrthread_monitor_notify_all(group->monitor);
+		omrthread_monitor_exit(group->monitor);
+	}
+}
+
+/**
+ * Block until all work counted by a wait group is complete.
+ *
+ * @param[in] group the wait group
+ *
+ * @see omrthread_pool_wait
+ */
+void
+omrthread_waitgroup_wait(omrthread_waitgroup_t group)
+{
+	if (0 != group->pending) {
+		omrthread_monitor_enter(group->monitor);
+		while (0 != group->pending) {
+			omrthread_monitor_wait(group->monitor);
+		}
+		omrthread_monitor_exit(group->monitor);
+	}
+}
+
+/**
+ * Main loop of a pool worker: run tasks from its own deque, steal from other workers
+ * when it is empty, and park when there is nothing left to do.
+ *
+ * @param[in] arg the OMRThreadPoolWorker
+ * @return 0
+ */
+static int J9THREAD_PROC
+poolWorkerMain(void *arg)
+{
+	OMRThreadPoolWorker *worker = (OMRThreadPoolWorker *)arg;
+	OMRThreadPool *pool = worker->pool;
+	OMRThreadPoolTask task;
+
+	omrthread_tls_set(omrthread_self(), pool->workerKey, worker);
+
+	for (;;) {
+		if (takeTask(pool, worker, &task)) {
+			runTask(&task);
+		} else if ((0 != pool->shutdown) && (0 == pool->pendingTasks)) {
+			break;
+		} else {
+			idleWorker(pool, worker);
+		}
+	}
+
+	omrthread_tls_set(omrthread_self(), pool->workerKey, NULL);
+	return 0;
+}
+
+/**
+ * Append tasks to the tail of a worker's deque, growing it if needed.
+ *
+ * @param[in] worker the worker to queue the tasks on
+ * @param[in] task the function to run
+ * @param[in] taskArgs array of count task arguments, or NULL to use taskArg for every task
+ * @param[in] taskArg the argument used when taskArgs is NULL
+ * @param[in] count number of tasks
+ * @param[in] group wait group of the tasks, or NULL
+ * @return J9THREAD_POOL_OK on success, J9THREAD_POOL_FAIL if the deque could not grow
+ */
+static intptr_t
+pushTasks(OMRThreadPoolWorker *worker, omrthread_pool_task_t task, void **taskArgs, void *taskArg, uintptr_t count, OMRThreadWaitGroup *group)
+{
+	OMRThreadPool *pool = worker->pool;
+	uintptr_t i = 0;
+
+	/* Count the tasks before they are visible so that pendingTasks never underflows */
+	addAtomic(&pool->pendingTasks, count);
+
+	omrthread_monitor_enter(worker->lock);
+	if ((worker->tail - worker->head + count) > worker->capacity) {
+		omrthread_library_t lib = GLOBAL_DATA(default_library);
+		uintptr_t newCapacity = worker->capacity;
+		OMRThreadPoolTask *newTasks = NULL;
+
+		while ((worker->tail - worker->head + count) > newCapacity) {
+			newCapacity *= 2;
+		}
+		newTasks = (OMRThreadPoolTask *)omrthread_allocate_memory(lib, newCapacity * sizeof(OMRThreadPoolTask), OMRMEM_CATEGORY_THREADS);
+		if (NULL == newTasks) {
+			omrthread_monitor_exit(worker->lock);
+			subtractAtomic(&pool->pendingTasks, count);
+			return J9THREAD_POOL_FAIL;
+		}
+		for (i = worker->head; i != worker->tail; i++) {
+			newTasks[i - worker->head] = worker->tasks[i & (worker->capacity - 1)];
+		}
+		omrthread_free_memory(lib, worker->tasks);
+		worker->tasks = newTasks;
+		worker->tail -= worker->head;
+		worker->head = 0;
+		worker->capacity = newCapacity;
+	}
+	for (i = 0; i < count; i++) {
+		OMRThreadPoolTask *slot = &worker->tasks[(worker->tail + i) & (worker->capacity - 1)];
+		slot->function = task;
+		slot->taskArg = (NULL == taskArgs) ? taskArg : taskArgs[i];
+		slot->group = group;
+	}
+	worker->tail += count;
+	omrthread_monitor_exit(worker->lock);
+
+	return J9THREAD_POOL_OK;
+}
+
+/**
+ * Take the most recently queued task from a worker's own deque.
+ *
+ * @param[in] worker the worker
+ * @param[out] task the task taken
+ * @return TRUE if a task was taken
+ */
+static BOOLEAN
+popTask(OMRThreadPoolWorker *worker, OMRThreadPoolTask *task)
+{
+	BOOLEAN found = FALSE;
+
+	if (worker->head != worker->tail) {
+		omrthread_monitor_enter(worker->lock);
+		if (worker->head != worker->tail) {
+			worker->tail -= 1;
+			*task = worker->tasks[worker->tail & (worker->capacity - 1)];
+			found = TRUE;
+		}
+		omrthread_monitor_exit(worker->lock);
+	}
+	return found;
+}
+
+/**
+ * Take the oldest task from another worker's deque.
+ *
+ * @param[in] victim the worker to steal from
+ * @param[out] task the task taken
+ * @return TRUE if a task was taken
+ */
+static BOOLEAN
+stealTask(OMRThreadPoolWorker *victim, OMRThreadPoolTask *task)
+{
+	BOOLEAN found = FALSE;
+
+	if (victim->head != victim->tail) {
+		omrthread_monitor_enter(victim->lock);
+		if (victim->head != victim->tail) {
+			*task = victim->tasks[victim->head & (victim->capacity - 1)];
+			victim->head += 1;
+			found = TRUE;
+		}
+		omrthread_monitor_exit(victim->lock);
+	}
+	return found;
+}
+
+/**
+ * Find a task for a worker, or for a thread helping the pool. Workers try their own
+ * deque first and then steal, from workers on their own NUMA node before the others.
+ *
+ * @param[in] pool the pool
+ * @param[in] self the calling worker, or NULL if the caller is not a worker of this pool
+ * @param[out] task the task taken
+ * @return TRUE if a task was taken
+ */
+static BOOLEAN
+takeTask(OMRThreadPool *pool, OMRThreadPoolWorker *self, OMRThreadPoolTask *task)
+{
+	uintptr_t workerCount = pool->workerCount;
+	uintptr_t start = 0;
+	uintptr_t localNode = 0;
+	uintptr_t pass = 0;
+	uintptr_t i = 0;
+
+	if (NULL != self) {
+		if (popTask(self, task)) {
+			subtractAtomic(&pool->pendingTasks, 1);
+			return TRUE;
+		}
+		start = self->index + 1;
+		localNode = self->numaNode;
+	}
+
+	/* with NUMA placement the first pass only visits workers on the local node */
+	for (pass = (0 == localNode) ? 1 : 0; pass < 2; pass++) {
+		for (i = 0; (i < workerCount) && (0 != pool->pendingTasks); i++) {
+			OMRThreadPoolWorker *victim = &pool->workers[(start + i) % workerCount];
+
+			if ((victim == self) || ((0 == pass) && (victim->numaNode != localNode))) {
+				continue;
+			}
+			if (stealTask(victim, task)) {
+				subtractAtomic(&pool->pendingTasks, 1);
+				return TRUE;
+			}
+		}
+	}
+	return FALSE;
+}
+
+/**
+ * Run a task and signal its wait group.
+ *
+ * @param[in] task the task to run
+ */
+static void
+runTask(OMRThreadPoolTask *task)
+{
+	task->function(task->taskArg);
+	if (NULL != task->group) {
+		omrthread_waitgroup_done(task->group);
+	}
+}
+
+/**
+ * Unpark up to count idle workers.
+ *
+ * @param[in] pool the pool
+ * @param[in] count the number of workers wanted
+ */
+static void
+wakeWorkers(OMRThreadPool *pool, uintptr_t count)
+{
+	uintptr_t i = 0;
+
+	/* Order the queued tasks or shutdown before reading the idle flags; pairs with idleWorker() */
+	issueReadWriteBarrier();
+	for (i = 0; (i < pool->workerCount) && (0 != count) && (0 != pool->idleWorkers); i++) {
+		OMRThreadPoolWorker *worker = &pool->workers[i];
+
+		if ((0 != worker->idle) && (1 == compareAndSwapUDATA((uintptr_t *)&worker->idle, 1, 0))) {
+			subtractAtomic(&pool->idleWorkers, 1);
+			omrthread_unpark(worker->thread);
+			count -= 1;
+		}
+	}
+}
+
+/**
+ * Park a worker until a submitter or omrthread_pool_destroy wakes it. The worker
+ * publishes its idle flag before its final check for work, so a submitter either
+ * sees the flag and unparks it, or the worker sees the new task.
+ *
+ * @param[in] pool the pool
+ * @param[in] worker the calling worker
+ */
+static void
+idleWorker(OMRThreadPool *pool, OMRThreadPoolWorker *worker)
+{
+	worker->idle = 1;
+	addAtomic(&pool->idleWorkers, 1);
+	issueReadWriteBarrier();
+
+	if ((0 != pool->pendingTasks) || (0 != pool->shutdown)) {
+		/* If this fails, a waker has claimed the worker and its unpark is consumed by a later park */
+		if (1 == compareAndSwapUDATA((uintptr_t *)&worker->idle, 1, 0)) {
+			subtractAtomic(&pool->idleWorkers, 1);
+		}
+		return;
+	}
+
+	while (0 != worker->idle) {
+		omrthread_park(0, 0);
+	}
+}
+
+/**
+ * Free the memory of a pool whose workers are not running.
+ *
+ * @param[in] pool the pool to free
+ */
+static void
+freePool(OMRThreadPool *pool)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	uintptr_t i = 0;
+
+	if (NULL != pool->workers) {
+		for (i = 0; i < pool->workerCount; i++) {
+			omrthread_monitor_destroy(pool->workers[i].lock);
+			omrthread_free_memory(lib, pool->workers[i].tasks);
+		}
+		omrthread_free_memory(lib, pool->workers);
+	}
+	omrthread_tls_free(pool->workerKey);
+	omrthread_free_memory(lib, pool);
+}
@@ -24,14 +24,36 @@
 #include <stdlib.h>
 #include "threaddef.h"
 #include "thread_internal.h"
+#include "omrutilbase.h"
 
 #undef  ASSERT
 #define ASSERT(x) /**/
 
+#define RWMUTEX_READER_SLOTS 64
+#define RWMUTEX_READER_SLOT_SIZE 64
+
+/*
+ * Reader count for the threads that hash to one slot of a reader biased mutex.
+ * Slots are padded to a cache line so readers in different slots do not share one.
+ */
+typedef struct RWMutexReaderSlot {
+	volatile uintptr_t count;
+	uint8_t padding[RWMUTEX_READER_SLOT_SIZE - sizeof(uintptr_t)];
+} RWMutexReaderSlot;
+
+/*
+ * In a reader biased mutex (J9THREAD_RWMUTEX_READER_BIASED) readers are counted in
+ * readerSlots rather than status, and only enter syncMon once a writer has cleared
+ * readerBias. status then only counts recursive write entries.
+ */
 typedef struct RWMutex {
 	omrthread_monitor_t syncMon;
 	intptr_t status;
 	omrthread_t writer;
+	uintptr_t flags;
+	volatile uintptr_t readerBias;
+	uintptr_t waitingWriters;
+	RWMutexReaderSlot *readerSlots;
 } RWMutex;
 
 #define ASSERT_RWMUTEX(m)\
@@ -42,9 +64,19 @@ typedef struct RWMutex {
 #define RWMUTEX_STATUS_READING(m)  ((m)->status > 0)
 #define RWMUTEX_STATUS_WRITING(m)  ((m)->status < 0)
 
+#define RWMUTEX_IS_READER_BIASED(m) (J9THREAD_RWMUTEX_READER_BIASED == ((m)->flags & J9THREAD_RWMUTEX_READER_BIASED))
+#define RWMUTEX_READER_SLOT(m, self) (&(m)->readerSlots[(self)->tid % RWMUTEX_READER_SLOTS])
+
+static BOOLEAN biasedReadersActive(RWMutex *mutex);
+static void revokeReaderBias(RWMutex *mutex);
+
 /**
  * Acquire and initialize a new read/write mutex from the threading library.
  *
+ * With J9THREAD_RWMUTEX_READER_BIASED set in flags, readers register in per-thread
+ * slots without entering the internal monitor, which scales read-mostly mutexes
+ * across many cores at the cost of a slower write entry.
+ *
  * @param[out] handle pointer to a omrthread_rwmutex_t to be set to point to the new mutex
  * @param[in] flags initial flag values for the mutex
  * @return J9THREAD_RWMUTEX_OK on success
@@ -69,6 +101,27 @@ omrthread_rwmutex_init(omrthread_rwmutex_t *handle, uintptr_t flags, const char
 	if (NULL == mutex) {
 		ret = J9THREAD_RWMUTEX_FAIL;
 	} else {
+		mutex->flags = flags;
+		mutex->readerBias = 0;
+		mutex->waitingWriters = 0;
+		mutex->readerSlots = NULL;
+		if (RWMUTEX_IS_READER_BIASED(mutex)) {
+			uintptr_t slotsSize = RWMUTEX_READER_SLOTS * sizeof(RWMutexReaderSlot);
+			mutex->readerSlots = (RWMutexReaderSlot *)omrthread_allocate_memory(lib, slotsSize, OMRMEM_CATEGORY_THREADS);
+			if (NULL == mutex->readerSlots) {
+#if defined(OMR_THR_FORK_SUPPORT)
+				GLOBAL_LOCK_SIMPLE(lib);
+				pool_removeElement(lib->rwmutexPool, mutex);
+				GLOBAL_UNLOCK_SIMPLE(lib);
+#else /* defined(OMR_THR_FORK_SUPPORT) */
+				omrthread_free_memory(lib, mutex);
+#endif /* defined(OMR_THR_FORK_SUPPORT) */
+				return J9THREAD_RWMUTEX_FAIL;
+			}
+			memset(mutex->readerSlots, 0, slotsSize);
+			mutex->readerBias = 1;
+		}
+
 		omrthread_monitor_init_with_name(&mutex->syncMon, 0, (char *)name);
 		mutex->status = 0;
 		mutex->writer = 0;
@@ -103,6 +156,9 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 	ASSERT(0 == mutex->status);
 	ASSERT(0 == mutex->writer);
 	omrthread_monitor_destroy(mutex->syncMon);
+	if (NULL != mutex->readerSlots) {
+		omrthread_free_memory(lib, mutex->readerSlots);
+	}
 #if defined(OMR_THR_FORK_SUPPORT)
 	ASSERT(0 != lib->rwmutexPool);
 	GLOBAL_LOCK_SIMPLE(lib);
@@ -142,8 +198,34 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_IS_READER_BIASED(mutex)) {
+		RWMutexReaderSlot *slot = RWMUTEX_READER_SLOT(mutex, self);
+
+		addAtomic(&slot->count, 1);
+		/* Publish the count before checking the bias; pairs with revokeReaderBias() */
+		issueReadWriteBarrier();
+		if (0 != mutex->readerBias) {
+			return J9THREAD_RWMUTEX_OK;
+		}
+
+		/* The bias has been revoked. As with unbiased mutexes, readers are still
+		 * admitted until a writer actually owns the mutex.
+		 */
+		omrthread_monitor_enter(mutex->syncMon);
+		if (mutex->status < 0) {
+			subtractAtomic(&slot->count, 1);
+			while (mutex->status < 0) {
+				omrthread_monitor_wait(mutex->syncMon);
+			}
+			addAtomic(&slot->count, 1);
+		}
+		omrthread_monitor_exit(mutex->syncMon);
 		return J9THREAD_RWMUTEX_OK;
 	}
 
@@ -170,8 +252,21 @@ omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_exit_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_IS_READER_BIASED(mutex)) {
+		subtractAtomic(&RWMUTEX_READER_SLOT(mutex, self)->count, 1);
+		issueReadWriteBarrier();
+		if (0 == mutex->readerBias) {
+			/* a writer may be waiting for the reader slots to drain */
+			omrthread_monitor_enter(mutex->syncMon);
+			omrthread_monitor_notify_all(mutex->syncMon);
+			omrthread_monitor_exit(mutex->syncMon);
+		}
 		return J9THREAD_RWMUTEX_OK;
 	}
 
@@ -226,8 +321,18 @@ omrthread_rwmutex_enter_write(omrthread_rwmutex_t mutex)
 
 	omrthread_monitor_enter(mutex->syncMon);
 
-	while (mutex->status != 0) {
-		omrthread_monitor_wait(mutex->syncMon);
+	if (RWMUTEX_IS_READER_BIASED(mutex)) {
+		/* waitingWriters keeps the bias revoked until every queued writer is done */
+		mutex->waitingWriters++;
+		revokeReaderBias(mutex);
+		while ((mutex->status != 0) || biasedReadersActive(mutex)) {
+			omrthread_monitor_wait(mutex->syncMon);
+		}
+		mutex->waitingWriters--;
+	} else {
+		while (mutex->status != 0) {
+			omrthread_monitor_wait(mutex->syncMon);
+		}
 	}
 	mutex->status--;
 	mutex->writer = self;
@@ -268,6 +373,16 @@ omrthread_rwmutex_try_enter_write(omrthread_rwmutex_t mutex)
 		omrthread_monitor_exit(mutex->syncMon);
 		return J9THREAD_RWMUTEX_WOULDBLOCK;
 	}
+	if (RWMUTEX_IS_READER_BIASED(mutex)) {
+		revokeReaderBias(mutex);
+		if (biasedReadersActive(mutex)) {
+			if (0 == mutex->waitingWriters) {
+				mutex->readerBias = 1;
+			}
+			omrthread_monitor_exit(mutex->syncMon);
+			return J9THREAD_RWMUTEX_WOULDBLOCK;
+		}
+	}
 	mutex->status--;
 	mutex->writer = self;
 
@@ -299,6 +414,9 @@ omrthread_rwmutex_exit_write(omrthread_rwmutex_t mutex)
 	mutex->status++;
 	if (0 == mutex->status) {
 		mutex->writer = NULL;
+		if (RWMUTEX_IS_READER_BIASED(mutex) && (0 == mutex->waitingWriters)) {
+			mutex->readerBias = 1;
+		}
 		omrthread_monitor_notify_all(mutex->syncMon);
 	}
 
@@ -321,6 +439,40 @@ omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex)
 	return (RWMUTEX_STATUS_WRITING(mutex) || (0 != mutex->writer));
 }
 
+/**
+ * Check whether any reader is counted in the slots of a reader biased mutex.
+ *
+ * @param[in] mutex a reader biased mutex
+ * @return TRUE if any slot has a non-zero reader count
+ */
+static BOOLEAN
+biasedReadersActive(RWMutex *mutex)
+{
+	uintptr_t i = 0;
+
+	for (i = 0; i < RWMUTEX_READER_SLOTS; i++) {
+		if (0 != mutex->readerSlots[i].count) {
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+/**
+ * Send readers of a reader biased mutex through syncMon. Once this returns, any
+ * reader not yet visible in the slots will see the revoked bias.
+ *
+ * @note The caller must own syncMon.
+ *
+ * @param[in] mutex a reader biased mutex
+ */
+static void
+revokeReaderBias(RWMutex *mutex)
+{
+	mutex->readerBias = 0;
+	issueReadWriteBarrier();
+}
+
 #if defined(OMR_THR_FORK_SUPPORT)
 /**
  * @param [in] rwmutex to reset
@@ -330,7 +482,9 @@ omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex)
 void
 omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 {
-	if (RWMUTEX_STATUS_READING(rwmutex)) {
+	if (RWMUTEX_STATUS_READING(rwmutex)
+		|| (RWMUTEX_IS_READER_BIASED(rwmutex) && biasedReadersActive(rwmutex))
+	) {
 		fprintf(stderr, "ERROR: found read-locked rwmutex during post-fork reset!\n");
 		abort();
 	}
@@ -341,7 +495,12 @@ omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 		 */
 		rwmutex->writer = NULL;
 		rwmutex->status = 0;
+		if (RWMUTEX_IS_READER_BIASED(rwmutex)) {
+			rwmutex->readerBias = 1;
+		}
 	}
+	/* writers queued on other threads did not survive the fork */
+	rwmutex->waitingWriters = 0;
 }
 
 J9Pool *
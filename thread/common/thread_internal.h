@@ -103,6 +103,18 @@ jlm_monitor_free(omrthread_library_t lib, omrthread_monitor_t monitor);
 void
 jlm_monitor_clear(omrthread_library_t lib, omrthread_monitor_t monitor);
 
+#if defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_JLM_HOLD_TIMES)
+/**
+ * @brief
+ * @param self
+ * @param monitor
+ * @param holdTime
+ * @return void
+ */
+void
+jlm_adaptive_spin_tune(omrthread_t self, omrthread_monitor_t monitor, uint64_t holdTime);
+#endif /* defined(OMR_THR_ADAPTIVE_SPIN) && defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_JLM_HOLD_TIMES) */
+
 #endif /* OMR_THR_JLM */
 
 /* ---------------- omrthreadtls.c ---------------- */
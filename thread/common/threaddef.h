@@ -98,6 +98,11 @@ intptr_t omrthread_spinlock_acquire(omrthread_t self, omrthread_monitor_t monito
 intptr_t omrthread_spinlock_acquire_no_spin(omrthread_t self, omrthread_monitor_t monitor);
 uintptr_t omrthread_spinlock_swapState(omrthread_monitor_t monitor, uintptr_t newState);
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+void omrthread_futex_wait(omrthread_monitor_t monitor, uintptr_t expectedState);
+void omrthread_futex_wake(omrthread_monitor_t monitor, int32_t count);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 #if defined(OMR_THR_MCS_LOCKS)
 intptr_t
 omrthread_mcs_lock(omrthread_t self, omrthread_monitor_t monitor, omrthread_mcs_node_t mcsNode, BOOLEAN retry);
@@ -382,6 +387,24 @@ enum {
 		} \
 	} while(0)
 
+#if defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_JLM_HOLD_TIMES)
+#define IS_ADAPT_SPIN_TUNING_ENABLED(thread) ((thread)->library->flags & J9THREAD_LIB_FLAG_ADAPT_SPIN_TUNING_ENABLED)
+
+/* Tune the monitor's spin budget from the hold time just measured, or fall back to the on/off heuristic */
+#define ADAPT_SPIN_CHECK(thread, monitor, holdTime) \
+	do { \
+		if (IS_ADAPT_SPIN_TUNING_ENABLED(thread)) { \
+			if (IS_ADAPTIVE_SPIN_REQUIRED(monitor)) { \
+				jlm_adaptive_spin_tune((thread), (monitor), (holdTime)); \
+			} \
+		} else { \
+			ADAPT_DISABLE_SPIN_CHECK((thread), (monitor)); \
+		} \
+	} while(0)
+#else /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_JLM_HOLD_TIMES) */
+#define ADAPT_SPIN_CHECK(thread, monitor, holdTime) ADAPT_DISABLE_SPIN_CHECK((thread), (monitor))
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_JLM_HOLD_TIMES) */
+
 #define ADAPT_SAMPLE_STOP_MIN_COUNT(thread, monitor) ((thread)->library->adaptSpinSampleStopCount)
 
 #define ADAPT_SAMPLE_STOP_MAX_HOLDTIME(thread, monitor) \
@@ -421,6 +444,7 @@ enum {
 #else /* OMR_THR_ADAPTIVE_SPIN */
 #define DO_ADAPT_CHECK(thread, monitor)
 #define ADAPT_DISABLE_SPIN_CHECK(thread, monitor)
+#define ADAPT_SPIN_CHECK(thread, monitor, holdTime)
 #define TAKE_JLM_SAMPLE(thread, monitor) IS_JLM_ENABLED(thread)
 #endif /* OMR_THR_ADAPTIVE_SPIN */
 
@@ -568,7 +592,7 @@ enum {
 							(monitor)->tracing->holdtime_count = holdTimeCount; \
 							(monitor)->tracing->holdtime_sum += (omrtime_t)holdTime; \
 							(monitor)->tracing->holdtime_avg = (monitor)->tracing->holdtime_sum / ((uint64_t)holdTimeCount); \
-							ADAPT_DISABLE_SPIN_CHECK((self), (monitor)); \
+							ADAPT_SPIN_CHECK((self), (monitor), (uint64_t)holdTime); \
 						} \
 					} \
 				} \
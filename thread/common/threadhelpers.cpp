@@ -22,6 +22,13 @@
 
 #include "AtomicSupport.hpp"
 
+#include "omrthread.h"
+#if defined(OMR_THR_FUTEX_MONITORS)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 extern "C" {
 
 #include "thrtypes.h"
@@ -196,6 +203,47 @@ omrthread_spinlock_swapState(omrthread_monitor_t monitor, uintptr_t newState)
 	return oldState;
 }
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+/**
+ * Answer the 32 bit word of a monitor's spinlockState that holds the state, which
+ * is what the futex operates on.
+ */
+static int32_t *
+futexWord(omrthread_monitor_t monitor)
+{
+	int32_t *word = (int32_t *)&monitor->spinlockState;
+#if defined(OMR_ENV_DATA64) && !defined(OMR_ENV_LITTLE_ENDIAN)
+	word += 1;
+#endif /* defined(OMR_ENV_DATA64) && !defined(OMR_ENV_LITTLE_ENDIAN) */
+	return word;
+}
+
+/**
+ * Block until a monitor's spinlockState may have changed from expectedState.
+ * Returns immediately if it already differs; spurious wakeups are possible.
+ *
+ * @param[in] monitor the monitor to wait on
+ * @param[in] expectedState the spinlockState observed by the caller
+ */
+void
+omrthread_futex_wait(omrthread_monitor_t monitor, uintptr_t expectedState)
+{
+	syscall(SYS_futex, futexWord(monitor), FUTEX_WAIT_PRIVATE, (int32_t)expectedState, NULL, NULL, 0);
+}
+
+/**
+ * Wake threads blocked in omrthread_futex_wait() on a monitor.
+ *
+ * @param[in] monitor the monitor
+ * @param[in] count the maximum number of threads to wake
+ */
+void
+omrthread_futex_wake(omrthread_monitor_t monitor, int32_t count)
+{
+	syscall(SYS_futex, futexWord(monitor), FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 #if defined(OMR_THR_MCS_LOCKS)
 /**
  * Acquire the MCS lock.
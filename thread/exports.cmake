@@ -101,6 +101,17 @@ omr_add_exports(j9thr_obj
 	omrthread_rwmutex_try_enter_write
 	omrthread_rwmutex_exit_write
 	omrthread_rwmutex_is_writelocked
+	omrthread_pool_create
+	omrthread_pool_destroy
+	omrthread_pool_submit
+	omrthread_pool_submit_batch
+	omrthread_pool_wait
+	omrthread_pool_get_worker_count
+	omrthread_waitgroup_init
+	omrthread_waitgroup_destroy
+	omrthread_waitgroup_add
+	omrthread_waitgroup_done
+	omrthread_waitgroup_wait
 	omrthread_park
 	omrthread_unpark
 	omrthread_numa_get_max_node
@@ -38,6 +38,7 @@ OBJECTS :=\
   omrthreadinspect \
   omrthreadmem \
   omrthreadnuma \
+  omrthreadpool \
   omrthreadpriority \
   omrthreadtls \
   priority \
@@ -200,6 +201,17 @@ define WRITE_COMMON_THREAD_EXPORTS
 @echo omrthread_rwmutex_try_enter_write >>$@
 @echo omrthread_rwmutex_exit_write >>$@
 @echo omrthread_rwmutex_is_writelocked >>$@
+@echo omrthread_pool_create >>$@
+@echo omrthread_pool_destroy >>$@
+@echo omrthread_pool_submit >>$@
+@echo omrthread_pool_submit_batch >>$@
+@echo omrthread_pool_wait >>$@
+@echo omrthread_pool_get_worker_count >>$@
+@echo omrthread_waitgroup_init >>$@
+@echo omrthread_waitgroup_destroy >>$@
+@echo omrthread_waitgroup_add >>$@
+@echo omrthread_waitgroup_done >>$@
+@echo omrthread_waitgroup_wait >>$@
 @echo omrthread_park >>$@
 @echo omrthread_unpark >>$@
 @echo omrthread_numa_get_max_node >>$@
@@ -0,0 +1,805 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+
+/*
+ * file    : concurrenthashtable.c
+ *
+ *  Concurrent hash table implementation
+ *
+ *  All the nodes of the table are kept in a single linked list sorted by order key,
+ *  the bit reversed hash (a split-ordered list).  The nodes of a bucket are contiguous
+ *  in the list, and each bucket is marked by a bucket node whose order key sorts just
+ *  before them.  Lookups walk the list from the bucket node without locking.  Writers
+ *  lock the bucket node that precedes the position they update, so adds and removes in
+ *  different buckets never contend.
+ *
+ *  Growing the table only replaces the bucket array with one of twice the size holding
+ *  the same bucket pointers.  Each new bucket splits from the bucket with the same index
+ *  less its top bit, and is linked into the list, under the lock of that bucket, by the
+ *  first operation which needs it.  Nodes never move, so an entry keeps its address
+ *  for as long as it is in the table.
+ *
+ *  Removed nodes and replaced bucket arrays may still be referenced by concurrent
+ *  readers, so they are retired rather than freed.  Every operation runs inside a read
+ *  section, which records the epoch it entered in the reader of the calling thread: a
+ *  cache line of its own which no other thread writes.  Advancing the epoch moves the
+ *  retired lists into limbo and frees the previous limbo lists, which is only done once
+ *  no reader holds an epoch from before they were moved there: readers which entered
+ *  later did so after the limbo contents were unlinked and cannot reach them.  Updates
+ *  that retire memory try to advance the epoch, so reclamation never needs a quiescent
+ *  table.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "omrcfg.h"
+#include "hashtable_api.h"
+#include "omrthread.h"
+#include "omrutilbase.h"
+
+#define CONCURRENT_HASH_TABLE_SIZE_MIN 16
+#define CONCURRENT_HASH_TABLE_SPIN_MAX 1024
+#define CONCURRENT_HASH_TABLE_CACHE_LINE 64
+
+#define NODE_DATA(node) ((void *)((uint8_t *)(node) + sizeof(J9ConcurrentHashTableNode)))
+#define IS_BUCKET_NODE(node) (0 == ((node)->orderKey & 1))
+#define BUCKET_ORDER_KEY(index) concurrentHashTableReverseBits(index)
+#define ENTRY_ORDER_KEY(hash) (concurrentHashTableReverseBits(hash) | 1)
+
+static uintptr_t concurrentHashTableHash(J9ConcurrentHashTable *table, void *entry);
+static uintptr_t concurrentHashTableReverseBits(uintptr_t value);
+static J9ConcurrentHashTableBuckets *concurrentHashTableAllocateBuckets(J9ConcurrentHashTable *table, uintptr_t size);
+static J9ConcurrentHashTableBucket *concurrentHashTableAllocateBucket(J9ConcurrentHashTable *table, uintptr_t index);
+static J9ConcurrentHashTableBucket *concurrentHashTableGetBucket(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets, uintptr_t index);
+static void concurrentHashTableLockBucket(J9ConcurrentHashTableBucket *bucket);
+static void concurrentHashTableUnlockBucket(J9ConcurrentHashTableBucket *bucket);
+static J9ConcurrentHashTableNode *concurrentHashTableLockPosition(J9ConcurrentHashTableBucket **bucket, uintptr_t orderKey);
+static J9ConcurrentHashTableReader *concurrentHashTableClaimReader(J9ConcurrentHashTable *table, omrthread_t self);
+static void concurrentHashTableReleaseReader(void *reader);
+static void concurrentHashTableRetireNode(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *node);
+static void concurrentHashTableRetireBuckets(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets);
+static BOOLEAN concurrentHashTableAdvanceEpoch(J9ConcurrentHashTable *table);
+static void concurrentHashTableFreeRetired(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *node, J9ConcurrentHashTableBuckets *buckets);
+static BOOLEAN concurrentHashTableGrow(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets, uintptr_t numberOfNodes);
+
+/**
+ * \brief       Create a new concurrent hash table
+ * \ingroup     hash_table
+ *
+ * @param portLibrary   The port library
+ * @param tableName     A string giving the name of the table, used to tag allocation
+ * @param tableSize     Initial number of buckets, rounded up to a power of two
+ * @param entrySize     Size of the user-data for each node, entries are pointer aligned
+ * @param memoryCategory Memory category for which memory allocated for the table will be associated
+ * @param hashFn        Mandatory hashing function ptr
+ * @param hashEqualFn   Mandatory hash compare function ptr
+ * @param functionUserData  Pointer passed to hashFn and hashEqualFn
+ * @return  An initialized concurrent hash table, or NULL on failure
+ */
+J9ConcurrentHashTable *
+concurrentHashTableNew(
+	OMRPortLibrary *portLibrary,
+	const char *tableName,
+	uint32_t tableSize,
+	uint32_t entrySize,
+	uint32_t memoryCategory,
+	J9HashTableHashFn hashFn,
+	J9HashTableEqualFn hashEqualFn,
+	void *functionUserData)
+{
+	J9ConcurrentHashTable *table = NULL;
+	uintptr_t size = CONCURRENT_HASH_TABLE_SIZE_MIN;
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+
+	table = omrmem_allocate_memory(sizeof(J9ConcurrentHashTable), memoryCategory);
+	if (NULL == table) {
+		return NULL;
+	}
+	memset(table, 0, sizeof(J9ConcurrentHashTable));
+	table->tableName = tableName;
+	table->portLibrary = portLibrary;
+	table->entrySize = entrySize;
+	table->nodeSize = (uint32_t)(sizeof(J9ConcurrentHashTableNode) + entrySize);
+	table->memoryCategory = memoryCategory;
+	table->hashFn = hashFn;
+	table->hashEqualFn = hashEqualFn;
+	table->functionUserData = functionUserData;
+	/* 0 is the epoch of a reader outside any read section */
+	table->epoch = 1;
+
+	while (size < tableSize) {
+		size <<= 1;
+	}
+	table->buckets = concurrentHashTableAllocateBuckets(table, size);
+	if (NULL == table->buckets) {
+		omrmem_free_memory(table);
+		return NULL;
+	}
+	/* bucket 0 starts the list and is never unlinked */
+	table->buckets->heads[0] = concurrentHashTableAllocateBucket(table, 0);
+	if (NULL == table->buckets->heads[0]) {
+		omrmem_free_memory(table->buckets);
+		omrmem_free_memory(table);
+		return NULL;
+	}
+
+	if (0 != omrthread_tls_alloc_with_finalizer(&table->readerKey, concurrentHashTableReleaseReader)) {
+		omrmem_free_memory(table->buckets->heads[0]);
+		omrmem_free_memory(table->buckets);
+		omrmem_free_memory(table);
+		return NULL;
+	}
+
+	return table;
+}
+
+/**
+ * \brief       Free a concurrent hash table, all of its nodes and anything retired
+ * \ingroup     hash_table
+ *
+ * @param table The table, no other thread may be using it
+ */
+void
+concurrentHashTableFree(J9ConcurrentHashTable *table)
+{
+	if (NULL != table) {
+		OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+		J9ConcurrentHashTableNode *node = &table->buckets->heads[0]->node;
+		J9ConcurrentHashTableReader *reader = table->readers;
+
+		omrthread_tls_free(table->readerKey);
+		while (NULL != reader) {
+			J9ConcurrentHashTableReader *next = reader->next;
+			omrmem_free_memory(reader->allocation);
+			reader = next;
+		}
+
+		/* the list holds the bucket nodes as well as the entries */
+		while (NULL != node) {
+			J9ConcurrentHashTableNode *next = node->next;
+			omrmem_free_memory(node);
+			node = next;
+		}
+		omrmem_free_memory(table->buckets);
+		concurrentHashTableFreeRetired(table, table->limboNodes, table->limboBuckets);
+		concurrentHashTableFreeRetired(table, table->retiredNodes, table->retiredBuckets);
+		omrmem_free_memory(table);
+	}
+}
+
+/**
+ * \brief       Enter a read section
+ * \ingroup     hash_table
+ *
+ * Entries returned by the table stay readable until the calling thread leaves the
+ * read section, even if they are concurrently removed.  Sections may nest.  Only
+ * writes the reader of the calling thread, which is allocated by its first section.
+ *
+ * @param table The table
+ * @return  The section, to be passed to concurrentHashTableExit()
+ */
+uintptr_t
+concurrentHashTableEnter(J9ConcurrentHashTable *table)
+{
+	omrthread_t self = omrthread_self();
+	J9ConcurrentHashTableReader *reader = NULL;
+
+	if (NULL != self) {
+		reader = (J9ConcurrentHashTableReader *)omrthread_tls_get(self, table->readerKey);
+		if (NULL == reader) {
+			reader = concurrentHashTableClaimReader(table, self);
+		}
+	}
+
+	if (NULL == reader) {
+		/* threads which are not attached, or whose reader could not be allocated, are counted instead */
+		addAtomic(&table->unslottedReaders, 1);
+		issueReadWriteBarrier();
+	} else {
+		reader->depth += 1;
+		if (1 == reader->depth) {
+			reader->epoch = table->epoch;
+			/* the epoch must be visible to reclamation before anything is read from the table */
+			issueReadWriteBarrier();
+		}
+	}
+
+	return (uintptr_t)reader;
+}
+
+/**
+ * \brief       Leave a read section
+ * \ingroup     hash_table
+ *
+ * @param table The table
+ * @param section The section returned by the matching concurrentHashTableEnter()
+ */
+void
+concurrentHashTableExit(J9ConcurrentHashTable *table, uintptr_t section)
+{
+	J9ConcurrentHashTableReader *reader = (J9ConcurrentHashTableReader *)section;
+
+	if (NULL == reader) {
+		/* ensure that the accesses made in the section are complete before the reader leaves */
+		issueReadWriteBarrier();
+		subtractAtomic(&table->unslottedReaders, 1);
+	} else {
+		reader->depth -= 1;
+		if (0 == reader->depth) {
+			/* ensure that the accesses made in the section are complete before the reader leaves */
+			issueReadBarrier();
+			issueWriteBarrier();
+			reader->epoch = 0;
+		}
+	}
+}
+
+/**
+ * \brief       Find an entry in the table
+ * \ingroup     hash_table
+ *
+ * Only locks to link the bucket of the entry into the list, the first time the bucket
+ * is used after the table has grown.  If the caller is inside a read section, the returned entry stays
+ * readable until it leaves the section, even if it is concurrently removed.  Otherwise
+ * it may be freed as soon as it is concurrently removed.  Entries are never moved, but
+ * must be treated as immutable.
+ *
+ * @param table The table
+ * @param entry The entry to look for
+ * @return  The matching entry in the table, or NULL if not found
+ */
+void *
+concurrentHashTableFind(J9ConcurrentHashTable *table, void *entry)
+{
+	uintptr_t hash = concurrentHashTableHash(table, entry);
+	uintptr_t orderKey = ENTRY_ORDER_KEY(hash);
+	uintptr_t section = concurrentHashTableEnter(table);
+	J9ConcurrentHashTableBuckets *buckets = table->buckets;
+	J9ConcurrentHashTableBucket *bucket = concurrentHashTableGetBucket(table, buckets, hash & (buckets->size - 1));
+	J9ConcurrentHashTableNode *node = NULL;
+	void *found = NULL;
+
+	/* pairs with the write barriers which published the bucket and the nodes */
+	issueReadBarrier();
+
+	for (node = bucket->node.next; NULL != node; node = node->next) {
+		if (node->orderKey >= orderKey) {
+			break;
+		}
+	}
+	for (; (NULL != node) && (orderKey == node->orderKey); node = node->next) {
+		if (table->hashEqualFn(NODE_DATA(node), entry, table->functionUserData)) {
+			found = NODE_DATA(node);
+			break;
+		}
+	}
+	concurrentHashTableExit(table, section);
+
+	return found;
+}
+
+/**
+ * \brief       Add an entry to the table if an equal entry is not already present
+ * \ingroup     hash_table
+ *
+ * Locks only the bucket the entry belongs to, and links that bucket into the list
+ * first if the table has grown since it was last used.  The returned entry is only
+ * guaranteed to stay readable while the caller is inside a read section.
+ *
+ * @param table The table
+ * @param entry The entry to copy into the table
+ * @return  The existing or newly added entry in the table, or NULL on allocation failure
+ */
+void *
+concurrentHashTableAdd(J9ConcurrentHashTable *table, void *entry)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	uintptr_t hash = concurrentHashTableHash(table, entry);
+	uintptr_t orderKey = ENTRY_ORDER_KEY(hash);
+	J9ConcurrentHashTableBuckets *buckets = NULL;
+	J9ConcurrentHashTableBucket *bucket = NULL;
+	J9ConcurrentHashTableNode *previous = NULL;
+	J9ConcurrentHashTableNode *node = NULL;
+	J9ConcurrentHashTableNode *newNode = NULL;
+	uintptr_t numberOfNodes = 0;
+	BOOLEAN grown = FALSE;
+	uintptr_t section = concurrentHashTableEnter(table);
+
+	/* allocate before locking, so that the lock is never held across an allocation */
+	newNode = omrmem_allocate_memory(table->nodeSize, table->memoryCategory);
+	if (NULL == newNode) {
+		concurrentHashTableExit(table, section);
+		return NULL;
+	}
+	newNode->retiredNext = NULL;
+	newNode->orderKey = orderKey;
+	memcpy(NODE_DATA(newNode), entry, table->entrySize);
+
+	buckets = table->buckets;
+	bucket = concurrentHashTableGetBucket(table, buckets, hash & (buckets->size - 1));
+	previous = concurrentHashTableLockPosition(&bucket, orderKey);
+	for (node = previous->next; (NULL != node) && (orderKey == node->orderKey); node = node->next) {
+		if (table->hashEqualFn(NODE_DATA(node), entry, table->functionUserData)) {
+			concurrentHashTableUnlockBucket(bucket);
+			concurrentHashTableExit(table, section);
+			omrmem_free_memory(newNode);
+			return NODE_DATA(node);
+		}
+	}
+	newNode->next = previous->next;
+	/* the node must be complete before it can be reached */
+	issueWriteBarrier();
+	previous->next = newNode;
+	concurrentHashTableUnlockBucket(bucket);
+
+	numberOfNodes = addAtomic(&table->numberOfNodes, 1);
+	grown = concurrentHashTableGrow(table, buckets, numberOfNodes);
+	concurrentHashTableExit(table, section);
+
+	/* growth retires the replaced bucket array */
+	if (grown) {
+		concurrentHashTableAdvanceEpoch(table);
+	}
+
+	return NODE_DATA(newNode);
+}
+
+/**
+ * \brief       Remove an entry from the table
+ * \ingroup     hash_table
+ *
+ * The node is retired rather than freed, concurrent readers may still be using it.
+ * It is freed by a later update once every reader that could have seen it has left.
+ *
+ * @param table The table
+ * @param entry The entry to remove
+ * @return  0 on success, 1 if the entry was not found
+ */
+uint32_t
+concurrentHashTableRemove(J9ConcurrentHashTable *table, void *entry)
+{
+	uintptr_t hash = concurrentHashTableHash(table, entry);
+	uintptr_t orderKey = ENTRY_ORDER_KEY(hash);
+	J9ConcurrentHashTableBuckets *buckets = NULL;
+	J9ConcurrentHashTableBucket *bucket = NULL;
+	J9ConcurrentHashTableNode *previous = NULL;
+	J9ConcurrentHashTableNode *node = NULL;
+	uint32_t rc = 1;
+	uintptr_t section = concurrentHashTableEnter(table);
+
+	buckets = table->buckets;
+	bucket = concurrentHashTableGetBucket(table, buckets, hash & (buckets->size - 1));
+	previous = concurrentHashTableLockPosition(&bucket, orderKey);
+	for (node = previous->next; (NULL != node) && (orderKey == node->orderKey); previous = node, node = node->next) {
+		if (table->hashEqualFn(NODE_DATA(node), entry, table->functionUserData)) {
+			/* a reader standing on the node still sees a valid next pointer */
+			previous->next = node->next;
+			rc = 0;
+			break;
+		}
+	}
+	concurrentHashTableUnlockBucket(bucket);
+	if (0 == rc) {
+		concurrentHashTableRetireNode(table, node);
+		subtractAtomic(&table->numberOfNodes, 1);
+	}
+	concurrentHashTableExit(table, section);
+
+	if (0 == rc) {
+		concurrentHashTableAdvanceEpoch(table);
+	}
+
+	return rc;
+}
+
+/**
+ * \brief       Answer the number of entries in the table
+ * \ingroup     hash_table
+ *
+ * @param table The table
+ * @return  The number of entries, which may already be stale if other threads are updating the table
+ */
+uintptr_t
+concurrentHashTableGetCount(J9ConcurrentHashTable *table)
+{
+	return table->numberOfNodes;
+}
+
+/**
+ * \brief       Free removed nodes and replaced bucket arrays that no reader can still reach
+ * \ingroup     hash_table
+ *
+ * Updates reclaim retired memory as they go, this only needs to be called to release
+ * it sooner.  Never blocks.  Everything retired is freed if no thread is inside a
+ * read section.
+ *
+ * @param table The table
+ */
+void
+concurrentHashTableReclaim(J9ConcurrentHashTable *table)
+{
+	/* the first advance moves the retired memory into limbo, the second frees it */
+	if (concurrentHashTableAdvanceEpoch(table)) {
+		concurrentHashTableAdvanceEpoch(table);
+	}
+}
+
+/**
+ * Mix the user hash so that a power of two bucket count sees well distributed low bits.
+ */
+static uintptr_t
+concurrentHashTableHash(J9ConcurrentHashTable *table, void *entry)
+{
+	uintptr_t hash = table->hashFn(entry, table->functionUserData);
+
+	hash ^= hash >> 16;
+	hash *= 0x45d9f3b;
+	hash ^= hash >> 16;
+
+	return hash;
+}
+
+/**
+ * Reverse the bits of value, so that the buckets a bucket splits into sort right after it.
+ */
+static uintptr_t
+concurrentHashTableReverseBits(uintptr_t value)
+{
+#if defined(OMR_ENV_DATA64)
+	value = ((value >> 1) & 0x5555555555555555) | ((value & 0x5555555555555555) << 1);
+	value = ((value >> 2) & 0x3333333333333333) | ((value & 0x3333333333333333) << 2);
+	value = ((value >> 4) & 0x0F0F0F0F0F0F0F0F) | ((value & 0x0F0F0F0F0F0F0F0F) << 4);
+	value = ((value >> 8) & 0x00FF00FF00FF00FF) | ((value & 0x00FF00FF00FF00FF) << 8);
+	value = ((value >> 16) & 0x0000FFFF0000FFFF) | ((value & 0x0000FFFF0000FFFF) << 16);
+	value = (value >> 32) | (value << 32);
+#else /* defined(OMR_ENV_DATA64) */
+	value = ((value >> 1) & 0x55555555) | ((value & 0x55555555) << 1);
+	value = ((value >> 2) & 0x33333333) | ((value & 0x33333333) << 2);
+	value = ((value >> 4) & 0x0F0F0F0F) | ((value & 0x0F0F0F0F) << 4);
+	value = ((value >> 8) & 0x00FF00FF) | ((value & 0x00FF00FF) << 8);
+	value = (value >> 16) | (value << 16);
+#endif /* defined(OMR_ENV_DATA64) */
+
+	return value;
+}
+
+static J9ConcurrentHashTableBuckets *
+concurrentHashTableAllocateBuckets(J9ConcurrentHashTable *table, uintptr_t size)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	uintptr_t allocSize = offsetof(J9ConcurrentHashTableBuckets, heads) + (size * sizeof(J9ConcurrentHashTableBucket *));
+	J9ConcurrentHashTableBuckets *buckets = omrmem_allocate_memory(allocSize, table->memoryCategory);
+
+	if (NULL != buckets) {
+		memset(buckets, 0, allocSize);
+		buckets->size = size;
+	}
+
+	return buckets;
+}
+
+static J9ConcurrentHashTableBucket *
+concurrentHashTableAllocateBucket(J9ConcurrentHashTable *table, uintptr_t index)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	J9ConcurrentHashTableBucket *bucket = omrmem_allocate_memory(sizeof(J9ConcurrentHashTableBucket), table->memoryCategory);
+
+	if (NULL != bucket) {
+		bucket->node.next = NULL;
+		bucket->node.retiredNext = NULL;
+		bucket->node.orderKey = BUCKET_ORDER_KEY(index);
+		bucket->lock = 0;
+	}
+
+	return bucket;
+}
+
+/**
+ * Answer the bucket at index, linking it into the list after the bucket it splits from
+ * if no update has needed it yet.  Another thread may link the same bucket through an
+ * older or newer bucket array, the bucket node already in the list is then used.  If the
+ * bucket node cannot be allocated, the bucket it splits from is answered instead.
+ */
+static J9ConcurrentHashTableBucket *
+concurrentHashTableGetBucket(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets, uintptr_t index)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	J9ConcurrentHashTableBucket *bucket = buckets->heads[index];
+	J9ConcurrentHashTableBucket *parent = NULL;
+	J9ConcurrentHashTableBucket *newBucket = NULL;
+	J9ConcurrentHashTableNode *previous = NULL;
+	uintptr_t parentMask = 0;
+
+	if (NULL != bucket) {
+		return bucket;
+	}
+
+	/* the parent is the index less its top bit */
+	parentMask = (buckets->size - 1) >> 1;
+	while (index == (index & parentMask)) {
+		parentMask >>= 1;
+	}
+	parent = concurrentHashTableGetBucket(table, buckets, index & parentMask);
+
+	newBucket = concurrentHashTableAllocateBucket(table, index);
+	if (NULL == newBucket) {
+		return parent;
+	}
+
+	bucket = parent;
+	previous = concurrentHashTableLockPosition(&bucket, newBucket->node.orderKey);
+	if ((NULL != previous->next) && (newBucket->node.orderKey == previous->next->orderKey)) {
+		concurrentHashTableUnlockBucket(bucket);
+		omrmem_free_memory(newBucket);
+		newBucket = (J9ConcurrentHashTableBucket *)previous->next;
+	} else {
+		newBucket->node.next = previous->next;
+		issueWriteBarrier();
+		previous->next = &newBucket->node;
+		concurrentHashTableUnlockBucket(bucket);
+	}
+	buckets->heads[index] = newBucket;
+
+	return newBucket;
+}
+
+static void
+concurrentHashTableLockBucket(J9ConcurrentHashTableBucket *bucket)
+{
+	uintptr_t spins = 1;
+
+	for (;;) {
+		if ((0 == bucket->lock) && (0 == compareAndSwapUDATA((uintptr_t *)&bucket->lock, 0, 1))) {
+			issueReadBarrier();
+			return;
+		} else if (spins < CONCURRENT_HASH_TABLE_SPIN_MAX) {
+			/* back off exponentially, polling the lock without writing it */
+			uintptr_t spin = 0;
+
+			for (spin = 0; (spin < spins) && (0 != bucket->lock); spin++) {
+				issueReadBarrier();
+			}
+			spins <<= 1;
+		} else {
+			/* the holder may not be running, give up the processor */
+			omrthread_yield();
+		}
+	}
+}
+
+/**
+ * Release the bucket lock, publishing the updates made while it was held.
+ */
+static void
+concurrentHashTableUnlockBucket(J9ConcurrentHashTableBucket *bucket)
+{
+	issueWriteBarrier();
+	bucket->lock = 0;
+}
+
+/**
+ * Lock the bucket whose nodes include the position of orderKey, starting from *bucket.
+ * Buckets linked since *bucket was chosen may start before the position, their locks
+ * are taken in list order, releasing the previous one each time.
+ * @param[in/out] bucket the bucket to start from, the locked bucket on return
+ * @return the last node whose order key is lower than orderKey
+ */
+static J9ConcurrentHashTableNode *
+concurrentHashTableLockPosition(J9ConcurrentHashTableBucket **bucket, uintptr_t orderKey)
+{
+	J9ConcurrentHashTableNode *previous = &(*bucket)->node;
+	J9ConcurrentHashTableNode *node = NULL;
+
+	concurrentHashTableLockBucket(*bucket);
+	for (node = previous->next; (NULL != node) && (node->orderKey < orderKey); node = node->next) {
+		if (IS_BUCKET_NODE(node)) {
+			concurrentHashTableLockBucket((J9ConcurrentHashTableBucket *)node);
+			concurrentHashTableUnlockBucket(*bucket);
+			*bucket = (J9ConcurrentHashTableBucket *)node;
+		}
+		previous = node;
+	}
+
+	return previous;
+}
+
+/**
+ * Give the calling thread a reader, reusing the reader of a thread which has terminated
+ * if there is one.  Readers are never unlinked, so they are found without locking.
+ * @return the reader, or NULL if none could be allocated
+ */
+static J9ConcurrentHashTableReader *
+concurrentHashTableClaimReader(J9ConcurrentHashTable *table, omrthread_t self)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	J9ConcurrentHashTableReader *reader = NULL;
+
+	for (reader = table->readers; NULL != reader; reader = reader->next) {
+		if ((0 == reader->inUse) && (0 == compareAndSwapUDATA((uintptr_t *)&reader->inUse, 0, 1))) {
+			break;
+		}
+	}
+
+	if (NULL == reader) {
+		J9ConcurrentHashTableReader *oldHead = NULL;
+		/* two cache lines hold a whole aligned one */
+		void *allocation = omrmem_allocate_memory(2 * CONCURRENT_HASH_TABLE_CACHE_LINE, table->memoryCategory);
+
+		if (NULL == allocation) {
+			return NULL;
+		}
+		reader = (J9ConcurrentHashTableReader *)(((uintptr_t)allocation + CONCURRENT_HASH_TABLE_CACHE_LINE - 1) & ~(uintptr_t)(CONCURRENT_HASH_TABLE_CACHE_LINE - 1));
+		reader->allocation = allocation;
+		reader->inUse = 1;
+		do {
+			oldHead = table->readers;
+			reader->next = oldHead;
+			issueWriteBarrier();
+		} while ((uintptr_t)oldHead != compareAndSwapUDATA((uintptr_t *)&table->readers, (uintptr_t)oldHead, (uintptr_t)reader));
+	}
+
+	reader->epoch = 0;
+	reader->depth = 0;
+	omrthread_tls_set(self, table->readerKey, reader);
+
+	return reader;
+}
+
+/**
+ * Thread local storage finalizer which makes the reader of a terminating thread available to other threads.
+ */
+static void
+concurrentHashTableReleaseReader(void *reader)
+{
+	((J9ConcurrentHashTableReader *)reader)->epoch = 0;
+	issueWriteBarrier();
+	((J9ConcurrentHashTableReader *)reader)->inUse = 0;
+}
+
+static void
+concurrentHashTableRetireNode(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *node)
+{
+	J9ConcurrentHashTableNode *oldHead = NULL;
+
+	do {
+		oldHead = table->retiredNodes;
+		node->retiredNext = oldHead;
+	} while ((uintptr_t)oldHead != compareAndSwapUDATA((uintptr_t *)&table->retiredNodes, (uintptr_t)oldHead, (uintptr_t)node));
+}
+
+static void
+concurrentHashTableRetireBuckets(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets)
+{
+	J9ConcurrentHashTableBuckets *oldHead = NULL;
+
+	do {
+		oldHead = table->retiredBuckets;
+		buckets->retiredNext = oldHead;
+	} while ((uintptr_t)oldHead != compareAndSwapUDATA((uintptr_t *)&table->retiredBuckets, (uintptr_t)oldHead, (uintptr_t)buckets));
+}
+
+/**
+ * Advance the epoch if no reader holds an epoch from before the limbo lists were filled:
+ * free the limbo lists, which only such readers could reach, and move the retired lists
+ * into limbo.  Only one thread advances the epoch at a time, others give up rather than wait.
+ * @return TRUE if the epoch was advanced, FALSE otherwise
+ */
+static BOOLEAN
+concurrentHashTableAdvanceEpoch(J9ConcurrentHashTable *table)
+{
+	uintptr_t epoch = 0;
+	J9ConcurrentHashTableReader *reader = NULL;
+	J9ConcurrentHashTableNode *nodes = NULL;
+	J9ConcurrentHashTableBuckets *buckets = NULL;
+
+	if ((0 != table->reclaiming) || (0 != compareAndSwapUDATA((uintptr_t *)&table->reclaiming, 0, 1))) {
+		return FALSE;
+	}
+	issueReadWriteBarrier();
+	epoch = table->epoch;
+	if ((NULL != table->limboNodes) || (NULL != table->limboBuckets)) {
+		/* the epoch of a read section without a reader is unknown */
+		if (0 != table->unslottedReaders) {
+			table->reclaiming = 0;
+			return FALSE;
+		}
+		for (reader = table->readers; NULL != reader; reader = reader->next) {
+			uintptr_t readerEpoch = reader->epoch;
+			if ((0 != readerEpoch) && (readerEpoch <= table->limboEpoch)) {
+				table->reclaiming = 0;
+				return FALSE;
+			}
+		}
+	}
+	issueReadBarrier();
+
+	concurrentHashTableFreeRetired(table, table->limboNodes, table->limboBuckets);
+	do {
+		nodes = table->retiredNodes;
+	} while ((uintptr_t)nodes != compareAndSwapUDATA((uintptr_t *)&table->retiredNodes, (uintptr_t)nodes, 0));
+	do {
+		buckets = table->retiredBuckets;
+	} while ((uintptr_t)buckets != compareAndSwapUDATA((uintptr_t *)&table->retiredBuckets, (uintptr_t)buckets, 0));
+	table->limboNodes = nodes;
+	table->limboBuckets = buckets;
+	table->limboEpoch = epoch;
+
+	/* everything in limbo was unlinked before readers of the new epoch can enter */
+	issueWriteBarrier();
+	table->epoch = epoch + 1;
+	issueWriteBarrier();
+	table->reclaiming = 0;
+
+	return TRUE;
+}
+
+static void
+concurrentHashTableFreeRetired(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *node, J9ConcurrentHashTableBuckets *buckets)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+
+	while (NULL != node) {
+		J9ConcurrentHashTableNode *next = node->retiredNext;
+		omrmem_free_memory(node);
+		node = next;
+	}
+	while (NULL != buckets) {
+		J9ConcurrentHashTableBuckets *next = buckets->retiredNext;
+		omrmem_free_memory(buckets);
+		buckets = next;
+	}
+}
+
+/**
+ * Once the load factor exceeds one, replace the bucket array with one of twice the size
+ * holding the same buckets.  The new buckets are linked into the list by the operations
+ * which need them.  A bucket linked into the old array after it was copied is found
+ * again in the list.  The caller must be inside a read section.
+ * @return TRUE if the old bucket array was retired, FALSE otherwise
+ */
+static BOOLEAN
+concurrentHashTableGrow(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets, uintptr_t numberOfNodes)
+{
+	if ((numberOfNodes > buckets->size) && (buckets == table->buckets)) {
+		OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+		J9ConcurrentHashTableBuckets *newBuckets = concurrentHashTableAllocateBuckets(table, buckets->size * 2);
+
+		/* failing to grow only costs longer chains */
+		if (NULL != newBuckets) {
+			uintptr_t index = 0;
+
+			for (index = 0; index < buckets->size; index++) {
+				newBuckets->heads[index] = buckets->heads[index];
+			}
+			issueWriteBarrier();
+			if ((uintptr_t)buckets == compareAndSwapUDATA((uintptr_t *)&table->buckets, (uintptr_t)buckets, (uintptr_t)newBuckets)) {
+				concurrentHashTableRetireBuckets(table, buckets);
+				return TRUE;
+			}
+			omrmem_free_memory(newBuckets);
+		}
+	}
+
+	return FALSE;
+}
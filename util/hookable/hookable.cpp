@@ -20,6 +20,7 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <stddef.h>
 #include <string.h>
 #include <stdarg.h>
 #include "pool_api.h"
@@ -43,6 +44,14 @@ static void J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t tag
 static intptr_t J9HookReserve(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum);
 static uintptr_t J9HookAllocateAgentID(struct J9HookInterface **hookInterface);
 static void J9HookDeallocateAgentID(struct J9HookInterface **hookInterface, uintptr_t agentID);
+static void J9HookReadRegistrationArgs(uintptr_t taggedEventNum, va_list args, uintptr_t *agentID, uintptr_t *samplingPeriod, uintptr_t *rateLimit);
+static bool J9HookSampleListener(J9CommonHookInterface *commonInterface, J9HookRecord *record, uintptr_t samplingPeriod, uintptr_t rateLimit);
+static intptr_t J9HookPublishListeners(J9CommonHookInterface *commonInterface, uintptr_t eventNum);
+static void J9HookReclaimListeners(J9CommonHookInterface *commonInterface);
+static J9HookDispatchSlot *J9HookEnterDispatch(J9CommonHookInterface *commonInterface);
+static void J9HookExitDispatch(J9CommonHookInterface *commonInterface, J9HookDispatchSlot *slot);
+static J9HookDispatchSlot *J9HookClaimDispatchSlot(J9CommonHookInterface *commonInterface, omrthread_t self);
+static void J9HookReleaseDispatchSlot(void *slot);
 
 static const J9HookInterface hookFunctionTable = {
 	J9HookDispatch,
@@ -77,15 +86,26 @@ static const J9HookInterface hookFunctionTable = {
 1C: record[0]
 */
 
-/* each record has an ID which is used to detect inconsistent records without resorting to monitors */
+/* records are only read and written with the interface lock held. Dispatch reads the copy-on-write
+ * listener array of the event instead, which registration replaces whenever the valid records change.
+ */
+
+/* each record has an ID which is used to detect stale listeners without resorting to monitors */
 /* even IDs are valid. Odd IDs are invalid */
-/* a record is consistent if the same ID is in the record before all the fields are read and after all the fields are read */
-/* read and write barriers must be used to ensure that reads and writes occur in the correct order */
+/* a listener is stale if the ID of its record has changed since the listener array was published */
 #define HOOK_INITIAL_ID (0)
 #define HOOK_IS_VALID_ID(id) ( ((id) & 1) == 0)
 #define HOOK_INVALID_ID(id) ((id) | 1)
 #define HOOK_VALID_ID(id) ( (((id) | 1) + 1) )
 
+/* a rate limit window packs the second it covers and the number of events delivered in it into 64 bits */
+#define HOOK_RATE_WINDOW_SECOND(window) ((window) >> 32)
+#define HOOK_RATE_WINDOW_COUNT(window) ((window) & 0xFFFFFFFF)
+#define HOOK_RATE_WINDOW(second, count) (((uint64_t)(second) << 32) | (uint64_t)(count))
+
+/* dispatch slots are aligned to a cache line so that a dispatching thread only writes a line of its own */
+#define HOOK_DISPATCH_SLOT_ALIGNMENT 64
+
 
 intptr_t
 omrhook_lib_control(const char *key, uintptr_t value)
@@ -121,12 +141,14 @@ intptr_t
 J9HookInitializeInterface(struct J9HookInterface **hookInterface, OMRPortLibrary *portLib, size_t interfaceSize)
 {
 	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
 
 	memset(commonInterface, 0, interfaceSize);
 
 	commonInterface->hookInterface = (J9HookInterface *)GLOBAL_TABLE(hookFunctionTable);
 
 	commonInterface->size = interfaceSize;
+	commonInterface->portLib = portLib;
 
 	if (omrthread_monitor_init_with_name(&commonInterface->lock, 0, "Hook Interface")) {
 		J9HookShutdownInterface(hookInterface);
@@ -139,11 +161,30 @@ J9HookInitializeInterface(struct J9HookInterface **hookInterface, OMRPortLibrary
 		return J9HOOK_ERR_NOMEM;
 	}
 
+	commonInterface->dispatchSlots = pool_new(sizeof(J9HookDispatchSlot), 0, HOOK_DISPATCH_SLOT_ALIGNMENT, 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT((OMRPortLibrary *)portLib));
+	if (NULL == commonInterface->dispatchSlots) {
+		J9HookShutdownInterface(hookInterface);
+		return J9HOOK_ERR_NOMEM;
+	}
+
+	if (0 != omrthread_tls_alloc_with_finalizer(&commonInterface->dispatchSlotKey, J9HookReleaseDispatchSlot)) {
+		J9HookShutdownInterface(hookInterface);
+		return J9HOOK_ERR_NOMEM;
+	}
+
+	/* 0 is the epoch of a slot with no dispatch in progress */
+	commonInterface->dispatchEpoch = 1;
 	commonInterface->nextAgentID = J9HOOK_AGENTID_DEFAULT + 1;
-	commonInterface->portLib = portLib;
 	commonInterface->threshold4Trace = OMRHOOK_DEFAULT_THRESHOLD_IN_MICROSECONDS_WARNING_CALLBACK_ELAPSED_TIME;
 
 	commonInterface->eventSize = (interfaceSize - sizeof(J9CommonHookInterface)) / (sizeof(U_8) + sizeof(OMREventInfo4Dump) + sizeof(J9HookRecord*));
+
+	commonInterface->listeners = (J9HookListenerArray **)omrmem_allocate_memory(commonInterface->eventSize * sizeof(J9HookListenerArray *), OMRMEM_CATEGORY_VM);
+	if (NULL == commonInterface->listeners) {
+		J9HookShutdownInterface(hookInterface);
+		return J9HOOK_ERR_NOMEM;
+	}
+	memset((void *)commonInterface->listeners, 0, commonInterface->eventSize * sizeof(J9HookListenerArray *));
 	return 0;
 }
 
@@ -164,6 +205,34 @@ J9HookShutdownInterface(struct J9HookInterface **hookInterface)
 	if (commonInterface->pool) {
 		pool_kill(commonInterface->pool);
 	}
+
+	if (0 != commonInterface->dispatchSlotKey) {
+		omrthread_tls_free(commonInterface->dispatchSlotKey);
+		commonInterface->dispatchSlotKey = 0;
+	}
+
+	if (NULL != commonInterface->dispatchSlots) {
+		pool_kill(commonInterface->dispatchSlots);
+		commonInterface->dispatchSlots = NULL;
+	}
+
+	if (NULL != commonInterface->listeners) {
+		OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+		J9HookListenerArray *retired = commonInterface->retiredListeners;
+
+		for (uintptr_t eventNum = 0; eventNum < commonInterface->eventSize; eventNum++) {
+			omrmem_free_memory(commonInterface->listeners[eventNum]);
+		}
+		omrmem_free_memory((void *)commonInterface->listeners);
+		commonInterface->listeners = NULL;
+
+		while (NULL != retired) {
+			J9HookListenerArray *next = retired->retiredNext;
+			omrmem_free_memory(retired);
+			retired = next;
+		}
+		commonInterface->retiredListeners = NULL;
+	}
 }
 
 
@@ -171,10 +240,17 @@ J9HookShutdownInterface(struct J9HookInterface **hookInterface)
  * Inform all registered listeners that the specified event has occurred. Details about the
  * event should be available through eventData.
  *
+ * Dispatch takes no lock and does not wait for registration. It reads the listener array
+ * which was published for the event when its listeners last changed, after recording the
+ * current dispatch epoch in the dispatch slot of the calling thread.
+ *
  * If the J9HOOK_TAG_ONCE bit is set in the taggedEventNum, then the event is disabled
  * before the listeners are informed. Any attempts to add listeners to a TAG_ONCE event
  * once it has been reported will fail.
  *
+ * Listeners registered with J9HOOK_TAG_SAMPLED or J9HOOK_TAG_RATE_LIMITED are skipped
+ * for the events they do not sample before any of the dispatch bookkeeping is done.
+ *
  * This function should not be called directly. It should be called through the hook interface
  *
  */
@@ -183,10 +259,11 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 {
 	uintptr_t eventNum = taggedEventNum & J9HOOK_EVENT_NUM_MASK;
 	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
-	J9HookRecord *record = HOOK_RECORD(commonInterface, eventNum);
 	OMREventInfo4Dump *eventDump = J9HOOK_DUMPINFO(commonInterface, eventNum);
 	uintptr_t samplingInterval = (taggedEventNum & J9HOOK_TAG_SAMPLING_MASK) >> 16;
 	bool sampling = false;
+	J9HookListenerArray *listenerArray = NULL;
+	J9HookDispatchSlot *slot = NULL;
 
 	if (taggedEventNum & J9HOOK_TAG_ONCE) {
 		uint8_t oldFlags;
@@ -203,74 +280,181 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 		}
 	}
 
-	while (record) {
-		J9HookFunction function;
-		void *userData;
-		uintptr_t id;
+	/* an event with no listeners needs no array, so nothing has to be protected */
+	if (NULL == commonInterface->listeners[eventNum]) {
+		return;
+	}
 
-		/* ensure that the id is read before any other fields */
-		id = record->id;
-		if (HOOK_IS_VALID_ID(id)) {
-			VM_AtomicSupport::readBarrier();
+	/* announce the dispatch before reading the array so that registration does not free it while it is in use */
+	slot = J9HookEnterDispatch(commonInterface);
 
-			function = record->function;
-			userData = record->userData;
+	listenerArray = commonInterface->listeners[eventNum];
+	if (NULL == listenerArray) {
+		J9HookExitDispatch(commonInterface, slot);
+		return;
+	}
+	/* ensure that the array is read after the pointer to it */
+	VM_AtomicSupport::readBarrier();
 
-			/* now read the id again to make sure that nothing has changed */
-			VM_AtomicSupport::readBarrier();
-			if (record->id == id) {
-				uint64_t startTime = 0;
-				uintptr_t count = 0;
-				if (NULL != eventDump) {
-					count = VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->count, 1);
-					sampling = (1 >= samplingInterval) || ((100 >= samplingInterval) && (0 == (count % samplingInterval)));
-				} else {
-					sampling =  false;
-				}
-				OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
-				if (sampling) {
-					startTime = omrtime_usec_clock(); 
-				}
+	for (uintptr_t i = 0; i < listenerArray->count; i++) {
+		J9HookListener *listener = &listenerArray->listeners[i];
+		J9HookRecord *record = listener->record;
 
-				function(hookInterface, eventNum, eventData, userData);
+		/* skip listeners which have been unregistered since the array was published */
+		if ((record->id == listener->id)
+			&& (((0 == listener->samplingPeriod) && (0 == listener->rateLimit)) || J9HookSampleListener(commonInterface, record, listener->samplingPeriod, listener->rateLimit))
+		) {
+			uint64_t startTime = 0;
+			uintptr_t count = 0;
+			if (NULL != eventDump) {
+				count = VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->count, 1);
+				sampling = (1 >= samplingInterval) || ((100 >= samplingInterval) && (0 == (count % samplingInterval)));
+			} else {
+				sampling =  false;
+			}
+			OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+			if (sampling) {
+				startTime = omrtime_usec_clock(); 
+			}
 
-				if (sampling) {
-					uint64_t timeDelta = omrtime_hires_delta(startTime, omrtime_usec_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			listener->function(hookInterface, eventNum, eventData, listener->userData);
 
-					eventDump->lastHook.startTime = startTime;
-					eventDump->lastHook.callsite = record->callsite;
-					eventDump->lastHook.func_ptr = (void *)record->function;
-					eventDump->lastHook.duration = timeDelta;
-					VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->totalTime, (uintptr_t)timeDelta);
+			if (sampling) {
+				uint64_t timeDelta = omrtime_hires_delta(startTime, omrtime_usec_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
 
-					if ((eventDump->longestHook.duration < timeDelta) ||
-						(0 == eventDump->longestHook.startTime)) {
-							eventDump->longestHook.startTime = startTime;
-							eventDump->longestHook.callsite = record->callsite;
-							eventDump->longestHook.func_ptr = (void *)record->function;
-							eventDump->longestHook.duration = timeDelta;
-					}
+				eventDump->lastHook.startTime = startTime;
+				eventDump->lastHook.callsite = listener->callsite;
+				eventDump->lastHook.func_ptr = (void *)listener->function;
+				eventDump->lastHook.duration = timeDelta;
+				VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->totalTime, (uintptr_t)timeDelta);
 
-					if (commonInterface->threshold4Trace <= timeDelta) {
-						const char *callsite = "UNKNOWN";
-						char buffer[32];
-						if (NULL != record->callsite) {
-							callsite = record->callsite;
-						} else {
-							/* if the callsite info can not be retrieved, use callback function pointer instead  */
-							omrstr_printf(buffer, sizeof(buffer), "0x%p", record->function);
-							callsite = buffer;
-						}
-						Trc_Hook_Dispatch_Exceed_Threshold_Event(callsite, timeDelta);
+				if ((eventDump->longestHook.duration < timeDelta) ||
+					(0 == eventDump->longestHook.startTime)) {
+						eventDump->longestHook.startTime = startTime;
+						eventDump->longestHook.callsite = listener->callsite;
+						eventDump->longestHook.func_ptr = (void *)listener->function;
+						eventDump->longestHook.duration = timeDelta;
+				}
+
+				if (commonInterface->threshold4Trace <= timeDelta) {
+					const char *callsite = "UNKNOWN";
+					char buffer[32];
+					if (NULL != listener->callsite) {
+						callsite = listener->callsite;
+					} else {
+						/* if the callsite info can not be retrieved, use callback function pointer instead  */
+						omrstr_printf(buffer, sizeof(buffer), "0x%p", listener->function);
+						callsite = buffer;
 					}
+					Trc_Hook_Dispatch_Exceed_Threshold_Event(callsite, timeDelta);
 				}
-			} else {
-				/* this record has been updated while we were reading it. Skip it. */
 			}
 		}
+	}
 
-		record = record->next;
+	J9HookExitDispatch(commonInterface, slot);
+}
+
+/*
+ * Record that the calling thread is about to read a listener array. The outermost dispatch of a
+ * thread stores the current dispatch epoch in the thread's slot, so that publication keeps every
+ * array retired since then. Nested dispatches are covered by the epoch of the outermost one.
+ * Threads which have no slot (e.g. threads not attached to the thread library) are counted instead.
+ *
+ * Returns the slot of the calling thread, or NULL if it was counted
+ */
+static J9HookDispatchSlot *
+J9HookEnterDispatch(J9CommonHookInterface *commonInterface)
+{
+	omrthread_t self = omrthread_self();
+	J9HookDispatchSlot *slot = NULL;
+
+	if (NULL != self) {
+		slot = (J9HookDispatchSlot *)omrthread_tls_get(self, commonInterface->dispatchSlotKey);
+		if (NULL == slot) {
+			slot = J9HookClaimDispatchSlot(commonInterface, self);
+		}
+	}
+
+	if (NULL == slot) {
+		VM_AtomicSupport::add(&commonInterface->unslottedDispatches, 1);
+		VM_AtomicSupport::readWriteBarrier();
+	} else {
+		slot->depth += 1;
+		if (1 == slot->depth) {
+			slot->epoch = commonInterface->dispatchEpoch;
+			/* the epoch must be visible to publication before the listener array is read */
+			VM_AtomicSupport::readWriteBarrier();
+		}
 	}
+
+	return slot;
+}
+
+/*
+ * Record that the calling thread has finished reading the listener array it read after
+ * J9HookEnterDispatch returned slot.
+ */
+static void
+J9HookExitDispatch(J9CommonHookInterface *commonInterface, J9HookDispatchSlot *slot)
+{
+	if (NULL == slot) {
+		/* ensure that the array has been read before the dispatch is retired */
+		VM_AtomicSupport::readWriteBarrier();
+		VM_AtomicSupport::subtract(&commonInterface->unslottedDispatches, 1);
+	} else {
+		slot->depth -= 1;
+		if (0 == slot->depth) {
+			/* ensure that the array has been read before the slot is cleared */
+			VM_AtomicSupport::readBarrier();
+			VM_AtomicSupport::writeBarrier();
+			slot->epoch = 0;
+		}
+	}
+}
+
+/*
+ * Give the calling thread a dispatch slot, reusing the slot of a thread which has terminated
+ * if there is one. This is done once per thread, on its first dispatch of a hooked event.
+ *
+ * Returns the slot, or NULL if none could be allocated
+ */
+static J9HookDispatchSlot *
+J9HookClaimDispatchSlot(J9CommonHookInterface *commonInterface, omrthread_t self)
+{
+	J9HookDispatchSlot *slot = NULL;
+	pool_state walkState;
+
+	omrthread_monitor_enter(commonInterface->lock);
+
+	slot = (J9HookDispatchSlot *)pool_startDo(commonInterface->dispatchSlots, &walkState);
+	while ((NULL != slot) && (0 != slot->inUse)) {
+		slot = (J9HookDispatchSlot *)pool_nextDo(&walkState);
+	}
+	if (NULL == slot) {
+		slot = (J9HookDispatchSlot *)pool_newElement(commonInterface->dispatchSlots);
+	}
+	if (NULL != slot) {
+		slot->epoch = 0;
+		slot->depth = 0;
+		slot->inUse = 1;
+		omrthread_tls_set(self, commonInterface->dispatchSlotKey, slot);
+	}
+
+	omrthread_monitor_exit(commonInterface->lock);
+
+	return slot;
+}
+
+/*
+ * Thread local storage finalizer which makes the slot of a terminating thread available to other threads.
+ */
+static void
+J9HookReleaseDispatchSlot(void *slot)
+{
+	((J9HookDispatchSlot *)slot)->epoch = 0;
+	VM_AtomicSupport::writeBarrier();
+	((J9HookDispatchSlot *)slot)->inUse = 0;
 }
 
 
@@ -346,7 +530,7 @@ J9HookReserve(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum)
 }
 
 static intptr_t
-J9HookRegisterWithCallSitePrivate(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum, J9HookFunction function, const char *callsite, void *userData, uintptr_t agentID)
+J9HookRegisterWithCallSitePrivate(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum, J9HookFunction function, const char *callsite, void *userData, uintptr_t agentID, uintptr_t samplingPeriod, uintptr_t rateLimit)
 {
 	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
 	J9HookRegistrationEvent eventStruct;
@@ -395,12 +579,18 @@ J9HookRegisterWithCallSitePrivate(struct J9HookInterface **hookInterface, uintpt
 			emptyRecord->userData = userData;
 			emptyRecord->count = 1;
 			emptyRecord->agentID = agentID;
-
-			VM_AtomicSupport::writeBarrier();
-
+			emptyRecord->samplingPeriod = samplingPeriod;
+			emptyRecord->samplingCount = 0;
+			emptyRecord->rateLimit = rateLimit;
+			emptyRecord->rateLimitWindow = 0;
 			emptyRecord->id = HOOK_VALID_ID(emptyRecord->id);
 
-			HOOK_FLAGS(commonInterface, eventNum) |= J9HOOK_FLAG_HOOKED | J9HOOK_FLAG_RESERVED;
+			rc = J9HookPublishListeners(commonInterface, eventNum);
+			if (0 == rc) {
+				HOOK_FLAGS(commonInterface, eventNum) |= J9HOOK_FLAG_HOOKED | J9HOOK_FLAG_RESERVED;
+			} else {
+				emptyRecord->id = HOOK_INVALID_ID(emptyRecord->id);
+			}
 		} else {
 			record = (J9HookRecord *)pool_newElement(commonInterface->pool);
 			if (record == NULL) {
@@ -417,8 +607,10 @@ J9HookRegisterWithCallSitePrivate(struct J9HookInterface **hookInterface, uintpt
 				record->count = 1;
 				record->id = HOOK_INITIAL_ID;
 				record->agentID = agentID;
-
-				VM_AtomicSupport::writeBarrier();
+				record->samplingPeriod = samplingPeriod;
+				record->samplingCount = 0;
+				record->rateLimit = rateLimit;
+				record->rateLimitWindow = 0;
 
 				if (insertionPoint == NULL) {
 					HOOK_RECORD(commonInterface, eventNum) = record;
@@ -426,7 +618,13 @@ J9HookRegisterWithCallSitePrivate(struct J9HookInterface **hookInterface, uintpt
 					insertionPoint->next = record;
 				}
 
-				HOOK_FLAGS(commonInterface, eventNum) |= J9HOOK_FLAG_HOOKED | J9HOOK_FLAG_RESERVED;
+				rc = J9HookPublishListeners(commonInterface, eventNum);
+				if (0 == rc) {
+					HOOK_FLAGS(commonInterface, eventNum) |= J9HOOK_FLAG_HOOKED | J9HOOK_FLAG_RESERVED;
+				} else {
+					/* leave the record in the list as an empty record for a later registration */
+					record->id = HOOK_INVALID_ID(record->id);
+				}
 			}
 		}
 	}
@@ -458,6 +656,12 @@ J9HookRegisterWithCallSitePrivate(struct J9HookInterface **hookInterface, uintpt
  * The special J9HOOK_AGENT_FIRST and J9HOOK_AGENT_LAST IDs may be used to register
  * listeners which will be among the first or last to receive an event.
  *
+ * If the J9HOOK_TAG_SAMPLED bit is set, the next var-args argument must be a uintptr_t N,
+ * and the listener will only receive every Nth event. If the J9HOOK_TAG_RATE_LIMITED bit is
+ * set, the next var-args argument must be a uintptr_t K, and the listener will receive at most
+ * K events per second. Both may be combined. The arguments follow the agent ID, if there is one.
+ * Re-registering a listener which is already registered does not change its sampling.
+ *
  * This function should not be called directly. It should be called through the hook interface
  *
  * Returns 0 on success,
@@ -469,32 +673,212 @@ static intptr_t
 J9HookRegister(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum, J9HookFunction function, void *userData, ...)
 {
 	uintptr_t agentID = J9HOOK_AGENTID_DEFAULT;
-
-	if (taggedEventNum & J9HOOK_TAG_AGENT_ID) {
-		va_list args;
-
-		va_start(args, userData);
-		agentID = va_arg(args, uintptr_t);
-		va_end(args);
-	}
-	return J9HookRegisterWithCallSitePrivate(hookInterface, taggedEventNum, function, NULL, userData, agentID);
+	uintptr_t samplingPeriod = 0;
+	uintptr_t rateLimit = 0;
+	va_list args;
+
+	va_start(args, userData);
+	J9HookReadRegistrationArgs(taggedEventNum, args, &agentID, &samplingPeriod, &rateLimit);
+	va_end(args);
+	return J9HookRegisterWithCallSitePrivate(hookInterface, taggedEventNum, function, NULL, userData, agentID, samplingPeriod, rateLimit);
 }
 
 static intptr_t
 J9HookRegisterWithCallSite(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum, J9HookFunction function, const char *callsite, void *userData, ...)
 {
 	uintptr_t agentID = J9HOOK_AGENTID_DEFAULT;
+	uintptr_t samplingPeriod = 0;
+	uintptr_t rateLimit = 0;
+	va_list args;
+
+	va_start(args, userData);
+	J9HookReadRegistrationArgs(taggedEventNum, args, &agentID, &samplingPeriod, &rateLimit);
+	va_end(args);
+	return J9HookRegisterWithCallSitePrivate(hookInterface, taggedEventNum, function, callsite, userData, agentID, samplingPeriod, rateLimit);
+}
 
+/*
+ * Read the optional registration arguments selected by the tags in taggedEventNum,
+ * in the order agent ID, sampling period, rate limit.
+ */
+static void
+J9HookReadRegistrationArgs(uintptr_t taggedEventNum, va_list args, uintptr_t *agentID, uintptr_t *samplingPeriod, uintptr_t *rateLimit)
+{
 	if (taggedEventNum & J9HOOK_TAG_AGENT_ID) {
-		va_list args;
+		*agentID = va_arg(args, uintptr_t);
+	}
+	if (taggedEventNum & J9HOOK_TAG_SAMPLED) {
+		/* a period of 1 samples every event */
+		*samplingPeriod = va_arg(args, uintptr_t);
+		if (1 == *samplingPeriod) {
+			*samplingPeriod = 0;
+		}
+	}
+	if (taggedEventNum & J9HOOK_TAG_RATE_LIMITED) {
+		/* the count of events delivered in a window has 32 bits */
+		*rateLimit = va_arg(args, uintptr_t);
+		if (*rateLimit > 0xFFFFFFFF) {
+			*rateLimit = 0xFFFFFFFF;
+		}
+	}
+}
+
 
-		va_start(args, userData);
-		agentID = va_arg(args, uintptr_t);
-		va_end(args);
+/*
+ * Publish a new listener array for eventNum holding a copy of the valid records of the
+ * event, in dispatch order. The interface lock must be held. The replaced array is retired
+ * rather than freed because dispatching threads may still be reading it. Each publication
+ * advances the dispatch epoch and frees the retired arrays which no dispatch can still be reading.
+ *
+ * Returns 0 on success, J9HOOK_ERR_NOMEM if the new array could not be allocated
+ */
+static intptr_t
+J9HookPublishListeners(J9CommonHookInterface *commonInterface, uintptr_t eventNum)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+	J9HookListenerArray *oldArray = commonInterface->listeners[eventNum];
+	J9HookListenerArray *newArray = NULL;
+	J9HookRecord *record = NULL;
+	uintptr_t count = 0;
+
+	for (record = HOOK_RECORD(commonInterface, eventNum); NULL != record; record = record->next) {
+		if (HOOK_IS_VALID_ID(record->id)) {
+			count += 1;
+		}
 	}
-	return J9HookRegisterWithCallSitePrivate(hookInterface, taggedEventNum, function, callsite, userData, agentID);
+
+	if (0 != count) {
+		J9HookListener *listener = NULL;
+
+		newArray = (J9HookListenerArray *)omrmem_allocate_memory(offsetof(J9HookListenerArray, listeners) + (count * sizeof(J9HookListener)), OMRMEM_CATEGORY_VM);
+		if (NULL == newArray) {
+			return J9HOOK_ERR_NOMEM;
+		}
+		newArray->retiredNext = NULL;
+		newArray->retiredEpoch = 0;
+		newArray->count = count;
+
+		listener = newArray->listeners;
+		for (record = HOOK_RECORD(commonInterface, eventNum); NULL != record; record = record->next) {
+			if (HOOK_IS_VALID_ID(record->id)) {
+				listener->record = record;
+				listener->id = record->id;
+				listener->function = record->function;
+				listener->callsite = record->callsite;
+				listener->userData = record->userData;
+				listener->samplingPeriod = record->samplingPeriod;
+				listener->rateLimit = record->rateLimit;
+				listener += 1;
+			}
+		}
+
+		/* ensure that the array is complete before it can be seen by dispatch */
+		VM_AtomicSupport::writeBarrier();
+	}
+
+	commonInterface->listeners[eventNum] = newArray;
+
+	if (NULL != oldArray) {
+		oldArray->retiredEpoch = commonInterface->dispatchEpoch;
+		oldArray->retiredNext = commonInterface->retiredListeners;
+		commonInterface->retiredListeners = oldArray;
+	}
+
+	/* a dispatch which reads the advanced epoch also reads the new array */
+	VM_AtomicSupport::writeBarrier();
+	commonInterface->dispatchEpoch += 1;
+	VM_AtomicSupport::readWriteBarrier();
+
+	J9HookReclaimListeners(commonInterface);
+
+	return 0;
 }
 
+/*
+ * Free the retired listener arrays which no dispatch can still be reading. A dispatch can only be
+ * reading an array retired at or after the epoch in its slot, so every array retired before the
+ * oldest epoch of a dispatch in progress is freed. The interface lock must be held.
+ */
+static void
+J9HookReclaimListeners(J9CommonHookInterface *commonInterface)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+	uintptr_t oldestEpoch = commonInterface->dispatchEpoch;
+	J9HookListenerArray **link = &commonInterface->retiredListeners;
+	J9HookListenerArray *retired = NULL;
+	J9HookDispatchSlot *slot = NULL;
+	pool_state walkState;
+
+	if (0 != commonInterface->unslottedDispatches) {
+		/* the epoch of a dispatch without a slot is unknown */
+		return;
+	}
+
+	slot = (J9HookDispatchSlot *)pool_startDo(commonInterface->dispatchSlots, &walkState);
+	while (NULL != slot) {
+		uintptr_t epoch = slot->epoch;
+		if ((0 != epoch) && (epoch < oldestEpoch)) {
+			oldestEpoch = epoch;
+		}
+		slot = (J9HookDispatchSlot *)pool_nextDo(&walkState);
+	}
+
+	/* the retired arrays are newest first */
+	while ((NULL != *link) && ((*link)->retiredEpoch >= oldestEpoch)) {
+		link = &(*link)->retiredNext;
+	}
+	retired = *link;
+	*link = NULL;
+	while (NULL != retired) {
+		J9HookListenerArray *next = retired->retiredNext;
+		omrmem_free_memory(retired);
+		retired = next;
+	}
+}
+
+/*
+ * Decide whether a sampled or rate limited listener receives the current event.
+ * The counters are updated atomically so that concurrent dispatches of the same
+ * event sample it consistently.
+ *
+ * Returns true if the listener should be called
+ */
+static bool
+J9HookSampleListener(J9CommonHookInterface *commonInterface, J9HookRecord *record, uintptr_t samplingPeriod, uintptr_t rateLimit)
+{
+	if (0 != samplingPeriod) {
+		uintptr_t count = VM_AtomicSupport::add(&record->samplingCount, 1);
+		if (0 != (count % samplingPeriod)) {
+			return false;
+		}
+	}
+
+	if (0 != rateLimit) {
+		OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+		uint64_t second = (omrtime_nano_time() / OMRPORT_TIME_DELTA_IN_NANOSECONDS) & 0xFFFFFFFF;
+		uint64_t oldWindow = record->rateLimitWindow;
+
+		for (;;) {
+			uint64_t newWindow = 0;
+			if (HOOK_RATE_WINDOW_SECOND(oldWindow) != second) {
+				/* first event of a new second */
+				newWindow = HOOK_RATE_WINDOW(second, 1);
+			} else if (HOOK_RATE_WINDOW_COUNT(oldWindow) < rateLimit) {
+				newWindow = oldWindow + 1;
+			} else {
+				return false;
+			}
+
+			uint64_t result = VM_AtomicSupport::lockCompareExchangeU64(&record->rateLimitWindow, oldWindow, newWindow);
+			if (result == oldWindow) {
+				break;
+			}
+			oldWindow = result;
+		}
+	}
+
+	return true;
+}
 
 /*
  * Remove the specified function from the listeners for eventNum.
@@ -553,6 +937,13 @@ J9HookUnregister(struct J9HookInterface **hookInterface, uintptr_t taggedEventNu
 		HOOK_FLAGS(commonInterface, eventNum) &= ~J9HOOK_FLAG_HOOKED;
 	}
 
+	if (hooksRemoved != 0) {
+		/* if a new listener array can't be allocated, dispatch still skips the removed
+		 * listeners in the current array because their records are now invalid
+		 */
+		J9HookPublishListeners(commonInterface, eventNum);
+	}
+
 	omrthread_monitor_exit(commonInterface->lock);
 
 	if (hooksRemoved != 0) {
@@ -30,6 +30,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "omrutilbase.h"
 #include "pool_internal.h"
 #include "ut_pool.h"
 
@@ -44,6 +45,12 @@
 #define MARK_SLOT_FREE(puddle, sindex) do { *(PUDDLE_BITS(puddle) + (((uint32_t)(sindex)) >> 5)) |=  (1 << (31 - (((uint32_t)(sindex)) & 31))); } while (0)
 #define MARK_SLOT_USED(puddle, sindex) do { *(PUDDLE_BITS(puddle) + (((uint32_t)(sindex)) >> 5)) &= ~(1 << (31 - (((uint32_t)(sindex)) & 31))); } while (0)
 
+/* POOL_CONCURRENT puddles follow the puddle bits with a second bitmap in which a set bit marks a slot that may be claimed. */
+#define PUDDLE_AVAILABLE_BITS(pool, puddle) (PUDDLE_BITS(puddle) + POOL_PUDDLE_BITS_LEN(pool))
+#define POOL_PUDDLE_BITMAPS_LEN(pool) (((pool)->flags & POOL_CONCURRENT) ? (2 * POOL_PUDDLE_BITS_LEN(pool)) : POOL_PUDDLE_BITS_LEN(pool))
+#define SLOT_WORD(bitmap, sindex) ((bitmap) + (((uint32_t)(sindex)) >> 5))
+#define SLOT_MASK(sindex) (((uint32_t)1) << (31 - (((uint32_t)(sindex)) & 31)))
+
 #define COMPUTE_FIRST_ELEMENT(align, puddle, bitlength) (ROUND_TO((align), ((uintptr_t) (puddle)) + sizeof(J9PoolPuddle) + ((bitlength)*sizeof(uint32_t))))
 
 /* HOLE_FREQUENCY defines how often a hole appears - there is a hole every HOLE_FREQUENCY elements. Must be power of two. */
@@ -128,13 +135,27 @@ poolPuddle_init(J9Pool *pool, J9PoolPuddle *puddle)
 	}
 
 	bitlength = POOL_PUDDLE_BITS_LEN(pool);
-	NNSRP_SET(puddle->firstElementAddress, COMPUTE_FIRST_ELEMENT(firstElementAlignment, puddle, bitlength));
+	NNSRP_SET(puddle->firstElementAddress, COMPUTE_FIRST_ELEMENT(firstElementAlignment, puddle, POOL_PUDDLE_BITMAPS_LEN(pool)));
 	puddle->usedElements = 0;
 
 	/* Mark all slots as free. */
 	bits = PUDDLE_BITS(puddle);
 	memset(bits, -1, bitlength * sizeof(uint32_t));
 
+	if (pool->flags & POOL_CONCURRENT) {
+		/* Every element slot can be claimed. Holes and the slots past the end of the puddle never can. */
+		uint32_t *available = PUDDLE_AVAILABLE_BITS(pool, puddle);
+		uintptr_t slot;
+
+		memset(available, 0, bitlength * sizeof(uint32_t));
+		for (slot = 0; slot < pool->elementsPerPuddle; slot++) {
+			void *element = (void *)((uintptr_t)J9POOLPUDDLE_FIRSTELEMENTADDRESS(puddle) + pool->elementSize * slot);
+			if (!ELEMENT_IS_HOLE(pool, element)) {
+				*SLOT_WORD(available, slot) |= SLOT_MASK(slot);
+			}
+		}
+	}
+
 	/* Build the free list, containing all element slots. */
 	if (pool->flags & POOL_USES_HOLES) {
 		freeLocation = (uintptr_t *)((uintptr_t)J9POOLPUDDLE_FIRSTELEMENTADDRESS(puddle) + pool->elementSize);
@@ -280,6 +301,7 @@ pool_new(uintptr_t structSizeArg,
 	uint64_t tempAllocSize, puddleAllocSize;
 	uint32_t finalNumberOfElements, minNumberElements;
 	uint32_t roundedStructSize, puddleHeaderAllocSize, puddleBitsSize, newPuddleBitsSize;
+	uint32_t puddleBitmapCount = 1;
 	J9Pool *pool;
 	uint32_t firstElementAlignment;
 	uint32_t structSize = (uint32_t)structSizeArg;
@@ -305,6 +327,12 @@ pool_new(uintptr_t structSizeArg,
 		minNumberElements = numberElements;
 	}
 
+	if (poolFlags & POOL_CONCURRENT) {
+		/* Puddles are reached without locks, so they must never be freed. */
+		poolFlags |= POOL_NEVER_FREE_PUDDLES;
+		puddleBitmapCount = 2;
+	}
+
 	roundedStructSize = ROUND_TO(elementAlignment, structSize);
 
 	poolFlags &= ~POOL_USES_HOLES;
@@ -346,11 +374,12 @@ pool_new(uintptr_t structSizeArg,
 	 * +--------------+-------------+--------------------+   +-------------+------------+-------------+------------+-----+
 	 *
 	 * Note: With POOL_USES_HOLES, puddleSRPs are instead stored once in every HOLE_FREQUENCY slots.
+	 * Note: With POOL_CONCURRENT, the puddle bits are followed by the bitmap of claimable slots.
 	 */
 	newPuddleBitsSize = ((minNumberElements + 31) >> 3);
 	do {
 		puddleBitsSize = newPuddleBitsSize;
-		puddleHeaderAllocSize = ROUND_TO(elementAlignment, sizeof(J9PoolPuddle) + puddleBitsSize) + (firstElementAlignment - MALLOC_ALIGNMENT);
+		puddleHeaderAllocSize = ROUND_TO(elementAlignment, sizeof(J9PoolPuddle) + puddleBitsSize * puddleBitmapCount) + (firstElementAlignment - MALLOC_ALIGNMENT);
 		if (poolFlags & POOL_USES_HOLES) {
 			/* Every sector has HOLE_FREQUENCY (16) slots (one of which is the "hole"). */
 			uint32_t sectorSize = roundedStructSize * HOLE_FREQUENCY;
@@ -467,6 +496,9 @@ pool_kill(J9Pool *pool)
  *  grafted onto the end of the pool's puddle chain and the
  *  element returned will come from this puddle.
  *
+ *	For a POOL_CONCURRENT pool this is equivalent to
+ *  @ref pool_newElementConcurrent without a magazine.
+ *
  * @param[in] pool
  *
  * @return NULL on error
@@ -490,6 +522,12 @@ pool_newElement(J9Pool *pool)
 		return NULL;
 	}
 
+	if (pool->flags & POOL_CONCURRENT) {
+		newElement = pool_newElementConcurrent(pool, NULL);
+		Trc_pool_newElement_Exit(newElement);
+		return newElement;
+	}
+
 	/* Check if there is a puddle with free slots - if so use it. */
 	puddleList = J9POOL_PUDDLELIST(pool);
 
@@ -559,6 +597,9 @@ pool_newElement(J9Pool *pool)
  * pool with @ref pool_startDo / @ref pool_nextDo on the element
  * returned by those calls.
  *
+ * For a POOL_CONCURRENT pool this is equivalent to
+ * @ref pool_removeElementConcurrent without a magazine.
+ *
  * @param[in] pool
  * @param[in] anElement Pointer to the element to be removed
  *
@@ -581,6 +622,12 @@ pool_removeElement(J9Pool *pool, void *anElement)
 		return;
 	}
 
+	if (pool->flags & POOL_CONCURRENT) {
+		pool_removeElementConcurrent(pool, NULL, anElement);
+		Trc_pool_removeElement_Exit();
+		return;
+	}
+
 	puddleList = J9POOL_PUDDLELIST(pool);
 	puddleSRP = pool_getElementPuddleSRP(pool, anElement);
 	puddle = NNSRP_GET(*puddleSRP, J9PoolPuddle *);
@@ -622,6 +669,428 @@ pool_removeElement(J9Pool *pool, void *anElement)
 	Trc_pool_removeElement_Exit();
 }
 
+/**
+ * Atomically set bits in a bitmap word.
+ *
+ * @param[in] word The bitmap word to update.
+ * @param[in] mask The bits to set.
+ *
+ * @return The value of the word before it was updated.
+ */
+static uint32_t
+pool_setBitsAtomic(uint32_t *word, uint32_t mask)
+{
+	uint32_t oldValue = *(volatile uint32_t *)word;
+
+	for (;;) {
+		uint32_t seen = compareAndSwapU32(word, oldValue, oldValue | mask);
+		if (seen == oldValue) {
+			break;
+		}
+		oldValue = seen;
+	}
+
+	return oldValue;
+}
+
+/**
+ * Atomically clear bits in a bitmap word.
+ *
+ * @param[in] word The bitmap word to update.
+ * @param[in] mask The bits to clear.
+ *
+ * @return The value of the word before it was updated.
+ */
+static uint32_t
+pool_clearBitsAtomic(uint32_t *word, uint32_t mask)
+{
+	uint32_t oldValue = *(volatile uint32_t *)word;
+
+	for (;;) {
+		uint32_t seen = compareAndSwapU32(word, oldValue, oldValue & ~mask);
+		if (seen == oldValue) {
+			break;
+		}
+		oldValue = seen;
+	}
+
+	return oldValue;
+}
+
+/**
+ * Claim up to count free slots of a POOL_CONCURRENT puddle.
+ *
+ * Slots are claimed a bitmap word at a time, by clearing their bits in the
+ * puddle's available bitmap with a single compare and swap. The puddle SRP
+ * of each claimed element is set so that it can later be returned to its puddle.
+ *
+ * @param[in] pool     The pool containing the puddle.
+ * @param[in] puddle   The puddle to claim slots from.
+ * @param[out] elements Receives the claimed elements.
+ * @param[in] count    The maximum number of slots to claim.
+ *
+ * @return The number of slots claimed.
+ */
+static uintptr_t
+poolPuddle_claimSlots(J9Pool *pool, J9PoolPuddle *puddle, void **elements, uintptr_t count)
+{
+	uint32_t *available = PUDDLE_AVAILABLE_BITS(pool, puddle);
+	uintptr_t bitlength = POOL_PUDDLE_BITS_LEN(pool);
+	uintptr_t firstElementAddress = (uintptr_t)J9POOLPUDDLE_FIRSTELEMENTADDRESS(puddle);
+	uintptr_t claimed = 0;
+	uintptr_t word;
+
+	for (word = 0; (word < bitlength) && (claimed < count); word++) {
+		uint32_t oldValue = *(volatile uint32_t *)(available + word);
+		uint32_t taken = 0;
+
+		while (0 != oldValue) {
+			uint32_t seen;
+			uint32_t mask;
+			uintptr_t wanted = count - claimed;
+
+			/* Take the lowest available slots of the word first. */
+			taken = 0;
+			for (mask = SLOT_MASK(0); (0 != mask) && (0 != wanted); mask >>= 1) {
+				if (oldValue & mask) {
+					taken |= mask;
+					wanted -= 1;
+				}
+			}
+
+			seen = compareAndSwapU32(available + word, oldValue, oldValue & ~taken);
+			if (seen == oldValue) {
+				break;
+			}
+			oldValue = seen;
+			taken = 0;
+		}
+
+		if (0 != taken) {
+			uintptr_t bit;
+
+			for (bit = 0; bit < 32; bit++) {
+				if (taken & SLOT_MASK(bit)) {
+					void *element = (void *)(firstElementAddress + pool->elementSize * (word * 32 + bit));
+					NNSRP_SET(*pool_getElementPuddleSRP(pool, element), puddle);
+					elements[claimed] = element;
+					claimed += 1;
+				}
+			}
+		}
+	}
+
+	return claimed;
+}
+
+/**
+ * Make a claimed slot of a POOL_CONCURRENT pool available to be claimed again.
+ *
+ * @param[in] pool    The pool containing the element.
+ * @param[in] element The claimed element.
+ *
+ * @return none
+ */
+static void
+pool_releaseElement(J9Pool *pool, void *element)
+{
+	J9PoolPuddle *puddle = NNSRP_GET(*pool_getElementPuddleSRP(pool, element), J9PoolPuddle *);
+	int32_t slot = pool_getElementPuddleSlot(pool, puddle, element);
+
+	pool_setBitsAtomic(SLOT_WORD(PUDDLE_AVAILABLE_BITS(pool, puddle), slot), SLOT_MASK(slot));
+}
+
+/**
+ * Count the allocated elements of a POOL_CONCURRENT puddle from its puddle bits.
+ *
+ * The usedElements of a concurrent puddle are not maintained, because elements
+ * move between the puddle and the magazines without taking part in the count.
+ *
+ * @param[in] pool    The pool containing the puddle.
+ * @param[in] puddle  The puddle.
+ *
+ * @return The number of slots marked as used.
+ */
+static uintptr_t
+poolPuddle_countUsedSlots(J9Pool *pool, J9PoolPuddle *puddle)
+{
+	uint32_t *bits = PUDDLE_BITS(puddle);
+	uintptr_t bitlength = POOL_PUDDLE_BITS_LEN(pool);
+	uintptr_t used = 0;
+	uintptr_t word;
+
+	/* Holes and the slots past the end of the puddle are always marked free. */
+	for (word = 0; word < bitlength; word++) {
+		uint32_t usedBits = ~*(volatile uint32_t *)(bits + word);
+
+		while (0 != usedBits) {
+			usedBits &= usedBits - 1;
+			used += 1;
+		}
+	}
+
+	return used;
+}
+
+/**
+ * Link a new puddle at the head of the puddle list of a POOL_CONCURRENT pool,
+ * provided the head is still the one the caller searched from.
+ *
+ * Threads walking the list concurrently either see the old head or the fully
+ * initialized new puddle.
+ *
+ * @param[in] pool    The pool to add the puddle to.
+ * @param[in] puddle  The new puddle.
+ * @param[in] head    The head of the puddle list the caller found exhausted.
+ *
+ * @return TRUE if the puddle was linked, FALSE if another puddle was linked first.
+ */
+static BOOLEAN
+poolPuddle_publish(J9Pool *pool, J9PoolPuddle *puddle, J9PoolPuddle *head)
+{
+	J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+	uintptr_t *headSlot = (uintptr_t *)&puddleList->nextPuddle;
+	uintptr_t oldValue = (uintptr_t)head - (uintptr_t)headSlot;
+	uintptr_t newValue = (uintptr_t)puddle - (uintptr_t)headSlot;
+
+	NNWSRP_SET(puddle->nextPuddle, head);
+	issueWriteBarrier();
+	if (oldValue != compareAndSwapUDATA(headSlot, oldValue, newValue)) {
+		return FALSE;
+	}
+
+	NNWSRP_SET(head->prevPuddle, puddle);
+	NNWSRP_SET(puddleList->nextAvailablePuddle, puddle);
+	return TRUE;
+}
+
+/**
+ * Claim up to count free elements of a POOL_CONCURRENT pool, adding a new
+ * puddle to the pool if every puddle is exhausted.
+ *
+ * The search starts at the puddle that last satisfied a claim, which is
+ * recorded in the puddle list's next available puddle. A thread which finds
+ * every puddle exhausted allocates a puddle, claims from it and links it at the
+ * head of the list only if the head is unchanged since its search. If another
+ * thread linked a puddle first, the new puddle is freed and the search repeats,
+ * so racing threads add one puddle between them without waiting on each other.
+ *
+ * The claimed elements are counted by the pool's numElements.
+ *
+ * @param[in] pool     The pool to claim elements from.
+ * @param[out] elements Receives the claimed elements.
+ * @param[in] count    The maximum number of elements to claim.
+ *
+ * @return The number of elements claimed, 0 only if a new puddle could not be allocated.
+ */
+static uintptr_t
+pool_claimElements(J9Pool *pool, void **elements, uintptr_t count)
+{
+	J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+	uintptr_t claimed = 0;
+
+	for (;;) {
+		J9PoolPuddle *head = J9POOLPUDDLELIST_NEXTPUDDLE(puddleList);
+		J9PoolPuddle *start = J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
+		J9PoolPuddle *walk;
+
+		if (NULL == start) {
+			start = head;
+		}
+
+		walk = start;
+		do {
+			claimed = poolPuddle_claimSlots(pool, walk, elements, count);
+			if (0 != claimed) {
+				if (walk != start) {
+					NNWSRP_SET(puddleList->nextAvailablePuddle, walk);
+				}
+				addAtomic((volatile uintptr_t *)&puddleList->numElements, claimed);
+				return claimed;
+			}
+			walk = J9POOLPUDDLE_NEXTPUDDLE(walk);
+			if (NULL == walk) {
+				walk = J9POOLPUDDLELIST_NEXTPUDDLE(puddleList);
+			}
+		} while (walk != start);
+
+		/* Every puddle is exhausted.  A puddle linked since the search started may have free slots. */
+		if (head == J9POOLPUDDLELIST_NEXTPUDDLE(puddleList)) {
+			walk = poolPuddle_new(pool);
+			if (NULL == walk) {
+				return 0;
+			}
+			/* Claim from the new puddle before any other thread can see it. */
+			claimed = poolPuddle_claimSlots(pool, walk, elements, count);
+			if (poolPuddle_publish(pool, walk, head)) {
+				addAtomic((volatile uintptr_t *)&puddleList->numElements, claimed);
+				return claimed;
+			}
+			pool->memFree(pool->userData, walk, POOL_ALLOC_TYPE_PUDDLE);
+		}
+	}
+}
+
+/**
+ *	Asks for the address of a new element of a POOL_CONCURRENT pool.
+ *
+ *	This may be called by several threads at once, and concurrently with
+ *  @ref pool_removeElementConcurrent. Elements are taken from the calling
+ *  thread's magazine, which is refilled with a batch of elements claimed from
+ *  the puddles when it is empty. Without a magazine, each call claims a
+ *  single element from the puddles.
+ *
+ *	The contents of the element will be set to 0's unless the
+ *  POOL_NO_ZERO flag is set on the pool, in which case the
+ *  contents are undefined.
+ *
+ * @param[in] pool
+ * @param[in] magazine The calling thread's magazine, or NULL
+ *
+ * @return NULL on error
+ * @return pointer to a new element otherwise
+ *
+ */
+void *
+pool_newElementConcurrent(J9Pool *pool, J9PoolMagazine *magazine)
+{
+	void *newElement = NULL;
+
+	Trc_pool_newElementConcurrent_Entry(pool, magazine);
+
+	if (NULL == pool) {
+		Trc_pool_newElement_ExitNoop();
+		return NULL;
+	}
+
+	if (NULL == magazine) {
+		pool_claimElements(pool, &newElement, 1);
+	} else {
+		if (0 == magazine->count) {
+			magazine->count = pool_claimElements(pool, magazine->elements, J9POOL_MAGAZINE_SIZE / 2);
+		}
+		if (0 != magazine->count) {
+			magazine->count -= 1;
+			newElement = magazine->elements[magazine->count];
+		}
+	}
+
+	if (NULL != newElement) {
+		J9SRP *puddleSRP = pool_getElementPuddleSRP(pool, newElement);
+		J9PoolPuddle *puddle = NNSRP_GET(*puddleSRP, J9PoolPuddle *);
+		int32_t slot = pool_getElementPuddleSlot(pool, puddle, newElement);
+
+		if (!(pool->flags & POOL_NO_ZERO)) {
+			memset(newElement, 0, pool->elementSize);
+		}
+		NNSRP_SET(*puddleSRP, puddle);
+
+		pool_clearBitsAtomic(SLOT_WORD(PUDDLE_BITS(puddle), slot), SLOT_MASK(slot));
+	}
+
+	Trc_pool_newElementConcurrent_Exit(newElement);
+
+	return newElement;
+}
+
+/**
+ *	Deallocates an element from a POOL_CONCURRENT pool.
+ *
+ *	This may be called by several threads at once, and concurrently with
+ *  @ref pool_newElementConcurrent. The element is kept in the calling thread's
+ *  magazine for reuse; when the magazine is full, half of it is returned to the
+ *  puddles. Without a magazine, the element is returned to its puddle directly.
+ *
+ * @param[in] pool
+ * @param[in] magazine The calling thread's magazine, or NULL
+ * @param[in] anElement Pointer to the element to be removed
+ *
+ * @return none
+ *
+ */
+void
+pool_removeElementConcurrent(J9Pool *pool, J9PoolMagazine *magazine, void *anElement)
+{
+	J9PoolPuddle *puddle;
+	int32_t slot;
+	uint32_t mask;
+
+	Trc_pool_removeElementConcurrent_Entry(pool, magazine, anElement);
+
+	if (!(pool && anElement)) {
+		Trc_pool_removeElement_ExitNoop();
+		return;
+	}
+
+	puddle = NNSRP_GET(*pool_getElementPuddleSRP(pool, anElement), J9PoolPuddle *);
+	slot = pool_getElementPuddleSlot(pool, puddle, anElement);
+	if (slot < 0) {
+		Trc_pool_removeElementConcurrent_NotFound(anElement, puddle);
+		Trc_pool_removeElementConcurrent_Exit();
+		return;		/* this is an error...  we were passed a bogus data pointer. */
+	}
+
+	mask = SLOT_MASK(slot);
+	if (pool_setBitsAtomic(SLOT_WORD(PUDDLE_BITS(puddle), slot), mask) & mask) {
+		Trc_pool_removeElementConcurrent_NotFound(anElement, puddle);
+		Trc_pool_removeElementConcurrent_Exit();
+		return;		/* this is an error... the slot was already free. */
+	}
+
+	if (NULL == magazine) {
+		pool_releaseElement(pool, anElement);
+		subtractAtomic((volatile uintptr_t *)&J9POOL_PUDDLELIST(pool)->numElements, 1);
+	} else {
+		if (J9POOL_MAGAZINE_SIZE == magazine->count) {
+			/* Return the least recently freed half of the magazine, and keep the rest. */
+			uintptr_t i;
+
+			for (i = 0; i < J9POOL_MAGAZINE_SIZE / 2; i++) {
+				pool_releaseElement(pool, magazine->elements[i]);
+				magazine->elements[i] = magazine->elements[i + J9POOL_MAGAZINE_SIZE / 2];
+			}
+			magazine->count = J9POOL_MAGAZINE_SIZE / 2;
+			subtractAtomic((volatile uintptr_t *)&J9POOL_PUDDLELIST(pool)->numElements, J9POOL_MAGAZINE_SIZE / 2);
+		}
+		magazine->elements[magazine->count] = anElement;
+		magazine->count += 1;
+	}
+
+	Trc_pool_removeElementConcurrent_Exit();
+}
+
+/**
+ *	Returns every element held by a magazine to the puddles of its POOL_CONCURRENT pool.
+ *
+ *	A thread must flush its magazine before it stops using the pool, otherwise the
+ *  elements it holds can never be allocated again. After @ref pool_clear, magazines
+ *  must instead be emptied by setting their count to 0.
+ *
+ * @param[in] pool
+ * @param[in] magazine The magazine to flush
+ *
+ * @return none
+ *
+ */
+void
+pool_flushMagazine(J9Pool *pool, J9PoolMagazine *magazine)
+{
+	uintptr_t released = 0;
+
+	Trc_pool_flushMagazine_Entry(pool, magazine);
+
+	if ((NULL != pool) && (NULL != magazine)) {
+		released = magazine->count;
+		while (0 != magazine->count) {
+			magazine->count -= 1;
+			pool_releaseElement(pool, magazine->elements[magazine->count]);
+		}
+		subtractAtomic((volatile uintptr_t *)&J9POOL_PUDDLELIST(pool)->numElements, released);
+	}
+
+	Trc_pool_flushMagazine_Exit(released);
+}
+
 /**
  *	Calls a user provided function for each element in the list.
  *
@@ -655,6 +1124,9 @@ pool_do(J9Pool *pool, void (*doFunction)(void *anElement, void *userData), void
 /**
  *	Returns the number of elements in a given pool.
  *
+ *	For a POOL_CONCURRENT pool, elements held in magazines are counted until
+ *  they are returned to the puddles.
+ *
  * @param[in] pool
  *
  * @return 0 on error
@@ -699,6 +1171,7 @@ poolPuddle_startDo(J9Pool *pool, J9PoolPuddle *currentPuddle, pool_state *state,
 {
 	int32_t slot = 0;
 	uintptr_t *currAddr;
+	uintptr_t usedElements;
 
 	Trc_poolPuddle_startDo_Entry(pool, currentPuddle, state, followNextPointers);
 
@@ -707,7 +1180,8 @@ poolPuddle_startDo(J9Pool *pool, J9PoolPuddle *currentPuddle, pool_state *state,
 		return NULL;
 	}
 
-	if (0 == currentPuddle->usedElements) {	/* this puddle is empty */
+	usedElements = (pool->flags & POOL_CONCURRENT) ? poolPuddle_countUsedSlots(pool, currentPuddle) : currentPuddle->usedElements;
+	if (0 == usedElements) {	/* this puddle is empty */
 		Trc_poolPuddle_startDo_EmptyExit();
 		if ((currentPuddle->nextPuddle != 0) && (followNextPointers != 0)) {
 			return poolPuddle_startDo(pool, J9POOLPUDDLE_NEXTPUDDLE(currentPuddle), state, followNextPointers);
@@ -725,7 +1199,7 @@ poolPuddle_startDo(J9Pool *pool, J9PoolPuddle *currentPuddle, pool_state *state,
 	state->thePool = pool;
 	state->currentPuddle = currentPuddle;
 	state->lastSlot = slot;
-	state->leftToDo = currentPuddle->usedElements - 1;
+	state->leftToDo = usedElements - 1;
 	state->flags = 0;
 	if (followNextPointers) {
 		state->flags |= POOLSTATE_FOLLOW_NEXT_POINTERS;
@@ -752,6 +1226,9 @@ poolPuddle_startDo(J9Pool *pool, J9PoolPuddle *currentPuddle, pool_state *state,
  *
  *	Pass in a pointer to an empty pool_state and it will be filled in.
  *
+ *	For a POOL_CONCURRENT pool, no other thread may allocate or free elements
+ *  until the iteration is complete. Elements held in magazines are not returned.
+ *
  * @param[in] pool  The pool to "do" things to
  * @param[in] state The pool_state to be used for this iteration.
  *
@@ -841,6 +1318,7 @@ pool_nextDo(pool_state *state)
  * Clear the contents of a pool, but do not de-allocate the puddles or the pool.
  *
  * @note Make no assumptions about the contents of the pool after invoking this method (it currently does not zero the memory)
+ * @note Any magazines of a POOL_CONCURRENT pool must be emptied by setting their count to 0, not flushed.
  *
  * @param[in] pool The pool to clear
  *